@@ -4,11 +4,36 @@
 
 #include "flutter/assets/asset_manager.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include "flutter/assets/directory_asset_bundle.h"
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
 
+namespace {
+
+// The state shared by the reads of a |AssetManager::GetAsMappingsAsync| call.
+// Each task takes the next unread asset until there are none left, and the
+// task that reads the last one hands all the mappings to the callback.
+struct MappingsBatch {
+  std::vector<std::string> asset_names;
+  std::vector<std::unique_ptr<fml::Mapping>> mappings;
+  std::atomic<size_t> next_read{0};
+  std::atomic<size_t> pending_reads{0};
+  fml::RefPtr<fml::TaskRunner> callback_task_runner;
+  AssetManager::MappingsCallback callback;
+
+  void PostCallback(const std::shared_ptr<MappingsBatch>& batch) {
+    callback_task_runner->PostTask(
+        [batch]() { batch->callback(std::move(batch->mappings)); });
+  }
+};
+
+}  // namespace
+
 AssetManager::AssetManager() = default;
 
 AssetManager::~AssetManager() = default;
@@ -18,6 +43,7 @@ bool AssetManager::PushFront(std::unique_ptr<AssetResolver> resolver) {
     return false;
   }
 
+  std::unique_lock lock(resolvers_mutex_);
   resolvers_.push_front(std::move(resolver));
   return true;
 }
@@ -27,6 +53,7 @@ bool AssetManager::PushBack(std::unique_ptr<AssetResolver> resolver) {
     return false;
   }
 
+  std::unique_lock lock(resolvers_mutex_);
   resolvers_.push_back(std::move(resolver));
   return true;
 }
@@ -37,8 +64,10 @@ void AssetManager::UpdateResolverByType(
   if (updated_asset_resolver == nullptr) {
     return;
   }
-  bool updated = false;
+  // The replaced resolver is destroyed once the lock is released.
   std::deque<std::unique_ptr<AssetResolver>> new_resolvers;
+  std::unique_lock lock(resolvers_mutex_);
+  bool updated = false;
   for (auto& old_resolver : resolvers_) {
     if (!updated && old_resolver->GetType() == type) {
       // Push the replacement updated resolver in place of the old_resolver.
@@ -56,6 +85,7 @@ void AssetManager::UpdateResolverByType(
 }
 
 std::deque<std::unique_ptr<AssetResolver>> AssetManager::TakeResolvers() {
+  std::unique_lock lock(resolvers_mutex_);
   return std::move(resolvers_);
 }
 
@@ -67,6 +97,7 @@ std::unique_ptr<fml::Mapping> AssetManager::GetAsMapping(
   }
   TRACE_EVENT1("flutter", "AssetManager::GetAsMapping", "name",
                asset_name.c_str());
+  std::shared_lock lock(resolvers_mutex_);
   for (const auto& resolver : resolvers_) {
     auto mapping = resolver->GetAsMapping(asset_name);
     if (mapping != nullptr) {
@@ -87,6 +118,7 @@ std::vector<std::unique_ptr<fml::Mapping>> AssetManager::GetAsMappings(
   }
   TRACE_EVENT1("flutter", "AssetManager::GetAsMappings", "pattern",
                asset_pattern.c_str());
+  std::shared_lock lock(resolvers_mutex_);
   for (const auto& resolver : resolvers_) {
     auto resolver_mappings = resolver->GetAsMappings(asset_pattern, subdir);
     mappings.insert(mappings.end(),
@@ -96,8 +128,53 @@ std::vector<std::unique_ptr<fml::Mapping>> AssetManager::GetAsMappings(
   return mappings;
 }
 
+void AssetManager::GetAsMappingsAsync(
+    std::vector<std::string> asset_names,
+    const std::shared_ptr<fml::BasicTaskRunner>& worker_task_runner,
+    const fml::RefPtr<fml::TaskRunner>& callback_task_runner,
+    MappingsCallback callback) const {
+  FML_DCHECK(worker_task_runner && callback_task_runner && callback);
+  TRACE_EVENT0("flutter", "AssetManager::GetAsMappingsAsync");
+  std::shared_ptr<const AssetManager> asset_manager = weak_from_this().lock();
+  FML_CHECK(asset_manager)
+      << "Assets can only be read asynchronously from an asset manager owned "
+         "by a std::shared_ptr.";
+
+  auto batch = std::make_shared<MappingsBatch>();
+  batch->mappings.resize(asset_names.size());
+  batch->pending_reads = asset_names.size();
+  batch->asset_names = std::move(asset_names);
+  batch->callback_task_runner = callback_task_runner;
+  batch->callback = std::move(callback);
+
+  if (batch->asset_names.empty()) {
+    batch->PostCallback(batch);
+    return;
+  }
+
+  // Posting a task per asset costs more than reading most assets, so only post
+  // as many tasks as there can be workers.
+  const size_t task_count = std::min<size_t>(
+      batch->asset_names.size(),
+      std::max(std::thread::hardware_concurrency(), 1u));
+  for (size_t task = 0; task < task_count; task++) {
+    worker_task_runner->PostTask([asset_manager, batch]() {
+      for (size_t i = batch->next_read++; i < batch->asset_names.size();
+           i = batch->next_read++) {
+        batch->mappings[i] =
+            asset_manager->GetAsMapping(batch->asset_names[i]);
+        if (batch->pending_reads.fetch_sub(1, std::memory_order_acq_rel) ==
+            1) {
+          batch->PostCallback(batch);
+        }
+      }
+    });
+  }
+}
+
 // |AssetResolver|
 bool AssetManager::IsValid() const {
+  std::shared_lock lock(resolvers_mutex_);
   return !resolvers_.empty();
 }
 
@@ -116,6 +193,11 @@ bool AssetManager::operator==(const AssetResolver& other) const {
   if (!other_manager) {
     return false;
   }
+  if (other_manager == this) {
+    return true;
+  }
+  std::shared_lock lock(resolvers_mutex_);
+  std::shared_lock other_lock(other_manager->resolvers_mutex_);
   if (resolvers_.size() != other_manager->resolvers_.size()) {
     return false;
   }
@@ -6,18 +6,32 @@
 #define FLUTTER_ASSETS_ASSET_MANAGER_H_
 
 #include <deque>
+#include <functional>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 
 #include <optional>
 #include "flutter/assets/asset_resolver.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/ref_counted.h"
+#include "flutter/fml/task_runner.h"
 
 namespace flutter {
 
-class AssetManager final : public AssetResolver {
+//------------------------------------------------------------------------------
+/// @brief      Resolves assets from a queue of asset resolvers.
+///
+///             Assets may be read on any thread, while the resolvers are
+///             updated, for example after a hot reload. Updating the resolvers
+///             waits for the reads in progress to finish.
+///
+class AssetManager final : public AssetResolver,
+                           public std::enable_shared_from_this<AssetManager> {
  public:
+  using MappingsCallback =
+      std::function<void(std::vector<std::unique_ptr<fml::Mapping>>)>;
+
   AssetManager();
 
   ~AssetManager() override;
@@ -88,6 +102,32 @@ class AssetManager final : public AssetResolver {
       const std::string& asset_pattern,
       const std::optional<std::string>& subdir) const override;
 
+  //--------------------------------------------------------------------------
+  /// @brief      Reads the named assets in parallel on the workers of
+  ///             `worker_task_runner`, then calls `callback` with their
+  ///             mappings on `callback_task_runner`.
+  ///
+  ///             The asset manager must be owned by a `std::shared_ptr`, which
+  ///             the reads keep alive until they are done.
+  ///
+  /// @param[in]  asset_names  The names of the assets to read.
+  ///
+  /// @param[in]  worker_task_runner  The task runner the reads are posted to.
+  ///             At most one task per hardware thread is posted, and each
+  ///             task reads assets until none are left. Usually the
+  ///             concurrent worker task runner of the VM.
+  ///
+  /// @param[in]  callback_task_runner  The task runner `callback` runs on.
+  ///
+  /// @param[in]  callback  Called once with one mapping per asset name, in
+  ///             the same order. Assets that could not be found are null.
+  ///
+  void GetAsMappingsAsync(
+      std::vector<std::string> asset_names,
+      const std::shared_ptr<fml::BasicTaskRunner>& worker_task_runner,
+      const fml::RefPtr<fml::TaskRunner>& callback_task_runner,
+      MappingsCallback callback) const;
+
   // |AssetResolver|
   bool operator==(const AssetResolver& other) const override;
 
@@ -95,6 +135,7 @@ class AssetManager final : public AssetResolver {
   const AssetManager* as_asset_manager() const override { return this; }
 
  private:
+  mutable std::shared_mutex resolvers_mutex_;
   std::deque<std::unique_ptr<AssetResolver>> resolvers_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(AssetManager);
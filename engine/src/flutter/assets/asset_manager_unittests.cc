@@ -0,0 +1,133 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/asset_manager.h"
+
+#include <atomic>
+
+#include "flutter/assets/directory_asset_bundle.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/file.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/thread.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+std::shared_ptr<AssetManager> CreateAssetManager(
+    const fml::ScopedTemporaryDirectory& dir) {
+  auto asset_manager = std::make_shared<AssetManager>();
+  asset_manager->PushBack(std::make_unique<DirectoryAssetBundle>(
+      fml::OpenDirectory(dir.path().c_str(), false,
+                         fml::FilePermission::kRead),
+      false));
+  return asset_manager;
+}
+
+}  // namespace
+
+TEST(AssetManagerTest, GetsMappingsAsynchronouslyInOrder) {
+  fml::ScopedTemporaryDirectory dir;
+  std::vector<std::string> names;
+  for (size_t i = 0; i < 50; i++) {
+    names.push_back("asset_" + std::to_string(i));
+    ASSERT_TRUE(fml::WriteAtomically(dir.fd(), names.back().c_str(),
+                                     fml::DataMapping(names.back())));
+  }
+  names.push_back("missing");
+  auto asset_manager = CreateAssetManager(dir);
+
+  auto workers = fml::ConcurrentMessageLoop::Create(4);
+  fml::Thread callback_thread("callback");
+  auto callback_task_runner = callback_thread.GetTaskRunner();
+  fml::AutoResetWaitableEvent latch;
+  std::vector<std::unique_ptr<fml::Mapping>> mappings;
+  asset_manager->GetAsMappingsAsync(
+      names, workers->GetTaskRunner(), callback_task_runner,
+      [&](std::vector<std::unique_ptr<fml::Mapping>> result) {
+        EXPECT_TRUE(callback_task_runner->RunsTasksOnCurrentThread());
+        mappings = std::move(result);
+        latch.Signal();
+      });
+  latch.Wait();
+
+  ASSERT_EQ(mappings.size(), names.size());
+  for (size_t i = 0; i + 1 < names.size(); i++) {
+    ASSERT_TRUE(mappings[i]) << names[i];
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(
+                              mappings[i]->GetMapping()),
+                          mappings[i]->GetSize()),
+              names[i]);
+  }
+  EXPECT_FALSE(mappings.back());
+}
+
+TEST(AssetManagerTest, GetsNoMappingsAsynchronously) {
+  fml::ScopedTemporaryDirectory dir;
+  auto asset_manager = CreateAssetManager(dir);
+
+  auto workers = fml::ConcurrentMessageLoop::Create(1);
+  fml::Thread callback_thread("callback");
+  fml::AutoResetWaitableEvent latch;
+  size_t mapping_count = 1;
+  asset_manager->GetAsMappingsAsync(
+      {}, workers->GetTaskRunner(), callback_thread.GetTaskRunner(),
+      [&](std::vector<std::unique_ptr<fml::Mapping>> result) {
+        mapping_count = result.size();
+        latch.Signal();
+      });
+  latch.Wait();
+  EXPECT_EQ(mapping_count, 0u);
+}
+
+TEST(AssetManagerTest, GetsMappingsAsynchronouslyWhileResolversAreUpdated) {
+  fml::ScopedTemporaryDirectory dir;
+  std::vector<std::string> names;
+  for (size_t i = 0; i < 200; i++) {
+    names.push_back("asset_" + std::to_string(i));
+    ASSERT_TRUE(fml::WriteAtomically(dir.fd(), names.back().c_str(),
+                                     fml::DataMapping(names.back())));
+  }
+  auto asset_manager = CreateAssetManager(dir);
+
+  auto workers = fml::ConcurrentMessageLoop::Create(4);
+  fml::Thread callback_thread("callback");
+  fml::AutoResetWaitableEvent latch;
+  std::atomic<bool> done = false;
+  std::vector<std::unique_ptr<fml::Mapping>> mappings;
+  asset_manager->GetAsMappingsAsync(
+      names, workers->GetTaskRunner(), callback_thread.GetTaskRunner(),
+      [&](std::vector<std::unique_ptr<fml::Mapping>> result) {
+        mappings = std::move(result);
+        done = true;
+        latch.Signal();
+      });
+
+  // Replace the directory bundle the reads resolve from, like a hot reload,
+  // until they are done.
+  while (!done) {
+    asset_manager->UpdateResolverByType(
+        std::make_unique<DirectoryAssetBundle>(
+            fml::OpenDirectory(dir.path().c_str(), false,
+                               fml::FilePermission::kRead),
+            false),
+        AssetResolver::AssetResolverType::kDirectoryAssetBundle);
+  }
+  latch.Wait();
+
+  ASSERT_EQ(mappings.size(), names.size());
+  for (size_t i = 0; i < names.size(); i++) {
+    ASSERT_TRUE(mappings[i]) << names[i];
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(
+                              mappings[i]->GetMapping()),
+                          mappings[i]->GetSize()),
+              names[i]);
+  }
+}
+
+}  // namespace testing
+}  // namespace flutter
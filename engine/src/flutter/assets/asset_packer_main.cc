@@ -0,0 +1,140 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Packs a directory of Flutter assets into an archive read by
+// |PackedAssetBundle|.
+//
+// asset_packer --assets-dir=<dir> --output=<archive>
+//              [--startup-manifest=<file>]
+//
+// The archive is usually written to the assets directory itself, as
+// |PackedAssetBundle::kArchiveFileName|. An existing archive there is not
+// packed again. The startup manifest lists the names of the assets needed at
+// startup, one per line, using the same names as the asset manager, e.g.
+// "fonts/MaterialIcons-Regular.otf".
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "flutter/assets/packed_asset_bundle.h"
+#include "flutter/fml/command_line.h"
+#include "flutter/fml/file.h"
+#include "flutter/fml/mapping.h"
+
+namespace flutter {
+
+namespace {
+
+bool ReadStartupManifest(const std::string& path,
+                         std::unordered_set<std::string>* asset_names) {
+  std::ifstream manifest(path);
+  if (!manifest) {
+    return false;
+  }
+  std::string asset_name;
+  while (std::getline(manifest, asset_name)) {
+    if (!asset_name.empty() && asset_name.back() == '\r') {
+      asset_name.pop_back();
+    }
+    if (!asset_name.empty()) {
+      asset_names->insert(asset_name);
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+bool Main(const fml::CommandLine& command_line) {
+  std::string assets_dir;
+  if (!command_line.GetOptionValue("assets-dir", &assets_dir)) {
+    std::cerr << "Assets directory not specified." << std::endl;
+    return false;
+  }
+
+  std::string output;
+  if (!command_line.GetOptionValue("output", &output)) {
+    std::cerr << "Output path not specified." << std::endl;
+    return false;
+  }
+
+  std::unordered_set<std::string> startup_asset_names;
+  std::string startup_manifest;
+  if (command_line.GetOptionValue("startup-manifest", &startup_manifest) &&
+      !ReadStartupManifest(startup_manifest, &startup_asset_names)) {
+    std::cerr << "Could not read startup manifest " << startup_manifest
+              << std::endl;
+    return false;
+  }
+
+  std::vector<PackedAssetBundle::Asset> assets;
+  std::error_code error;
+  const std::filesystem::path root(assets_dir);
+  for (auto it = std::filesystem::recursive_directory_iterator(root, error);
+       !error && it != std::filesystem::recursive_directory_iterator();
+       it.increment(error)) {
+    if (!it->is_regular_file()) {
+      continue;
+    }
+    // Asset names always use forward slashes.
+    std::string name = it->path().lexically_relative(root).generic_string();
+    if (name == PackedAssetBundle::kArchiveFileName) {
+      continue;
+    }
+    auto contents = fml::FileMapping::CreateReadOnly(it->path().string());
+    if (!contents) {
+      std::cerr << "Could not read asset " << it->path().string()
+                << std::endl;
+      return false;
+    }
+    bool needed_at_startup = startup_asset_names.erase(name) > 0;
+    assets.push_back({
+        .name = std::move(name),
+        .contents = std::move(contents),
+        .needed_at_startup = needed_at_startup,
+    });
+  }
+  if (error) {
+    std::cerr << "Could not list assets in " << assets_dir << ": "
+              << error.message() << std::endl;
+    return false;
+  }
+
+  for (const std::string& name : startup_asset_names) {
+    std::cerr << "Startup manifest lists unknown asset " << name << std::endl;
+  }
+
+  auto archive = PackedAssetBundle::Pack(assets);
+  if (!archive) {
+    std::cerr << "Could not pack " << assets.size() << " assets." << std::endl;
+    return false;
+  }
+
+  auto current_directory =
+      fml::OpenDirectory(std::filesystem::current_path().string().c_str(),
+                         false, fml::FilePermission::kReadWrite);
+  auto output_path =
+      std::filesystem::absolute(std::filesystem::current_path() / output);
+  if (!fml::WriteAtomically(current_directory, output_path.string().c_str(),
+                            *archive)) {
+    std::cerr << "Could not write asset archive to path " << output
+              << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
+}  // namespace flutter
+
+int main(int argc, char const* argv[]) {
+  return flutter::Main(fml::CommandLineFromPlatformOrArgcArgv(argc, argv))
+             ? EXIT_SUCCESS
+             : EXIT_FAILURE;
+}
@@ -0,0 +1,100 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "flutter/assets/asset_manager.h"
+#include "flutter/assets/directory_asset_bundle.h"
+#include "flutter/assets/packed_asset_bundle.h"
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/file.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/fml/thread.h"
+
+namespace flutter {
+
+namespace {
+
+// Writes |count| small assets both as files in |dir| and packed into an
+// archive next to them.
+std::vector<std::string> WriteAssets(const fml::UniqueFD& dir, size_t count) {
+  std::vector<std::string> names;
+  std::vector<PackedAssetBundle::Asset> assets;
+  for (size_t i = 0; i < count; i++) {
+    std::string name = "asset_" + std::to_string(i);
+    auto contents =
+        std::make_unique<fml::DataMapping>(std::string(512 + i % 512, 'a'));
+    FML_CHECK(fml::WriteAtomically(dir, name.c_str(), *contents));
+    assets.push_back({name, std::move(contents), false});
+    names.push_back(std::move(name));
+  }
+  auto archive = PackedAssetBundle::Pack(assets);
+  FML_CHECK(archive);
+  FML_CHECK(fml::WriteAtomically(dir, PackedAssetBundle::kArchiveFileName,
+                                 *archive));
+  return names;
+}
+
+void ReadAllAssets(benchmark::State& state,
+                   const AssetManager& manager,
+                   const std::vector<std::string>& names) {
+  while (state.KeepRunning()) {
+    for (const std::string& name : names) {
+      auto mapping = manager.GetAsMapping(name);
+      benchmark::DoNotOptimize(mapping->GetMapping()[0]);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+
+}  // namespace
+
+static void BM_DirectoryAssetBundleGetAsMapping(benchmark::State& state) {
+  fml::ScopedTemporaryDirectory dir;
+  auto names = WriteAssets(dir.fd(), state.range(0));
+  AssetManager manager;
+  manager.PushBack(std::make_unique<DirectoryAssetBundle>(
+      fml::OpenDirectory(dir.path().c_str(), false, fml::FilePermission::kRead),
+      false));
+  ReadAllAssets(state, manager, names);
+}
+BENCHMARK(BM_DirectoryAssetBundleGetAsMapping)->Arg(200)->Arg(500);
+
+static void BM_PackedAssetBundleGetAsMapping(benchmark::State& state) {
+  fml::ScopedTemporaryDirectory dir;
+  auto names = WriteAssets(dir.fd(), state.range(0));
+  AssetManager manager;
+  manager.PushBack(std::make_unique<PackedAssetBundle>(
+      fml::OpenFileReadOnly(dir.fd(), PackedAssetBundle::kArchiveFileName),
+      false));
+  ReadAllAssets(state, manager, names);
+}
+BENCHMARK(BM_PackedAssetBundleGetAsMapping)->Arg(500);
+
+static void BM_AssetManagerGetAsMappingsAsync(benchmark::State& state) {
+  fml::ScopedTemporaryDirectory dir;
+  auto names = WriteAssets(dir.fd(), state.range(0));
+  auto manager = std::make_shared<AssetManager>();
+  manager->PushBack(std::make_unique<DirectoryAssetBundle>(
+      fml::OpenDirectory(dir.path().c_str(), false, fml::FilePermission::kRead),
+      false));
+  auto workers = fml::ConcurrentMessageLoop::Create();
+  fml::Thread callback_thread("callback");
+  fml::AutoResetWaitableEvent latch;
+  while (state.KeepRunning()) {
+    manager->GetAsMappingsAsync(
+        names, workers->GetTaskRunner(), callback_thread.GetTaskRunner(),
+        [&latch](std::vector<std::unique_ptr<fml::Mapping>> mappings) {
+          benchmark::DoNotOptimize(mappings.back()->GetMapping()[0]);
+          latch.Signal();
+        });
+    latch.Wait();
+  }
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_AssetManagerGetAsMappingsAsync)->Arg(200);
+
+}  // namespace flutter
@@ -0,0 +1,304 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/packed_asset_bundle.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <regex>
+#include <unordered_set>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr char kMagic[] = {'F', 'L', 'T', 'P', 'A', 'C', 'K', '1'};
+
+// The magic, the number of assets and four reserved bytes.
+constexpr size_t kHeaderSize = sizeof(kMagic) + 8;
+
+// The offset and size of the contents, the offset and size of the name, and
+// the flags of an asset.
+constexpr size_t kIndexEntrySize = 8 + 8 + 4 + 2 + 2;
+
+constexpr uint16_t kNeededAtStartupFlag = 1 << 0;
+
+uint64_t ReadLittleEndian(const uint8_t* data, size_t size) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < size; i++) {
+    value |= static_cast<uint64_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+void WriteLittleEndian(uint8_t* data, size_t size, uint64_t value) {
+  for (size_t i = 0; i < size; i++) {
+    data[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+size_t AlignUp(size_t value, size_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+std::unique_ptr<fml::Mapping> PackedAssetBundle::Pack(
+    const std::vector<Asset>& assets) {
+  TRACE_EVENT0("flutter", "PackedAssetBundle::Pack");
+  if (assets.size() > std::numeric_limits<uint32_t>::max()) {
+    return nullptr;
+  }
+
+  // Keep the assets needed at startup next to each other so that reading
+  // them ahead takes as few requests as possible.
+  std::vector<const Asset*> ordered;
+  ordered.reserve(assets.size());
+  for (const Asset& asset : assets) {
+    ordered.push_back(&asset);
+  }
+  std::stable_partition(ordered.begin(), ordered.end(), [](const Asset* asset) {
+    return asset->needed_at_startup;
+  });
+
+  std::unordered_set<std::string> names;
+  size_t names_offset = kHeaderSize + kIndexEntrySize * assets.size();
+  size_t names_size = 0;
+  for (const Asset* asset : ordered) {
+    if (asset->name.empty() ||
+        asset->name.size() > std::numeric_limits<uint16_t>::max() ||
+        !names.insert(asset->name).second) {
+      return nullptr;
+    }
+    names_size += asset->name.size();
+  }
+  if (names_offset + names_size > std::numeric_limits<uint32_t>::max()) {
+    return nullptr;
+  }
+
+  std::vector<size_t> contents_offsets;
+  contents_offsets.reserve(ordered.size());
+  size_t archive_size = AlignUp(names_offset + names_size, kAlignment);
+  for (const Asset* asset : ordered) {
+    contents_offsets.push_back(archive_size);
+    size_t size = asset->contents ? asset->contents->GetSize() : 0;
+    archive_size = AlignUp(archive_size + size, kAlignment);
+  }
+
+  std::vector<uint8_t> archive(archive_size, 0);
+  memcpy(archive.data(), kMagic, sizeof(kMagic));
+  WriteLittleEndian(archive.data() + sizeof(kMagic), 4, ordered.size());
+
+  uint8_t* index_entry = archive.data() + kHeaderSize;
+  size_t name_offset = names_offset;
+  for (size_t i = 0; i < ordered.size(); i++) {
+    const Asset* asset = ordered[i];
+    size_t size = asset->contents ? asset->contents->GetSize() : 0;
+    WriteLittleEndian(index_entry, 8, contents_offsets[i]);
+    WriteLittleEndian(index_entry + 8, 8, size);
+    WriteLittleEndian(index_entry + 16, 4, name_offset);
+    WriteLittleEndian(index_entry + 20, 2, asset->name.size());
+    WriteLittleEndian(index_entry + 22, 2,
+                      asset->needed_at_startup ? kNeededAtStartupFlag : 0);
+    index_entry += kIndexEntrySize;
+
+    memcpy(archive.data() + name_offset, asset->name.data(),
+           asset->name.size());
+    name_offset += asset->name.size();
+
+    if (size > 0) {
+      memcpy(archive.data() + contents_offsets[i],
+             asset->contents->GetMapping(), size);
+    }
+  }
+
+  return std::make_unique<fml::DataMapping>(std::move(archive));
+}
+
+PackedAssetBundle::PackedAssetBundle(const fml::UniqueFD& archive,
+                                     bool is_valid_after_asset_manager_change)
+    : archive_(std::make_shared<fml::FileMapping>(archive)) {
+  TRACE_EVENT0("flutter", "PackedAssetBundle::PackedAssetBundle");
+  std::vector<Entry> startup_entries;
+  if (!archive_->IsValid() || !ReadIndex(&startup_entries)) {
+    FML_LOG(ERROR) << "Could not read the packed asset archive.";
+    entries_.clear();
+    return;
+  }
+  is_valid_after_asset_manager_change_ = is_valid_after_asset_manager_change;
+  is_valid_ = true;
+  PrefetchEntries(std::move(startup_entries));
+}
+
+PackedAssetBundle::~PackedAssetBundle() = default;
+
+bool PackedAssetBundle::ReadIndex(std::vector<Entry>* startup_entries) {
+  const uint8_t* data = archive_->GetMapping();
+  const size_t size = archive_->GetSize();
+  if (data == nullptr || size < kHeaderSize ||
+      memcmp(data, kMagic, sizeof(kMagic)) != 0) {
+    return false;
+  }
+
+  const uint64_t count = ReadLittleEndian(data + sizeof(kMagic), 4);
+  if (count > (size - kHeaderSize) / kIndexEntrySize) {
+    return false;
+  }
+
+  entries_.reserve(static_cast<size_t>(count));
+  const uint8_t* index_entry = data + kHeaderSize;
+  for (uint64_t i = 0; i < count; i++, index_entry += kIndexEntrySize) {
+    const uint64_t offset = ReadLittleEndian(index_entry, 8);
+    const uint64_t contents_size = ReadLittleEndian(index_entry + 8, 8);
+    const uint64_t name_offset = ReadLittleEndian(index_entry + 16, 4);
+    const uint64_t name_size = ReadLittleEndian(index_entry + 20, 2);
+    const uint64_t flags = ReadLittleEndian(index_entry + 22, 2);
+    if (offset > size || contents_size > size - offset ||
+        name_offset > size || name_size > size - name_offset) {
+      return false;
+    }
+
+    Entry entry{static_cast<size_t>(offset),
+                static_cast<size_t>(contents_size)};
+    std::string name(reinterpret_cast<const char*>(data + name_offset),
+                     static_cast<size_t>(name_size));
+    if (!entries_.emplace(std::move(name), entry).second) {
+      return false;
+    }
+    if (flags & kNeededAtStartupFlag) {
+      startup_entries->push_back(entry);
+    }
+  }
+  return true;
+}
+
+void PackedAssetBundle::Prefetch(
+    const std::vector<std::string>& asset_names) const {
+  std::vector<Entry> entries;
+  entries.reserve(asset_names.size());
+  for (const std::string& name : asset_names) {
+    auto found = entries_.find(name);
+    if (found != entries_.end()) {
+      entries.push_back(found->second);
+    }
+  }
+  PrefetchEntries(std::move(entries));
+}
+
+void PackedAssetBundle::PrefetchEntries(std::vector<Entry> entries) const {
+  if (!is_valid_ || entries.empty()) {
+    return;
+  }
+  TRACE_EVENT0("flutter", "PackedAssetBundle::Prefetch");
+
+  // Assets packed next to each other are only separated by their padding, so
+  // most manifests turn into a handful of ranges.
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& a, const Entry& b) { return a.offset < b.offset; });
+  size_t start = entries.front().offset;
+  size_t end = start + entries.front().size;
+  for (const Entry& entry : entries) {
+    if (entry.offset > AlignUp(end, kAlignment)) {
+      archive_->WillNeed(start, end - start);
+      start = entry.offset;
+    }
+    end = std::max(end, entry.offset + entry.size);
+  }
+  archive_->WillNeed(start, end - start);
+}
+
+std::unique_ptr<fml::Mapping> PackedAssetBundle::MapEntry(
+    const Entry& entry) const {
+  // Like |DirectoryAssetBundle|, empty assets resolve to no mapping.
+  if (entry.size == 0) {
+    return nullptr;
+  }
+  // The mapping keeps the archive mapped for as long as it is alive.
+  return std::make_unique<fml::NonOwnedMapping>(
+      archive_->GetMapping() + entry.offset, entry.size,
+      [archive = archive_](const uint8_t* data, size_t size) {},
+      archive_->IsDontNeedSafe());
+}
+
+// |AssetResolver|
+bool PackedAssetBundle::IsValid() const {
+  return is_valid_;
+}
+
+// |AssetResolver|
+bool PackedAssetBundle::IsValidAfterAssetManagerChange() const {
+  return is_valid_after_asset_manager_change_;
+}
+
+// |AssetResolver|
+AssetResolver::AssetResolverType PackedAssetBundle::GetType() const {
+  return AssetResolver::AssetResolverType::kPackedAssetBundle;
+}
+
+// |AssetResolver|
+std::unique_ptr<fml::Mapping> PackedAssetBundle::GetAsMapping(
+    const std::string& asset_name) const {
+  if (!is_valid_) {
+    FML_DLOG(WARNING) << "Asset bundle was not valid.";
+    return nullptr;
+  }
+
+  auto found = entries_.find(asset_name);
+  if (found == entries_.end()) {
+    return nullptr;
+  }
+  return MapEntry(found->second);
+}
+
+// |AssetResolver|
+std::vector<std::unique_ptr<fml::Mapping>> PackedAssetBundle::GetAsMappings(
+    const std::string& asset_pattern,
+    const std::optional<std::string>& subdir) const {
+  std::vector<std::unique_ptr<fml::Mapping>> mappings;
+  if (!is_valid_) {
+    FML_DLOG(WARNING) << "Asset bundle was not valid.";
+    return mappings;
+  }
+
+  // Like |DirectoryAssetBundle|, match the pattern against file names, either
+  // anywhere in the archive or directly in |subdir|.
+  std::regex asset_regex(asset_pattern);
+  const std::string prefix = subdir ? subdir.value() + "/" : "";
+  for (const auto& [name, entry] : entries_) {
+    if (name.compare(0, prefix.size(), prefix) != 0) {
+      continue;
+    }
+    const size_t separator = name.rfind('/');
+    if (subdir && separator != prefix.size() - 1) {
+      continue;
+    }
+    const std::string filename =
+        separator == std::string::npos ? name : name.substr(separator + 1);
+    if (!std::regex_match(filename, asset_regex)) {
+      continue;
+    }
+    if (auto mapping = MapEntry(entry)) {
+      mappings.push_back(std::move(mapping));
+    }
+  }
+  return mappings;
+}
+
+// |AssetResolver|
+bool PackedAssetBundle::operator==(const AssetResolver& other) const {
+  auto other_bundle = other.as_packed_asset_bundle();
+  if (!other_bundle) {
+    return false;
+  }
+  return is_valid_after_asset_manager_change_ ==
+             other_bundle->is_valid_after_asset_manager_change_ &&
+         archive_ == other_bundle->archive_;
+}
+
+}  // namespace flutter
@@ -0,0 +1,141 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_ASSETS_PACKED_ASSET_BUNDLE_H_
+#define FLUTTER_ASSETS_PACKED_ASSET_BUNDLE_H_
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "flutter/assets/asset_resolver.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/mapping.h"
+#include "flutter/fml/unique_fd.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      Resolves assets from an archive that packs all of them into a
+///             single file.
+///
+///             The archive is mapped once when the bundle is created, and
+///             assets are returned as mappings of ranges of it, so resolving
+///             an asset takes no system calls. The archive is laid out as:
+///
+///             * A header with the magic `FLTPACK1` and the number of assets.
+///             * An index with the offset, size, name and flags of each asset.
+///             * The names of the assets.
+///             * The contents of the assets, each aligned to |kAlignment|.
+///
+///             All integers are stored in little endian.
+///
+///             Assets that are needed during startup are flagged in the index
+///             and packed next to each other. The bundle asks the OS to read
+///             them ahead as soon as it is created.
+///
+///             Like with a |DirectoryAssetBundle|, empty assets resolve to no
+///             mapping.
+///
+///             Embedders opt in by running the `asset_packer` host tool over
+///             the assets directory of an AOT build and writing its output
+///             there as |kArchiveFileName|; the loose files may then be left
+///             out of the app. The tool reads the names of the assets needed
+///             at startup from an optional manifest with one name per line.
+///
+class PackedAssetBundle : public AssetResolver {
+ public:
+  /// The name of the archive in the assets directory.
+  static constexpr char kArchiveFileName[] = "assets.flutterpack";
+
+  /// The alignment of the contents of the assets in the archive.
+  static constexpr size_t kAlignment = 16;
+
+  /// An asset to pack into an archive.
+  struct Asset {
+    std::string name;
+    std::unique_ptr<fml::Mapping> contents;
+    /// Whether the asset is listed in the startup manifest, and so read ahead
+    /// when the bundle is created.
+    bool needed_at_startup = false;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Packs assets into an archive, with the assets needed at
+  ///             startup first.
+  ///
+  /// @return     The archive, or nullptr if the names of the assets are not
+  ///             unique or the assets are too large to be packed.
+  ///
+  static std::unique_ptr<fml::Mapping> Pack(const std::vector<Asset>& assets);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Maps the archive opened as |archive| and reads its index. The
+  ///             descriptor is not needed afterwards.
+  ///
+  PackedAssetBundle(const fml::UniqueFD& archive,
+                    bool is_valid_after_asset_manager_change);
+
+  ~PackedAssetBundle() override;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Asks the OS to read the named assets ahead, so that they
+  ///             aren't faulted in page by page when they are first used.
+  ///             Unknown names are ignored.
+  ///
+  void Prefetch(const std::vector<std::string>& asset_names) const;
+
+  size_t GetAssetCount() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    size_t offset = 0;
+    size_t size = 0;
+  };
+
+  std::shared_ptr<fml::FileMapping> archive_;
+  std::unordered_map<std::string, Entry> entries_;
+  bool is_valid_ = false;
+  bool is_valid_after_asset_manager_change_ = false;
+
+  bool ReadIndex(std::vector<Entry>* startup_entries);
+
+  void PrefetchEntries(std::vector<Entry> entries) const;
+
+  std::unique_ptr<fml::Mapping> MapEntry(const Entry& entry) const;
+
+  // |AssetResolver|
+  bool IsValid() const override;
+
+  // |AssetResolver|
+  bool IsValidAfterAssetManagerChange() const override;
+
+  // |AssetResolver|
+  AssetResolver::AssetResolverType GetType() const override;
+
+  // |AssetResolver|
+  std::unique_ptr<fml::Mapping> GetAsMapping(
+      const std::string& asset_name) const override;
+
+  // |AssetResolver|
+  std::vector<std::unique_ptr<fml::Mapping>> GetAsMappings(
+      const std::string& asset_pattern,
+      const std::optional<std::string>& subdir) const override;
+
+  // |AssetResolver|
+  bool operator==(const AssetResolver& other) const override;
+
+  // |AssetResolver|
+  const PackedAssetBundle* as_packed_asset_bundle() const override {
+    return this;
+  }
+
+  FML_DISALLOW_COPY_AND_ASSIGN(PackedAssetBundle);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_ASSETS_PACKED_ASSET_BUNDLE_H_
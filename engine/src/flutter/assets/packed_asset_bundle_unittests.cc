@@ -0,0 +1,155 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/assets/packed_asset_bundle.h"
+
+#include "flutter/assets/asset_manager.h"
+#include "flutter/fml/file.h"
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+PackedAssetBundle::Asset MakeAsset(const std::string& name,
+                                   const std::string& contents,
+                                   bool needed_at_startup = false) {
+  return {name, std::make_unique<fml::DataMapping>(contents),
+          needed_at_startup};
+}
+
+std::string ToString(const fml::Mapping& mapping) {
+  return std::string(reinterpret_cast<const char*>(mapping.GetMapping()),
+                     mapping.GetSize());
+}
+
+std::unique_ptr<PackedAssetBundle> WriteAndOpen(
+    const fml::UniqueFD& dir,
+    const std::vector<PackedAssetBundle::Asset>& assets) {
+  auto archive = PackedAssetBundle::Pack(assets);
+  if (!archive || !fml::WriteAtomically(
+                      dir, PackedAssetBundle::kArchiveFileName, *archive)) {
+    return nullptr;
+  }
+  return std::make_unique<PackedAssetBundle>(
+      fml::OpenFileReadOnly(dir, PackedAssetBundle::kArchiveFileName), false);
+}
+
+}  // namespace
+
+TEST(PackedAssetBundleTest, ResolvesPackedAssets) {
+  fml::ScopedTemporaryDirectory dir;
+  std::vector<PackedAssetBundle::Asset> assets;
+  assets.push_back(MakeAsset("AssetManifest.bin", "manifest", true));
+  assets.push_back(MakeAsset("fonts/Roboto.ttf", "roboto"));
+  assets.push_back(MakeAsset("images/empty.png", ""));
+  assets.push_back(MakeAsset("shaders/ink_sparkle.frag", "sparkle", true));
+  auto bundle = WriteAndOpen(dir.fd(), assets);
+  ASSERT_TRUE(bundle);
+  ASSERT_EQ(bundle->GetAssetCount(), 4u);
+
+  AssetManager manager;
+  manager.PushBack(std::move(bundle));
+  for (const PackedAssetBundle::Asset& asset : assets) {
+    auto mapping = manager.GetAsMapping(asset.name);
+    if (asset.contents->GetSize() == 0) {
+      // Like in a |DirectoryAssetBundle|, empty assets have no mapping.
+      EXPECT_FALSE(mapping) << asset.name;
+      continue;
+    }
+    ASSERT_TRUE(mapping) << asset.name;
+    EXPECT_EQ(ToString(*mapping), ToString(*asset.contents));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(mapping->GetMapping()) %
+                  PackedAssetBundle::kAlignment,
+              0u);
+  }
+  EXPECT_FALSE(manager.GetAsMapping("missing"));
+}
+
+TEST(PackedAssetBundleTest, MappingsOutliveTheBundle) {
+  fml::ScopedTemporaryDirectory dir;
+  std::vector<PackedAssetBundle::Asset> assets;
+  assets.push_back(MakeAsset("a", "contents of a"));
+  std::unique_ptr<fml::Mapping> mapping;
+  {
+    AssetManager manager;
+    manager.PushBack(WriteAndOpen(dir.fd(), assets));
+    mapping = manager.GetAsMapping("a");
+  }
+  ASSERT_TRUE(mapping);
+  EXPECT_EQ(ToString(*mapping), "contents of a");
+}
+
+TEST(PackedAssetBundleTest, MatchesFileNamesInSubdirectories) {
+  fml::ScopedTemporaryDirectory dir;
+  std::vector<PackedAssetBundle::Asset> assets;
+  assets.push_back(MakeAsset("fonts/a.ttf", "a"));
+  assets.push_back(MakeAsset("fonts/b.ttf", "b"));
+  assets.push_back(MakeAsset("fonts/extra/c.ttf", "c"));
+  assets.push_back(MakeAsset("d.ttf", "d"));
+  assets.push_back(MakeAsset("fonts/e.otf", "e"));
+
+  AssetManager manager;
+  manager.PushBack(WriteAndOpen(dir.fd(), assets));
+  EXPECT_EQ(manager.GetAsMappings(".*\\.ttf", std::nullopt).size(), 4u);
+  EXPECT_EQ(manager.GetAsMappings(".*\\.ttf", "fonts").size(), 2u);
+  EXPECT_EQ(manager.GetAsMappings(".*", "fonts/extra").size(), 1u);
+  EXPECT_EQ(manager.GetAsMappings(".*", "missing").size(), 0u);
+}
+
+TEST(PackedAssetBundleTest, PrefetchIgnoresUnknownAssets) {
+  fml::ScopedTemporaryDirectory dir;
+  std::vector<PackedAssetBundle::Asset> assets;
+  assets.push_back(MakeAsset("a", std::string(10000, 'a'), true));
+  assets.push_back(MakeAsset("b", std::string(10000, 'b')));
+  auto bundle = WriteAndOpen(dir.fd(), assets);
+  ASSERT_TRUE(bundle);
+  bundle->Prefetch({"b", "missing", "a"});
+  bundle->Prefetch({});
+
+  AssetManager manager;
+  manager.PushBack(std::move(bundle));
+  auto mapping = manager.GetAsMapping("b");
+  ASSERT_TRUE(mapping);
+  EXPECT_EQ(ToString(*mapping), std::string(10000, 'b'));
+}
+
+TEST(PackedAssetBundleTest, RejectsDuplicateNames) {
+  std::vector<PackedAssetBundle::Asset> assets;
+  assets.push_back(MakeAsset("a", "1"));
+  assets.push_back(MakeAsset("a", "2"));
+  EXPECT_FALSE(PackedAssetBundle::Pack(assets));
+}
+
+TEST(PackedAssetBundleTest, RejectsCorruptArchives) {
+  fml::ScopedTemporaryDirectory dir;
+  std::vector<PackedAssetBundle::Asset> assets;
+  assets.push_back(MakeAsset("a", "contents of a"));
+  auto archive = PackedAssetBundle::Pack(assets);
+  ASSERT_TRUE(archive);
+
+  // Point the contents of the only asset past the end of the archive.
+  std::vector<uint8_t> corrupt(archive->GetMapping(),
+                               archive->GetMapping() + archive->GetSize());
+  corrupt[16] = 0xFF;
+  corrupt[17] = 0xFF;
+  ASSERT_TRUE(fml::WriteAtomically(dir.fd(), "corrupt",
+                                   fml::DataMapping(std::move(corrupt))));
+
+  // Truncate the index.
+  ASSERT_TRUE(fml::WriteAtomically(
+      dir.fd(), "truncated",
+      fml::NonOwnedMapping(archive->GetMapping(), 20)));
+
+  for (const char* name : {"corrupt", "truncated"}) {
+    AssetManager manager;
+    EXPECT_FALSE(manager.PushBack(std::make_unique<PackedAssetBundle>(
+        fml::OpenFileReadOnly(dir.fd(), name), false)))
+        << name;
+  }
+}
+
+}  // namespace testing
+}  // namespace flutter
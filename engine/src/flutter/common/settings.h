@@ -30,6 +30,26 @@ enum class AndroidRenderingAPI {
   kSkiaOpenGLES
 };
 
+// The steps of producing frames whose durations are recorded by the
+// |FramePhaseProfiler|.
+enum class FramePhase : uint32_t {
+  // Acquiring the surface frame to render into.
+  kAcquireFrame,
+  // Prerolling the layer tree.
+  kPreroll,
+  // Rendering layers and display lists into the raster cache.
+  kRasterCache,
+  // Painting the layer tree into the frame's canvas. With Impeller, this
+  // includes converting display lists into Impeller commands.
+  kPaint,
+  // Submitting the frame, which includes encoding the command buffers and
+  // presenting the surface.
+  kSubmit,
+  // Uploading decoded images to the GPU. Not part of any frame.
+  kImageUpload,
+  kCount,
+};
+
 class FrameTiming {
  public:
   enum Phase {
@@ -69,8 +89,17 @@ class FrameTiming {
     picture_cache_bytes_ = picture_cache_bytes;
   }
 
+  /// The time spent in |phase| while rasterizing this frame.
+  fml::TimeDelta GetPhaseDuration(FramePhase phase) const {
+    return phase_durations_[static_cast<size_t>(phase)];
+  }
+  void SetPhaseDuration(FramePhase phase, fml::TimeDelta duration) {
+    phase_durations_[static_cast<size_t>(phase)] = duration;
+  }
+
  private:
   fml::TimePoint data_[kCount];
+  fml::TimeDelta phase_durations_[static_cast<size_t>(FramePhase::kCount)];
   uint64_t frame_number_;
   size_t layer_cache_count_;
   size_t layer_cache_bytes_;
@@ -218,6 +247,11 @@ struct Settings {
   // manager before creating the engine.
   bool prefetched_default_font_manager = false;
 
+  // Overlap the independent steps of starting the engine, like setting up the
+  // default font manager and the asset manager, with the creation of the
+  // shell's subsystems. Steps that depend on them wait for them explicitly.
+  bool enable_parallel_startup = false;
+
   // Enable the rendering of colors outside of the sRGB gamut.
   bool enable_wide_gamut = false;
 
@@ -257,6 +291,21 @@ struct Settings {
   // Enable GPU tracing in Vulkan backends.
   bool enable_vulkan_gpu_tracing = false;
 
+  // Decode eligible JPEGs to their Y and UV planes and convert them to RGB on
+  // the GPU when uploading, instead of converting on the CPU. Only applies to
+  // the Impeller Metal and Vulkan backends.
+  bool enable_impeller_yuv_image_decoding = false;
+
+  // Generate mip chains for images without mips the first time Impeller draws
+  // them minified by more than 2x with mipmap sampling, instead of sampling
+  // the full resolution texture.
+  bool enable_impeller_lazy_mipmaps = false;
+
+  // Merge the pointer moves that arrive while the UI thread is still handling
+  // the input of the current frame, so that high rate touch and stylus input
+  // is delivered to the framework at most once per frame and pointer.
+  bool coalesce_pointer_events = false;
+
   // Data set by platform-specific embedders for use in font initialization.
   uint32_t font_initialization_data = 0;
 
@@ -353,6 +402,11 @@ struct Settings {
   // Max bytes threshold of resource cache, or 0 for unlimited.
   size_t resource_cache_max_bytes_threshold = 0;
 
+  // Max bytes of decoded images retained by the engine for reuse when a codec
+  // is instantiated again for the same encoded data and target size, or 0 to
+  // disable the cache. The cache is purged on low memory warnings.
+  size_t decoded_image_cache_max_bytes = 0;
+
   /// Enable embedder api on the embedder.
   ///
   /// This is currently only used by iOS.
@@ -0,0 +1,181 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/frame_phase_profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+namespace {
+
+constexpr size_t kPhaseCount = static_cast<size_t>(FramePhase::kCount);
+
+// A sample packs its phase into the top bits and its duration in nanoseconds
+// into the remaining bits, so that it is written and read with one atomic
+// operation and readers never see half of a sample.
+constexpr int kPhaseShift = 56;
+constexpr uint64_t kDurationMask = (uint64_t{1} << kPhaseShift) - 1;
+
+uint64_t PackSample(FramePhase phase, fml::TimeDelta duration) {
+  uint64_t nanoseconds = std::max<int64_t>(duration.ToNanoseconds(), 0);
+  return (static_cast<uint64_t>(phase) << kPhaseShift) |
+         std::min(nanoseconds, kDurationMask);
+}
+
+// Returns the |percentile| of the |sorted| durations, using the nearest-rank
+// method.
+fml::TimeDelta Percentile(const std::vector<int64_t>& sorted,
+                          double percentile) {
+  size_t rank = static_cast<size_t>(std::ceil(percentile * sorted.size()));
+  return fml::TimeDelta::FromNanoseconds(
+      sorted[std::max<size_t>(rank, 1) - 1]);
+}
+
+}  // namespace
+
+struct FramePhaseProfiler::Ring {
+  std::array<std::atomic<uint64_t>, kSamplesPerThread> samples = {};
+
+  // The number of samples ever recorded. Only written by the owning thread.
+  std::atomic<uint64_t> sample_count = {0};
+
+  // The durations summed up for the current frame. Only accessed by the owning
+  // thread.
+  std::array<fml::TimeDelta, kPhaseCount> frame_durations = {};
+};
+
+namespace {
+
+thread_local FramePhaseProfiler* tls_current_profiler = nullptr;
+
+// The rings of the profilers the calling thread last recorded into, most
+// recently used first, so that recording does not look up the ring in the
+// common case. Engines that share a thread each have a profiler, so more than
+// one is remembered.
+struct ThreadRingCacheEntry {
+  uint64_t profiler_id = 0;
+  void* ring = nullptr;
+};
+constexpr size_t kThreadRingCacheSize = 4;
+thread_local std::array<ThreadRingCacheEntry, kThreadRingCacheSize>
+    tls_ring_cache;
+
+std::atomic<uint64_t> next_profiler_id = {1};
+
+}  // namespace
+
+FramePhaseProfiler::ScopedCurrent::ScopedCurrent(FramePhaseProfiler* profiler)
+    : previous_(tls_current_profiler) {
+  tls_current_profiler = profiler;
+}
+
+FramePhaseProfiler::ScopedCurrent::~ScopedCurrent() {
+  tls_current_profiler = previous_;
+}
+
+FramePhaseProfiler::FramePhaseProfiler() : id_(next_profiler_id++) {}
+
+FramePhaseProfiler::~FramePhaseProfiler() = default;
+
+FramePhaseProfiler* FramePhaseProfiler::Current() {
+  return tls_current_profiler;
+}
+
+void FramePhaseProfiler::Record(FramePhase phase, fml::TimeDelta duration) {
+  FML_DCHECK(phase < FramePhase::kCount);
+  Ring& ring = GetThreadRing();
+  uint64_t count = ring.sample_count.load(std::memory_order_relaxed);
+  ring.samples[count % kSamplesPerThread].store(PackSample(phase, duration),
+                                                std::memory_order_relaxed);
+  ring.sample_count.store(count + 1, std::memory_order_release);
+
+  fml::TimeDelta& frame_duration =
+      ring.frame_durations[static_cast<size_t>(phase)];
+  frame_duration = frame_duration + duration;
+}
+
+FramePhaseProfiler::Summary FramePhaseProfiler::Summarize(
+    FramePhase phase) const {
+  std::vector<int64_t> durations;
+  {
+    std::scoped_lock lock(rings_mutex_);
+    for (const auto& [thread_id, ring] : rings_) {
+      uint64_t count = ring->sample_count.load(std::memory_order_acquire);
+      uint64_t first = count - std::min<uint64_t>(count, kSamplesPerThread);
+      for (uint64_t i = first; i < count; i++) {
+        uint64_t sample = ring->samples[i % kSamplesPerThread].load(
+            std::memory_order_relaxed);
+        if ((sample >> kPhaseShift) == static_cast<uint64_t>(phase)) {
+          durations.push_back(sample & kDurationMask);
+        }
+      }
+    }
+  }
+
+  Summary summary;
+  summary.sample_count = durations.size();
+  if (durations.empty()) {
+    return summary;
+  }
+  std::sort(durations.begin(), durations.end());
+  summary.p50 = Percentile(durations, 0.5);
+  summary.p90 = Percentile(durations, 0.9);
+  summary.p99 = Percentile(durations, 0.99);
+  summary.max = fml::TimeDelta::FromNanoseconds(durations.back());
+  return summary;
+}
+
+void FramePhaseProfiler::BeginFrame() {
+  GetThreadRing().frame_durations.fill(fml::TimeDelta::Zero());
+}
+
+void FramePhaseProfiler::EndFrame(FrameTiming& timing) {
+  const Ring& ring = GetThreadRing();
+  for (size_t i = 0; i < kPhaseCount; i++) {
+    timing.SetPhaseDuration(static_cast<FramePhase>(i),
+                            ring.frame_durations[i]);
+  }
+}
+
+void FramePhaseProfiler::Reset() {
+  std::scoped_lock lock(rings_mutex_);
+  for (const auto& [thread_id, ring] : rings_) {
+    ring->sample_count.store(0, std::memory_order_relaxed);
+  }
+}
+
+FramePhaseProfiler::Ring& FramePhaseProfiler::GetThreadRing() {
+  auto cache_begin = tls_ring_cache.begin();
+  for (auto entry = cache_begin; entry != tls_ring_cache.end(); ++entry) {
+    if (entry->profiler_id == id_) {
+      std::rotate(cache_begin, entry, entry + 1);
+      return *static_cast<Ring*>(tls_ring_cache.front().ring);
+    }
+  }
+
+  std::scoped_lock lock(rings_mutex_);
+  ring_lookup_count_++;
+  std::unique_ptr<Ring>& ring = rings_[std::this_thread::get_id()];
+  if (!ring) {
+    ring = std::make_unique<Ring>();
+  }
+  // Replace the least recently used entry.
+  std::rotate(cache_begin, tls_ring_cache.end() - 1, tls_ring_cache.end());
+  tls_ring_cache.front() = {.profiler_id = id_, .ring = ring.get()};
+  return *ring;
+}
+
+size_t FramePhaseProfiler::GetRingLookupCountForTest() const {
+  std::scoped_lock lock(rings_mutex_);
+  return ring_lookup_count_;
+}
+
+}  // namespace flutter
@@ -0,0 +1,138 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_FLOW_FRAME_PHASE_PROFILER_H_
+#define FLUTTER_FLOW_FRAME_PHASE_PROFILER_H_
+
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "flutter/common/settings.h"
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_delta.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+/// Records the durations of the |FramePhase|s of rendering, cheaply enough to
+/// stay enabled without tracing.
+///
+/// Each shell owns a profiler. Code that runs on behalf of a shell, like its
+/// rasterizer drawing a frame, makes the shell's profiler current on its
+/// thread with |ScopedCurrent|, and |ScopedPhase|s record into the current
+/// profiler, if any.
+///
+/// Each thread records into its own fixed-size ring of recent samples. Writing
+/// a sample takes no locks and, after the first sample of a profiler on a
+/// thread, does not allocate. Readers summarize the rings of all threads into
+/// percentiles.
+///
+/// The phases recorded on a thread between |BeginFrame| and |EndFrame| are
+/// also summed up per frame, which is how they end up in |FrameTiming|.
+class FramePhaseProfiler {
+ public:
+  /// The number of most recent samples kept for each thread.
+  static constexpr size_t kSamplesPerThread = 1024;
+
+  /// Percentiles of the recent durations of a phase.
+  struct Summary {
+    size_t sample_count = 0;
+    fml::TimeDelta p50;
+    fml::TimeDelta p90;
+    fml::TimeDelta p99;
+    fml::TimeDelta max;
+  };
+
+  /// Makes |profiler| the current profiler of the calling thread until
+  /// destroyed. |profiler| may be null, in which case no samples are recorded.
+  class ScopedCurrent {
+   public:
+    explicit ScopedCurrent(FramePhaseProfiler* profiler);
+
+    ~ScopedCurrent();
+
+   private:
+    FramePhaseProfiler* const previous_;
+
+    FML_DISALLOW_COPY_AND_ASSIGN(ScopedCurrent);
+  };
+
+  /// Records the time from its construction to its destruction as a sample
+  /// of |phase| in the current profiler of the calling thread, if any.
+  class ScopedPhase {
+   public:
+    explicit ScopedPhase(FramePhase phase)
+        : profiler_(Current()),
+          phase_(phase),
+          start_(profiler_ ? fml::TimePoint::Now() : fml::TimePoint()) {}
+
+    ~ScopedPhase() {
+      if (profiler_) {
+        profiler_->Record(phase_, fml::TimePoint::Now() - start_);
+      }
+    }
+
+   private:
+    FramePhaseProfiler* const profiler_;
+    const FramePhase phase_;
+    const fml::TimePoint start_;
+
+    FML_DISALLOW_COPY_AND_ASSIGN(ScopedPhase);
+  };
+
+  FramePhaseProfiler();
+
+  ~FramePhaseProfiler();
+
+  /// The profiler made current on the calling thread by a |ScopedCurrent|, or
+  /// null.
+  static FramePhaseProfiler* Current();
+
+  /// Records a sample of |phase| on the calling thread.
+  void Record(FramePhase phase, fml::TimeDelta duration);
+
+  /// Summarizes the recent samples of |phase| recorded on all threads.
+  ///
+  /// Can be called from any thread. Samples recorded while summarizing may or
+  /// may not be included.
+  Summary Summarize(FramePhase phase) const;
+
+  /// Starts summing up the phases recorded on the calling thread for a frame.
+  void BeginFrame();
+
+  /// Sets the phase durations of |timing| to the sums of the phases recorded
+  /// on the calling thread since |BeginFrame|.
+  void EndFrame(FrameTiming& timing);
+
+  /// Discards the samples of all threads. Must not be called while other
+  /// threads record samples. Exposed for testing.
+  void Reset();
+
+  /// The number of times a thread had to look up its ring under the lock
+  /// instead of finding it in its per-thread cache. Exposed for testing.
+  size_t GetRingLookupCountForTest() const;
+
+ private:
+  struct Ring;
+
+  // Distinguishes this profiler from profilers previously allocated at the
+  // same address in the per-thread ring cache.
+  const uint64_t id_;
+
+  // Guards |rings_|. The rings themselves are only written by their threads.
+  mutable std::mutex rings_mutex_;
+  std::unordered_map<std::thread::id, std::unique_ptr<Ring>> rings_;
+  size_t ring_lookup_count_ = 0;
+
+  // Returns the ring of the calling thread, creating it on first use.
+  Ring& GetThreadRing();
+
+  FML_DISALLOW_COPY_AND_ASSIGN(FramePhaseProfiler);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_FLOW_FRAME_PHASE_PROFILER_H_
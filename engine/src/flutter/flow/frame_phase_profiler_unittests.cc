@@ -0,0 +1,148 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/flow/frame_phase_profiler.h"
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+fml::TimeDelta Millis(int64_t millis) {
+  return fml::TimeDelta::FromMilliseconds(millis);
+}
+
+}  // namespace
+
+TEST(FramePhaseProfilerTest, SummaryWithoutSamples) {
+  FramePhaseProfiler profiler;
+  FramePhaseProfiler::Summary summary =
+      profiler.Summarize(FramePhase::kPreroll);
+  EXPECT_EQ(summary.sample_count, 0u);
+  EXPECT_EQ(summary.max, fml::TimeDelta::Zero());
+}
+
+TEST(FramePhaseProfilerTest, SummarizesPercentiles) {
+  FramePhaseProfiler profiler;
+  for (int64_t i = 100; i >= 1; i--) {
+    profiler.Record(FramePhase::kPaint, Millis(i));
+    profiler.Record(FramePhase::kSubmit, Millis(1000));
+  }
+  FramePhaseProfiler::Summary summary = profiler.Summarize(FramePhase::kPaint);
+  EXPECT_EQ(summary.sample_count, 100u);
+  EXPECT_EQ(summary.p50, Millis(50));
+  EXPECT_EQ(summary.p90, Millis(90));
+  EXPECT_EQ(summary.p99, Millis(99));
+  EXPECT_EQ(summary.max, Millis(100));
+}
+
+TEST(FramePhaseProfilerTest, KeepsMostRecentSamples) {
+  FramePhaseProfiler profiler;
+  for (size_t i = 0; i < FramePhaseProfiler::kSamplesPerThread; i++) {
+    profiler.Record(FramePhase::kPreroll, Millis(100));
+  }
+  for (size_t i = 0; i < FramePhaseProfiler::kSamplesPerThread; i++) {
+    profiler.Record(FramePhase::kPreroll, Millis(1));
+  }
+  FramePhaseProfiler::Summary summary =
+      profiler.Summarize(FramePhase::kPreroll);
+  EXPECT_EQ(summary.sample_count, FramePhaseProfiler::kSamplesPerThread);
+  EXPECT_EQ(summary.max, Millis(1));
+}
+
+TEST(FramePhaseProfilerTest, SummarizesSamplesOfAllThreads) {
+  FramePhaseProfiler profiler;
+  profiler.Record(FramePhase::kImageUpload, Millis(1));
+  std::thread thread([&profiler]() {
+    profiler.Record(FramePhase::kImageUpload, Millis(2));
+    FramePhaseProfiler::Summary summary =
+        profiler.Summarize(FramePhase::kImageUpload);
+    EXPECT_EQ(summary.sample_count, 2u);
+    EXPECT_EQ(summary.max, Millis(2));
+  });
+  thread.join();
+
+  // The samples of a thread are kept after it exits.
+  FramePhaseProfiler::Summary summary =
+      profiler.Summarize(FramePhase::kImageUpload);
+  EXPECT_EQ(summary.sample_count, 2u);
+
+  profiler.Reset();
+  EXPECT_EQ(profiler.Summarize(FramePhase::kImageUpload).sample_count, 0u);
+}
+
+TEST(FramePhaseProfilerTest, SumsPhasesOfFrame) {
+  FramePhaseProfiler profiler;
+  profiler.Record(FramePhase::kPaint, Millis(5));
+
+  profiler.BeginFrame();
+  profiler.Record(FramePhase::kPreroll, Millis(1));
+  profiler.Record(FramePhase::kPaint, Millis(2));
+  profiler.Record(FramePhase::kPaint, Millis(3));
+  FrameTiming timing;
+  profiler.EndFrame(timing);
+
+  EXPECT_EQ(timing.GetPhaseDuration(FramePhase::kAcquireFrame),
+            fml::TimeDelta::Zero());
+  EXPECT_EQ(timing.GetPhaseDuration(FramePhase::kPreroll), Millis(1));
+  EXPECT_EQ(timing.GetPhaseDuration(FramePhase::kPaint), Millis(5));
+}
+
+TEST(FramePhaseProfilerTest, ScopedPhaseRecordsIntoCurrentProfiler) {
+  FramePhaseProfiler profiler;
+  FramePhaseProfiler other_profiler;
+  {
+    FramePhaseProfiler::ScopedPhase phase(FramePhase::kAcquireFrame);
+  }
+  {
+    FramePhaseProfiler::ScopedCurrent current(&profiler);
+    EXPECT_EQ(FramePhaseProfiler::Current(), &profiler);
+    FramePhaseProfiler::ScopedPhase phase(FramePhase::kAcquireFrame);
+    {
+      FramePhaseProfiler::ScopedCurrent other_current(&other_profiler);
+      FramePhaseProfiler::ScopedPhase other_phase(FramePhase::kAcquireFrame);
+    }
+    EXPECT_EQ(FramePhaseProfiler::Current(), &profiler);
+  }
+  EXPECT_EQ(FramePhaseProfiler::Current(), nullptr);
+
+  EXPECT_EQ(profiler.Summarize(FramePhase::kAcquireFrame).sample_count, 1u);
+  EXPECT_EQ(other_profiler.Summarize(FramePhase::kAcquireFrame).sample_count,
+            1u);
+}
+
+TEST(FramePhaseProfilerTest, ProfilersDoNotShareSamples) {
+  FramePhaseProfiler first;
+  FramePhaseProfiler second;
+  first.Record(FramePhase::kPaint, Millis(1));
+  second.Record(FramePhase::kPaint, Millis(2));
+  first.Record(FramePhase::kPaint, Millis(3));
+
+  EXPECT_EQ(first.Summarize(FramePhase::kPaint).sample_count, 2u);
+  EXPECT_EQ(first.Summarize(FramePhase::kPaint).max, Millis(3));
+  EXPECT_EQ(second.Summarize(FramePhase::kPaint).sample_count, 1u);
+  EXPECT_EQ(second.Summarize(FramePhase::kPaint).max, Millis(2));
+}
+
+TEST(FramePhaseProfilerTest, ProfilersSharingAThreadKeepTheirCachedRings) {
+  // As when several engines share a raster thread.
+  FramePhaseProfiler first;
+  FramePhaseProfiler second;
+  for (int i = 0; i < 10; i++) {
+    first.Record(FramePhase::kPaint, Millis(1));
+    second.Record(FramePhase::kPaint, Millis(1));
+  }
+
+  EXPECT_EQ(first.GetRingLookupCountForTest(), 1u);
+  EXPECT_EQ(second.GetRingLookupCountForTest(), 1u);
+  EXPECT_EQ(first.Summarize(FramePhase::kPaint).sample_count, 10u);
+  EXPECT_EQ(second.Summarize(FramePhase::kPaint).sample_count, 10u);
+}
+
+}  // namespace testing
+}  // namespace flutter
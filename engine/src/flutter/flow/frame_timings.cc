@@ -8,6 +8,7 @@
 #include <string>
 
 #include "flutter/common/settings.h"
+#include "flutter/flow/frame_phase_profiler.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/time/time_point.h"
 
@@ -149,6 +150,9 @@ void FrameTimingsRecorder::RecordRasterStart(fml::TimePoint raster_start) {
   fml::Status status = RecordRasterStartImpl(raster_start);
   FML_DCHECK(status.ok());
   (void)status;
+  if (FramePhaseProfiler* profiler = FramePhaseProfiler::Current()) {
+    profiler->BeginFrame();
+  }
 }
 
 fml::Status FrameTimingsRecorder::RecordVsyncImpl(fml::TimePoint vsync_start,
@@ -227,6 +231,9 @@ FrameTiming FrameTimingsRecorder::RecordRasterEnd(const RasterCache* cache) {
   timing_.SetFrameNumber(GetFrameNumber());
   timing_.SetRasterCacheStatistics(layer_cache_count_, layer_cache_bytes_,
                                    picture_cache_count_, picture_cache_bytes_);
+  if (FramePhaseProfiler* profiler = FramePhaseProfiler::Current()) {
+    profiler->EndFrame(timing_);
+  }
   return timing_;
 }
 
@@ -6,6 +6,7 @@
 
 #include "flutter/display_list/skia/dl_sk_canvas.h"
 #include "flutter/flow/embedded_views.h"
+#include "flutter/flow/frame_phase_profiler.h"
 #include "flutter/flow/frame_timings.h"
 #include "flutter/flow/layers/layer.h"
 #include "flutter/flow/paint_utils.h"
@@ -29,6 +30,7 @@ bool LayerTree::Preroll(CompositorContext::ScopedFrame& frame,
                         bool ignore_raster_cache,
                         SkRect cull_rect) {
   TRACE_EVENT0("flutter", "LayerTree::Preroll");
+  FramePhaseProfiler::ScopedPhase phase(FramePhase::kPreroll);
 
   if (!root_layer_) {
     FML_LOG(ERROR) << "The scene did not specify any layers.";
@@ -134,12 +136,14 @@ void LayerTree::Paint(CompositorContext::ScopedFrame& frame,
 
 #if !SLIMPELLER
   if (cache) {
+    FramePhaseProfiler::ScopedPhase phase(FramePhase::kRasterCache);
     cache->EvictUnusedCacheEntries();
     TryToRasterCache(raster_cache_items_, &context, ignore_raster_cache);
   }
 #endif  //  !SLIMPELLER
 
   if (root_layer_->needs_painting(context)) {
+    FramePhaseProfiler::ScopedPhase phase(FramePhase::kPaint);
     root_layer_->Paint(context);
   }
 }
@@ -76,6 +76,16 @@ class FileMapping final : public Mapping {
 
   bool IsValid() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      Advises the OS that the bytes in [offset, offset + size) will
+  ///             be accessed soon, so that it can start reading them in
+  ///             instead of faulting them in page by page on first access.
+  ///
+  /// @return     Whether the advice was given. It is only a hint, so it may
+  ///             still be ignored, and it is not supported on all platforms.
+  ///
+  bool WillNeed(size_t offset, size_t size) const;
+
  private:
   bool valid_ = false;
   size_t size_ = 0;
@@ -3,6 +3,9 @@
 // found in the LICENSE file.
 
 #include "flutter/fml/mapping.h"
+
+#include "flutter/fml/build_config.h"
+#include "flutter/fml/file.h"
 #include "flutter/testing/testing.h"
 
 namespace fml {
@@ -67,4 +70,20 @@ TEST(MallocMapping, CopySizeZero) {
   ASSERT_EQ(0u, mapping.GetSize());
 }
 
+TEST(FileMapping, WillNeedChecksRange) {
+  ScopedTemporaryDirectory dir;
+  DataMapping data(std::vector<uint8_t>(10000, 0xAB));
+  ASSERT_TRUE(WriteAtomically(dir.fd(), "data", data));
+  auto mapping = FileMapping::CreateReadOnly(dir.fd(), "data");
+  ASSERT_TRUE(mapping);
+
+  EXPECT_FALSE(mapping->WillNeed(10000, 1));
+  EXPECT_FALSE(mapping->WillNeed(1, 10000));
+#if FML_OS_LINUX || FML_OS_ANDROID || FML_OS_MACOSX
+  EXPECT_TRUE(mapping->WillNeed(5000, 100));
+  EXPECT_TRUE(mapping->WillNeed(0, 10000));
+#endif
+  EXPECT_EQ(mapping->GetMapping()[9999], 0xAB);
+}
+
 }  // namespace fml
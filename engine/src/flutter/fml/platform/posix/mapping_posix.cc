@@ -107,4 +107,22 @@ bool FileMapping::IsValid() const {
   return valid_;
 }
 
+bool FileMapping::WillNeed(size_t offset, size_t size) const {
+  if (mapping_ == nullptr || offset > size_ || size > size_ - offset) {
+    return false;
+  }
+#if defined(MADV_WILLNEED)
+  // The mapping starts on a page boundary, so rounding the start of the range
+  // down to a page boundary keeps it within the mapping.
+  static const uintptr_t page_size = ::sysconf(_SC_PAGESIZE);
+  const uintptr_t start =
+      reinterpret_cast<uintptr_t>(mapping_ + offset) & ~(page_size - 1);
+  const uintptr_t end = reinterpret_cast<uintptr_t>(mapping_ + offset + size);
+  return ::madvise(reinterpret_cast<void*>(start), end - start,
+                   MADV_WILLNEED) == 0;
+#else
+  return false;
+#endif  // defined(MADV_WILLNEED)
+}
+
 }  // namespace fml
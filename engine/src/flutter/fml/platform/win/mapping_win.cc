@@ -123,4 +123,10 @@ bool FileMapping::IsValid() const {
   return valid_;
 }
 
+bool FileMapping::WillNeed(size_t offset, size_t size) const {
+  // Windows has no hint for ranges of file mappings that works on all the
+  // versions the engine supports.
+  return false;
+}
+
 }  // namespace fml
@@ -4,7 +4,6 @@
 
 #include "flutter/fml/trace_event.h"
 
-#include <algorithm>
 #include <atomic>
 #include <utility>
 
@@ -78,17 +77,9 @@ void TraceTimelineEvent(TraceArg category_group,
                         size_t flow_id_count,
                         const uint64_t* flow_ids,
                         Dart_Timeline_Event_Type type,
-                        const std::vector<const char*>& c_names,
-                        const std::vector<std::string>& values) {
-  const auto argument_count = std::min(c_names.size(), values.size());
-
-  std::vector<const char*> c_values;
-  c_values.resize(argument_count, nullptr);
-
-  for (size_t i = 0; i < argument_count; i++) {
-    c_values[i] = values[i].c_str();
-  }
-
+                        size_t argument_count,
+                        const char* const* names,
+                        const char* const* values) {
   FlutterTimelineEvent(
       name,                                        // label
       timestamp_micros,                            // timestamp0
@@ -97,8 +88,8 @@ void TraceTimelineEvent(TraceArg category_group,
       reinterpret_cast<const int64_t*>(flow_ids),  // flow_ids
       type,                                        // event type
       argument_count,                              // argument_count
-      const_cast<const char**>(c_names.data()),    // argument_names
-      c_values.data()                              // argument_values
+      const_cast<const char**>(names),             // argument_names
+      const_cast<const char**>(values)             // argument_values
   );
 }
 
@@ -108,8 +99,9 @@ void TraceTimelineEvent(TraceArg category_group,
                         size_t flow_id_count,
                         const uint64_t* flow_ids,
                         Dart_Timeline_Event_Type type,
-                        const std::vector<const char*>& c_names,
-                        const std::vector<std::string>& values) {
+                        size_t argument_count,
+                        const char* const* names,
+                        const char* const* values) {
   TraceTimelineEvent(category_group,                  // group
                      name,                            // name
                      gTimelineMicrosSource.load()(),  // timestamp_micros
@@ -117,7 +109,8 @@ void TraceTimelineEvent(TraceArg category_group,
                      flow_id_count,                   // flow_id_count
                      flow_ids,                        // flow_ids
                      type,                            // type
-                     c_names,                         // names
+                     argument_count,                  // argument_count
+                     names,                           // names
                      values                           // values
   );
 }
@@ -393,8 +386,9 @@ void TraceTimelineEvent(TraceArg category_group,
                         size_t flow_id_count,
                         const uint64_t* flow_ids,
                         Dart_Timeline_Event_Type type,
-                        const std::vector<const char*>& c_names,
-                        const std::vector<std::string>& values) {}
+                        size_t argument_count,
+                        const char* const* names,
+                        const char* const* values) {}
 
 void TraceTimelineEvent(TraceArg category_group,
                         TraceArg name,
@@ -402,8 +396,9 @@ void TraceTimelineEvent(TraceArg category_group,
                         size_t flow_id_count,
                         const uint64_t* flow_ids,
                         Dart_Timeline_Event_Type type,
-                        const std::vector<const char*>& c_names,
-                        const std::vector<std::string>& values) {}
+                        size_t argument_count,
+                        const char* const* names,
+                        const char* const* values) {}
 
 void TraceEvent0(TraceArg category_group,
                  TraceArg name,
@@ -53,6 +53,7 @@
 
 #endif  //  defined(OS_FUCHSIA)
 
+#include <charconv>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -196,15 +197,24 @@
 #define TRACE_FLOW_END(category, name, id) \
   ::fml::tracing::TraceEventFlowEnd0(category, name, id);
 
+// Numeric arguments are formatted into inline storage by |FML_TRACE_EVENT|,
+// without allocating.
+#define TRACE_EVENT2_INT(category_group, name, arg1_name, arg1_val, arg2_name, \
+                         arg2_val)                                             \
+  FML_TRACE_EVENT(category_group, name, arg1_name, arg1_val, arg2_name,        \
+                  arg2_val)
+
 #endif  // TRACE_EVENT_HIDE_MACROS
 #endif  // !defined(OS_FUCHSIA)
 
+#if defined(OS_FUCHSIA)
 #define TRACE_EVENT2_INT(category_group, name, arg1_name, arg1_val, arg2_name, \
                          arg2_val)                                             \
   const auto __arg1_val_str = std::to_string(arg1_val);                        \
   const auto __arg2_val_str = std::to_string(arg2_val);                        \
   TRACE_EVENT2(category_group, name, arg1_name, __arg1_val_str.c_str(),        \
                arg2_name, __arg2_val_str.c_str());
+#endif  //  defined(OS_FUCHSIA)
 
 namespace fml {
 namespace tracing {
@@ -241,8 +251,9 @@ void TraceTimelineEvent(TraceArg category_group,
                         size_t flow_id_count,
                         const uint64_t* flow_ids,
                         Dart_Timeline_Event_Type type,
-                        const std::vector<const char*>& names,
-                        const std::vector<std::string>& values);
+                        size_t argument_count,
+                        const char* const* names,
+                        const char* const* values);
 
 void TraceTimelineEvent(TraceArg category_group,
                         TraceArg name,
@@ -250,53 +261,91 @@ void TraceTimelineEvent(TraceArg category_group,
                         size_t flow_id_count,
                         const uint64_t* flow_ids,
                         Dart_Timeline_Event_Type type,
-                        const std::vector<const char*>& names,
-                        const std::vector<std::string>& values);
+                        size_t argument_count,
+                        const char* const* names,
+                        const char* const* values);
+
+//------------------------------------------------------------------------------
+/// @brief      The arguments of a trace event, as the key and value strings
+///             expected by the timeline.
+///
+///             String values are referenced rather than copied, so they must
+///             outlive this object. Numbers and time points are formatted into
+///             fixed-size inline storage, so collecting arguments never
+///             allocates.
+///
+template <size_t kArgumentCount>
+class TraceArguments {
+ public:
+  template <typename... Args>
+  explicit TraceArguments(const Args&... args) {
+    static_assert(sizeof...(Args) == kArgumentCount * 2,
+                  "Trace arguments must be key-value pairs.");
+    Collect(args...);
+  }
 
-inline std::string TraceToString(const char* string) {
-  return std::string{string};
-}
+  size_t count() const { return kArgumentCount; }
 
-inline std::string TraceToString(std::string string) {
-  return string;
-}
+  const char* const* names() const { return names_; }
 
-inline std::string TraceToString(TimePoint point) {
-  return std::to_string(point.ToEpochDelta().ToNanoseconds());
-}
+  const char* const* values() const { return values_; }
 
-template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
-std::string TraceToString(T string) {
-  return std::to_string(string);
-}
+ private:
+  // Fits any 64-bit integer, and doubles below 1e20 in fixed-point notation.
+  static constexpr size_t kSlotSize = 32;
+  static constexpr size_t kStorageCount = kArgumentCount > 0 ? kArgumentCount
+                                                             : 1;
+
+  const char* names_[kStorageCount];
+  const char* values_[kStorageCount];
+  char slots_[kStorageCount][kSlotSize];
+  size_t index_ = 0;
+
+  void Collect() {}
+
+  template <typename Key, typename Value, typename... Args>
+  void Collect(const Key& key, const Value& value, const Args&... args) {
+    names_[index_] = key;
+    values_[index_] = Format(value, slots_[index_]);
+    index_++;
+    Collect(args...);
+  }
 
-inline void SplitArgumentsCollect(std::vector<const char*>& keys,
-                                  std::vector<std::string>& values) {}
-
-template <typename Key, typename Value, typename... Args>
-void SplitArgumentsCollect(std::vector<const char*>& keys,
-                           std::vector<std::string>& values,
-                           Key key,
-                           Value value,
-                           Args... args) {
-  keys.emplace_back(key);
-  values.emplace_back(TraceToString(value));
-  SplitArgumentsCollect(keys, values, args...);
-}
+  static const char* Format(const char* value, char* slot) { return value; }
 
-inline std::pair<std::vector<const char*>, std::vector<std::string>>
-SplitArguments() {
-  return {};
-}
+  static const char* Format(const std::string& value, char* slot) {
+    return value.c_str();
+  }
 
-template <typename Key, typename Value, typename... Args>
-std::pair<std::vector<const char*>, std::vector<std::string>>
-SplitArguments(Key key, Value value, Args... args) {
-  std::vector<const char*> keys;
-  std::vector<std::string> values;
-  SplitArgumentsCollect(keys, values, key, value, args...);
-  return std::make_pair(std::move(keys), std::move(values));
-}
+  static const char* Format(TimePoint value, char* slot) {
+    return Format(value.ToEpochDelta().ToNanoseconds(), slot);
+  }
+
+  // Matches the output of |std::to_string|, which was used previously, except
+  // that doubles too large for the slot use exponent notation.
+  template <typename T,
+            typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+  static const char* Format(T value, char* slot) {
+    char* last = slot + kSlotSize - 1;
+    std::to_chars_result result;
+    if constexpr (std::is_floating_point<T>::value) {
+      const double number = static_cast<double>(value);
+      result = std::to_chars(slot, last, number, std::chars_format::fixed, 6);
+      if (result.ec != std::errc()) {
+        result =
+            std::to_chars(slot, last, number, std::chars_format::general, 6);
+      }
+    } else {
+      using Integer = std::conditional_t<std::is_signed<T>::value, int64_t,
+                                         uint64_t>;
+      result = std::to_chars(slot, last, static_cast<Integer>(value));
+    }
+    *result.ptr = '\0';
+    return slot;
+  }
+
+  FML_DISALLOW_COPY_AND_ASSIGN(TraceArguments);
+};
 
 size_t TraceNonce();
 
@@ -306,10 +355,13 @@ void TraceCounter(TraceArg category,
                   TraceIDArg identifier,
                   Args... args) {
 #if FLUTTER_TIMELINE_ENABLED
-  auto split = SplitArguments(args...);
+  if (!TraceHasTimelineEventHandler()) {
+    return;
+  }
+  const TraceArguments<sizeof...(Args) / 2> arguments(args...);
   TraceTimelineEvent(category, name, identifier, /*flow_id_count=*/0,
                      /*flow_ids=*/nullptr, Dart_Timeline_Event_Counter,
-                     split.first, split.second);
+                     arguments.count(), arguments.names(), arguments.values());
 #endif  // FLUTTER_TIMELINE_ENABLED
 }
 
@@ -328,9 +380,13 @@ void TraceEvent(TraceArg category,
                 const uint64_t* flow_ids,
                 Args... args) {
 #if FLUTTER_TIMELINE_ENABLED
-  auto split = SplitArguments(args...);
+  if (!TraceHasTimelineEventHandler()) {
+    return;
+  }
+  const TraceArguments<sizeof...(Args) / 2> arguments(args...);
   TraceTimelineEvent(category, name, 0, flow_id_count, flow_ids,
-                     Dart_Timeline_Event_Begin, split.first, split.second);
+                     Dart_Timeline_Event_Begin, arguments.count(),
+                     arguments.names(), arguments.values());
 #endif  // FLUTTER_TIMELINE_ENABLED
 }
 
@@ -364,8 +420,11 @@ void TraceEventAsyncComplete(TraceArg category_group,
                              TimePoint end,
                              Args... args) {
 #if FLUTTER_TIMELINE_ENABLED
+  if (!TraceHasTimelineEventHandler()) {
+    return;
+  }
   auto identifier = TraceNonce();
-  const auto split = SplitArguments(args...);
+  const TraceArguments<sizeof...(Args) / 2> arguments(args...);
 
   if (begin > end) {
     std::swap(begin, end);
@@ -381,8 +440,9 @@ void TraceEventAsyncComplete(TraceArg category_group,
                      0,                                // flow_id_count
                      nullptr,                          // flow_ids
                      Dart_Timeline_Event_Async_Begin,  // type
-                     split.first,                      // names
-                     split.second                      // values
+                     arguments.count(),                // argument_count
+                     arguments.names(),                // names
+                     arguments.values()                // values
   );
 
   TraceTimelineEvent(category_group,                 // group
@@ -392,8 +452,9 @@ void TraceEventAsyncComplete(TraceArg category_group,
                      0,                              // flow_id_count
                      nullptr,                        // flow_ids
                      Dart_Timeline_Event_Async_End,  // type
-                     split.first,                    // names
-                     split.second                    // values
+                     arguments.count(),              // argument_count
+                     arguments.names(),              // names
+                     arguments.values()              // values
   );
 #endif  // FLUTTER_TIMELINE_ENABLED
 }
@@ -0,0 +1,120 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/trace_event.h"
+
+#include <string>
+
+#include "flutter/benchmarking/benchmarking.h"
+
+namespace fml {
+namespace benchmarking {
+
+namespace {
+
+void NoOpTimelineEventHandler(const char* label,
+                              int64_t timestamp0,
+                              int64_t timestamp1_or_async_id,
+                              intptr_t flow_id_count,
+                              const int64_t* flow_ids,
+                              Dart_Timeline_Event_Type type,
+                              intptr_t argument_count,
+                              const char** argument_names,
+                              const char** argument_values) {
+  benchmark::DoNotOptimize(argument_values);
+}
+
+// Installs a timeline event handler that drops events for the duration of a
+// benchmark, so that only the cost of emitting events is measured.
+class ScopedTimelineEventHandler {
+ public:
+  ScopedTimelineEventHandler() {
+    tracing::TraceSetTimelineEventHandler(NoOpTimelineEventHandler);
+  }
+
+  ~ScopedTimelineEventHandler() {
+    tracing::TraceSetTimelineEventHandler(nullptr);
+  }
+};
+
+}  // namespace
+
+static void BM_TraceEventNoArguments(benchmark::State& state) {
+  ScopedTimelineEventHandler handler;
+  while (state.KeepRunning()) {
+    TRACE_EVENT0("flutter", "BM_TraceEvent");
+  }
+}
+BENCHMARK(BM_TraceEventNoArguments);
+
+static void BM_TraceEventStringArguments(benchmark::State& state) {
+  ScopedTimelineEventHandler handler;
+  while (state.KeepRunning()) {
+    TRACE_EVENT2("flutter", "BM_TraceEvent", "first", "value", "second",
+                 "value");
+  }
+}
+BENCHMARK(BM_TraceEventStringArguments);
+
+// The previous cost of numeric arguments, formatted by the caller.
+static void BM_TraceEventPreformattedIntegerArguments(
+    benchmark::State& state) {
+  ScopedTimelineEventHandler handler;
+  int64_t value = 0;
+  while (state.KeepRunning()) {
+    value++;
+    const std::string first = std::to_string(value);
+    const std::string second = std::to_string(-value);
+    TRACE_EVENT2("flutter", "BM_TraceEvent", "first", first.c_str(), "second",
+                 second.c_str());
+  }
+}
+BENCHMARK(BM_TraceEventPreformattedIntegerArguments);
+
+static void BM_TraceEventIntegerArguments(benchmark::State& state) {
+  ScopedTimelineEventHandler handler;
+  int64_t value = 0;
+  while (state.KeepRunning()) {
+    value++;
+    FML_TRACE_EVENT("flutter", "BM_TraceEvent", "first", value, "second",
+                    -value);
+  }
+}
+BENCHMARK(BM_TraceEventIntegerArguments);
+
+static void BM_TraceEventDoubleArguments(benchmark::State& state) {
+  ScopedTimelineEventHandler handler;
+  double value = 0;
+  while (state.KeepRunning()) {
+    value += 0.5;
+    FML_TRACE_EVENT("flutter", "BM_TraceEvent", "first", value, "second",
+                    -value);
+  }
+}
+BENCHMARK(BM_TraceEventDoubleArguments);
+
+static void BM_TraceEventTimePointArguments(benchmark::State& state) {
+  ScopedTimelineEventHandler handler;
+  const TimePoint start = TimePoint::Now();
+  const TimePoint target = start + TimeDelta::FromMilliseconds(16);
+  while (state.KeepRunning()) {
+    FML_TRACE_EVENT("flutter", "BM_TraceEvent", "StartTime", start,
+                    "TargetTime", target);
+  }
+}
+BENCHMARK(BM_TraceEventTimePointArguments);
+
+static void BM_TraceEventIntegerArgumentsWithoutHandler(
+    benchmark::State& state) {
+  int64_t value = 0;
+  while (state.KeepRunning()) {
+    value++;
+    FML_TRACE_EVENT("flutter", "BM_TraceEvent", "first", value, "second",
+                    -value);
+  }
+}
+BENCHMARK(BM_TraceEventIntegerArgumentsWithoutHandler);
+
+}  // namespace benchmarking
+}  // namespace fml
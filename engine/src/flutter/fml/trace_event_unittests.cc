@@ -0,0 +1,58 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/fml/trace_event.h"
+
+#include <limits>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace fml {
+namespace tracing {
+namespace testing {
+
+TEST(TraceEventTest, ArgumentsWithoutValues) {
+  TraceArguments<0> arguments;
+  EXPECT_EQ(arguments.count(), 0u);
+}
+
+TEST(TraceEventTest, ArgumentsReferenceStrings) {
+  const char* literal = "literal";
+  std::string string = "string";
+  TraceArguments<2> arguments("a", literal, "b", string);
+  ASSERT_EQ(arguments.count(), 2u);
+  EXPECT_STREQ(arguments.names()[0], "a");
+  EXPECT_EQ(arguments.values()[0], literal);
+  EXPECT_STREQ(arguments.names()[1], "b");
+  EXPECT_EQ(arguments.values()[1], string.c_str());
+}
+
+TEST(TraceEventTest, ArgumentsFormatIntegers) {
+  TraceArguments<5> arguments(
+      "int", -42, "uint64", std::numeric_limits<uint64_t>::max(), "int64",
+      std::numeric_limits<int64_t>::min(), "bool", true, "size", size_t{7});
+  EXPECT_STREQ(arguments.values()[0], "-42");
+  EXPECT_STREQ(arguments.values()[1], "18446744073709551615");
+  EXPECT_STREQ(arguments.values()[2], "-9223372036854775808");
+  EXPECT_STREQ(arguments.values()[3], "1");
+  EXPECT_STREQ(arguments.values()[4], "7");
+}
+
+TEST(TraceEventTest, ArgumentsFormatDoubles) {
+  TraceArguments<3> arguments("double", 2.5, "float", 0.25f, "large", 1e300);
+  EXPECT_EQ(arguments.values()[0], std::to_string(2.5));
+  EXPECT_EQ(arguments.values()[1], std::to_string(0.25f));
+  EXPECT_STREQ(arguments.values()[2], "1e+300");
+}
+
+TEST(TraceEventTest, ArgumentsFormatTimePoints) {
+  TimePoint point = TimePoint::FromEpochDelta(TimeDelta::FromNanoseconds(123));
+  TraceArguments<1> arguments("time", point);
+  EXPECT_STREQ(arguments.values()[0], "123");
+}
+
+}  // namespace testing
+}  // namespace tracing
+}  // namespace fml
@@ -812,8 +812,22 @@ void Canvas::DrawImageRect(const std::shared_ptr<Texture>& image,
     return;
   }
 
+  // Sampling a texture without mips this far minified reads far more texels
+  // than it needs to, so substitute a mipmapped copy when that's enabled.
+  std::shared_ptr<Texture> texture = image;
+  LazyMipmapCache* mipmap_cache = renderer_.GetLazyMipmapCache();
+  if (mipmap_cache && sampler.mip_filter != MipFilter::kBase) {
+    const Scalar scale = GetCurrentTransform().GetMaxBasisLengthXY() *
+                         std::max(dest.GetWidth() / source.GetWidth(),
+                                  dest.GetHeight() / source.GetHeight());
+    if (scale < 0.5f) {
+      texture =
+          mipmap_cache->GetMipmappedTexture(renderer_.GetContext(), image);
+    }
+  }
+
   auto texture_contents = TextureContents::MakeRect(dest);
-  texture_contents->SetTexture(image);
+  texture_contents->SetTexture(texture);
   texture_contents->SetSourceRect(source);
   texture_contents->SetStrictSourceRect(src_rect_constraint ==
                                         SourceRectConstraint::kStrict);
@@ -1647,6 +1661,9 @@ void Canvas::EndReplay() {
 
   render_passes_.clear();
   renderer_.GetRenderTargetCache()->End();
+  if (LazyMipmapCache* mipmap_cache = renderer_.GetLazyMipmapCache()) {
+    mipmap_cache->Sweep();
+  }
 
   Reset();
   Initialize(initial_cull_rect_);
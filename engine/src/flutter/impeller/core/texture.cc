@@ -23,6 +23,7 @@ bool Texture::SetContents(const uint8_t* contents,
   if (!OnSetContents(contents, length, slice)) {
     return false;
   }
+  MarkContentsChanged();
   coordinate_system_ = TextureCoordinateSystem::kUploadFromHost;
   is_opaque_ = is_opaque;
   return true;
@@ -41,11 +42,20 @@ bool Texture::SetContents(std::shared_ptr<const fml::Mapping> mapping,
   if (!OnSetContents(std::move(mapping), slice)) {
     return false;
   }
+  MarkContentsChanged();
   coordinate_system_ = TextureCoordinateSystem::kUploadFromHost;
   is_opaque_ = is_opaque;
   return true;
 }
 
+uint64_t Texture::GetContentGeneration() const {
+  return content_generation_.load(std::memory_order_relaxed);
+}
+
+void Texture::MarkContentsChanged() {
+  content_generation_.fetch_add(1u, std::memory_order_relaxed);
+}
+
 bool Texture::IsOpaque() const {
   return is_opaque_;
 }
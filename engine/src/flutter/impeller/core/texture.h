@@ -5,6 +5,7 @@
 #ifndef FLUTTER_IMPELLER_CORE_TEXTURE_H_
 #define FLUTTER_IMPELLER_CORE_TEXTURE_H_
 
+#include <atomic>
 #include <string_view>
 
 #include "flutter/fml/mapping.h"
@@ -56,6 +57,15 @@ class Texture {
   /// modified and the mipmaps hasn't been regenerated.
   bool NeedsMipmapGeneration() const;
 
+  /// A counter that is incremented whenever the contents of the texture are
+  /// written by `SetContents`, a blit, or a render pass. Data derived from the
+  /// contents is stale once it changes.
+  uint64_t GetContentGeneration() const;
+
+  /// Increment the content generation. Called when a write to the texture is
+  /// encoded.
+  void MarkContentsChanged();
+
  protected:
   explicit Texture(TextureDescriptor desc);
 
@@ -74,6 +84,7 @@ class Texture {
       TextureCoordinateSystem::kRenderToTexture;
   const TextureDescriptor desc_;
   bool is_opaque_ = false;
+  std::atomic<uint64_t> content_generation_ = 0u;
 
   bool IsSliceValid(size_t slice) const;
 
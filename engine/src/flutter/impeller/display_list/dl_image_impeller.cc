@@ -113,7 +113,9 @@ SkISize DlImageImpeller::dimensions() const {
 size_t DlImageImpeller::GetApproximateByteSize() const {
   auto size = sizeof(*this);
   if (texture_) {
-    size += texture_->GetTextureDescriptor().GetByteSizeOfBaseMipLevel();
+    // Account for the whole mip chain, which adds up to a third of the base
+    // level for mipmapped images.
+    size += texture_->GetTextureDescriptor().GetByteSizeOfAllMipLevels();
   }
   return size;
 }
@@ -559,6 +559,14 @@ void ContentContext::SetWireframe(bool wireframe) {
   wireframe_ = wireframe;
 }
 
+void ContentContext::SetLazyMipmapGeneration(bool enabled) {
+  if (!enabled) {
+    lazy_mipmap_cache_.reset();
+  } else if (!lazy_mipmap_cache_) {
+    lazy_mipmap_cache_ = std::make_unique<LazyMipmapCache>();
+  }
+}
+
 std::shared_ptr<Pipeline<PipelineDescriptor>>
 ContentContext::GetCachedRuntimeEffectPipeline(
     const std::string& unique_entrypoint_name,
@@ -9,6 +9,7 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <utility>
 
 #include "flutter/fml/logging.h"
 #include "flutter/fml/status_or.h"
@@ -20,6 +21,7 @@
 #include "impeller/renderer/pipeline.h"
 #include "impeller/renderer/pipeline_descriptor.h"
 #include "impeller/renderer/render_target.h"
+#include "impeller/renderer/texture_mipmap.h"
 #include "impeller/typographer/lazy_glyph_atlas.h"
 #include "impeller/typographer/typographer_context.h"
 
@@ -697,6 +699,16 @@ class ContentContext {
 
   void SetWireframe(bool wireframe);
 
+  /// @brief  Enables generating mip chains for textures without mips the
+  ///         first time they are drawn minified with mipmap sampling.
+  void SetLazyMipmapGeneration(bool enabled);
+
+  /// @brief  The cache of lazily mipmapped textures, or nullptr if lazy
+  ///         mipmap generation is disabled.
+  LazyMipmapCache* GetLazyMipmapCache() const {
+    return lazy_mipmap_cache_.get();
+  }
+
   using SubpassCallback =
       std::function<bool(const ContentContext&, RenderPass&)>;
 
@@ -752,6 +764,19 @@ class ContentContext {
   /// allocate their own device buffers.
   HostBuffer& GetTransientsBuffer() const { return *host_buffer_; }
 
+  /// @brief Replace the host buffer used for transient storage.
+  ///
+  /// Renderers that share this content context but reset the transients
+  /// buffer on their own schedule should each install their own buffer while
+  /// they render, so that they do not recycle each other's allocations.
+  ///
+  /// @return The host buffer that was replaced.
+  std::shared_ptr<HostBuffer> SetTransientsBuffer(
+      std::shared_ptr<HostBuffer> host_buffer) {
+    FML_DCHECK(host_buffer);
+    return std::exchange(host_buffer_, std::move(host_buffer));
+  }
+
  private:
   std::shared_ptr<Context> context_;
   std::shared_ptr<LazyGlyphAtlas> lazy_glyph_atlas_;
@@ -1005,6 +1030,7 @@ class ContentContext {
   std::shared_ptr<RenderTargetAllocator> render_target_cache_;
   std::shared_ptr<HostBuffer> host_buffer_;
   std::shared_ptr<Texture> empty_texture_;
+  std::unique_ptr<LazyMipmapCache> lazy_mipmap_cache_;
   bool wireframe_ = false;
 
   ContentContext(const ContentContext&) = delete;
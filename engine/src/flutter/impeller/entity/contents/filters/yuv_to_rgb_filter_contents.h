@@ -17,6 +17,11 @@ class YUVToRGBFilterContents final : public FilterContents {
 
   void SetYUVColorSpace(YUVColorSpace yuv_color_space);
 
+  /// @brief  The matrix that converts YUV samples to RGB, once the luma
+  ///         offset of limited range color spaces and the chroma offset of
+  ///         0.5 have been subtracted.
+  static Matrix GetYUVToRGBMatrix(YUVColorSpace yuv_color_space);
+
  private:
   // |FilterContents|
   std::optional<Entity> RenderFilter(
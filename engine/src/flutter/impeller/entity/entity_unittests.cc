@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "flutter/display_list/testing/dl_test_snippets.h"
+#include "flutter/fml/synchronization/waitable_event.h"
 #include "fml/logging.h"
 #include "gtest/gtest.h"
 #include "impeller/core/device_buffer.h"
@@ -1710,6 +1711,95 @@ TEST_P(EntityTest, YUVToRGBFilter) {
   ASSERT_TRUE(OpenPlaygroundHere(callback));
 }
 
+// Copies the pixels of an 8-bit RGBA or BGRA `texture` to RGBA colors.
+static std::vector<Color> ReadTexturePixels(
+    const std::shared_ptr<Context>& context,
+    const std::shared_ptr<Texture>& texture) {
+  const TextureDescriptor& texture_desc = texture->GetTextureDescriptor();
+  DeviceBufferDescriptor buffer_desc;
+  buffer_desc.storage_mode = StorageMode::kHostVisible;
+  buffer_desc.size = texture_desc.GetByteSizeOfBaseMipLevel();
+  auto buffer = context->GetResourceAllocator()->CreateBuffer(buffer_desc);
+
+  auto cmd_buffer = context->CreateCommandBuffer();
+  auto blit_pass = cmd_buffer->CreateBlitPass();
+  blit_pass->AddCopy(texture, buffer);
+  EXPECT_TRUE(blit_pass->EncodeCommands(context->GetResourceAllocator()));
+
+  fml::AutoResetWaitableEvent latch;
+  EXPECT_TRUE(context->GetCommandQueue()
+                  ->Submit({cmd_buffer},
+                           [&latch](CommandBuffer::Status status) {
+                             EXPECT_EQ(status,
+                                       CommandBuffer::Status::kCompleted);
+                             latch.Signal();
+                           })
+                  .ok());
+  latch.Wait();
+
+  const bool is_bgra = texture_desc.format == PixelFormat::kB8G8R8A8UNormInt;
+  const uint8_t* bytes = buffer->OnGetContents();
+  std::vector<Color> pixels;
+  for (size_t i = 0; i < buffer_desc.size; i += 4) {
+    const uint8_t* pixel = bytes + i;
+    Scalar r = (is_bgra ? pixel[2] : pixel[0]) / 255.0;
+    Scalar b = (is_bgra ? pixel[0] : pixel[2]) / 255.0;
+    pixels.push_back(Color(r, pixel[1] / 255.0, b, pixel[3] / 255.0));
+  }
+  return pixels;
+}
+
+TEST_P(EntityTest, YUVToRGBFilterRendersExpectedPixels) {
+  if (GetParam() == PlaygroundBackend::kOpenGLES) {
+    // TODO(114588) : Support YUV to RGB filter on OpenGLES backend.
+    GTEST_SKIP()
+        << "YUV to RGB filter is not supported on OpenGLES backend yet.";
+  }
+
+  // The colors of the rows of the planes made by CreateTestYUVTextures, each
+  // two rows of the 8x8 Y plane and one row of the 4x4 UV plane.
+  const Color kExpectedColors[] = {
+      Color(244.0 / 255.0, 67.0 / 255.0, 54.0 / 255.0, 1.0),
+      Color(76.0 / 255.0, 175.0 / 255.0, 80.0 / 255.0, 1.0),
+      Color(33.0 / 255.0, 150.0 / 255.0, 243.0 / 255.0, 1.0),
+      Color::White(),
+  };
+  // Covers the rounded coefficients of RGBToYUV, rounding the planes and the
+  // output to 8 bits, and shading in half precision.
+  constexpr Scalar kTolerance = 6.0 / 255.0;
+
+  for (YUVColorSpace yuv_color_space : {YUVColorSpace::kBT601FullRange,
+                                        YUVColorSpace::kBT601LimitedRange}) {
+    auto textures = CreateTestYUVTextures(GetContext().get(), yuv_color_space);
+    auto filter_contents = FilterContents::MakeYUVToRGBFilter(
+        textures[0], textures[1], yuv_color_space);
+    Entity entity;
+    entity.SetContents(filter_contents);
+    auto snapshot = filter_contents->RenderToSnapshot(*GetContentContext(),
+                                                      entity, std::nullopt,
+                                                      std::nullopt, false);
+    ASSERT_TRUE(snapshot.has_value());
+    ASSERT_EQ(snapshot->texture->GetSize(), ISize(8, 8));
+
+    std::vector<Color> pixels =
+        ReadTexturePixels(GetContext(), snapshot->texture);
+    ASSERT_EQ(pixels.size(), 64u);
+    for (int y = 0; y < 8; y++) {
+      const Color& expected = kExpectedColors[y / 2];
+      for (int x = 0; x < 8; x++) {
+        const Color& actual = pixels[y * 8 + x];
+        SCOPED_TRACE(::testing::Message()
+                     << "color space " << static_cast<int>(yuv_color_space)
+                     << ", pixel (" << x << ", " << y << ")");
+        EXPECT_NEAR(actual.red, expected.red, kTolerance);
+        EXPECT_NEAR(actual.green, expected.green, kTolerance);
+        EXPECT_NEAR(actual.blue, expected.blue, kTolerance);
+        EXPECT_NEAR(actual.alpha, 1.0, kTolerance);
+      }
+    }
+  }
+}
+
 TEST_P(EntityTest, RuntimeEffect) {
   auto runtime_stages =
       OpenAssetAsRuntimeStage("runtime_stage_example.frag.iplr");
@@ -75,6 +75,7 @@ bool BlitPass::AddCopy(std::shared_ptr<Texture> source,
     return true;  // Nothing to blit.
   }
 
+  destination->MarkContentsChanged();
   return OnCopyTextureToTextureCommand(
       std::move(source), std::move(destination), source_region.value(),
       destination_origin, std::move(label));
@@ -155,6 +156,7 @@ bool BlitPass::AddCopy(BufferView source,
     return false;
   }
 
+  destination->MarkContentsChanged();
   return OnCopyBufferToTextureCommand(std::move(source), std::move(destination),
                                       destination_region_value,
                                       std::move(label), slice, convert_to_read);
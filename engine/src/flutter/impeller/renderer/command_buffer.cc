@@ -39,6 +39,14 @@ std::shared_ptr<RenderPass> CommandBuffer::CreateRenderPass(
   auto pass = OnCreateRenderPass(render_target);
   if (pass && pass->IsValid()) {
     pass->SetLabel("RenderPass");
+    for (const auto& [_, color] : render_target.GetColorAttachments()) {
+      if (color.texture) {
+        color.texture->MarkContentsChanged();
+      }
+      if (color.resolve_texture) {
+        color.resolve_texture->MarkContentsChanged();
+      }
+    }
     return pass;
   }
   return nullptr;
@@ -3,8 +3,13 @@
 // found in the LICENSE file.
 
 #include "impeller/renderer/texture_mipmap.h"
+
+#include <algorithm>
+#include <iterator>
+
 #include "impeller/renderer/blit_pass.h"
 #include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/command_queue.h"
 
 namespace impeller {
 
@@ -24,4 +29,114 @@ fml::Status AddMipmapGeneration(
   return fml::Status();
 }
 
+LazyMipmapCache::LazyMipmapCache(size_t max_byte_size)
+    : max_byte_size_(max_byte_size) {}
+
+LazyMipmapCache::~LazyMipmapCache() = default;
+
+std::shared_ptr<Texture> LazyMipmapCache::GetMipmappedTexture(
+    const std::shared_ptr<Context>& context,
+    const std::shared_ptr<Texture>& texture) {
+  const TextureDescriptor& source_desc = texture->GetTextureDescriptor();
+  if (source_desc.mip_count > 1u || source_desc.size.MipCount() <= 1u ||
+      source_desc.type != TextureType::kTexture2D) {
+    return texture;
+  }
+  // Render targets are usually rendered to again every frame, which would
+  // make the copy stale every frame. Copying and mipmapping them each frame
+  // costs more than sampling them without mips.
+  if (source_desc.usage & TextureUsage::kRenderTarget) {
+    return texture;
+  }
+
+  auto found = entries_.find(texture.get());
+  if (found != entries_.end()) {
+    if (found->second.source.lock() == texture &&
+        found->second.content_generation == texture->GetContentGeneration()) {
+      found->second.last_use = ++use_count_;
+      return found->second.mipmapped;
+    }
+    // The source was collected and its address reused, or its contents were
+    // written since they were copied.
+    Erase(found);
+  }
+
+  TextureDescriptor desc = source_desc;
+  desc.storage_mode = StorageMode::kDevicePrivate;
+  desc.usage = TextureUsage::kShaderRead;
+  desc.mip_count = source_desc.size.MipCount();
+  const size_t byte_size = desc.GetByteSizeOfAllMipLevels();
+  if (byte_size > max_byte_size_) {
+    return texture;
+  }
+  const uint64_t content_generation = texture->GetContentGeneration();
+  auto mipmapped = context->GetResourceAllocator()->CreateTexture(desc);
+  if (!mipmapped) {
+    return texture;
+  }
+  mipmapped->SetLabel("Lazy Mipmap Texture");
+  mipmapped->SetCoordinateSystem(texture->GetCoordinateSystem());
+
+  auto command_buffer = context->CreateCommandBuffer();
+  if (!command_buffer) {
+    return texture;
+  }
+  command_buffer->SetLabel("Lazy Mipmap Command Buffer");
+  std::shared_ptr<BlitPass> blit_pass = command_buffer->CreateBlitPass();
+  if (!blit_pass) {
+    return texture;
+  }
+  blit_pass->SetLabel("Lazy Mipmap Blit Pass");
+  if (!blit_pass->AddCopy(texture, mipmapped) ||
+      !blit_pass->GenerateMipmap(mipmapped) ||
+      !blit_pass->EncodeCommands(context->GetResourceAllocator())) {
+    return texture;
+  }
+  if (!context->GetCommandQueue()->Submit({command_buffer}).ok()) {
+    return texture;
+  }
+
+  EvictToByteSize(max_byte_size_ - byte_size);
+  entries_[texture.get()] = Entry{
+      .source = texture,
+      .content_generation = content_generation,
+      .mipmapped = mipmapped,
+      .byte_size = byte_size,
+      .last_use = ++use_count_,
+  };
+  total_byte_size_ += byte_size;
+  return mipmapped;
+}
+
+void LazyMipmapCache::Sweep() {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    auto next = std::next(it);
+    if (it->second.source.expired()) {
+      Erase(it);
+    }
+    it = next;
+  }
+}
+
+size_t LazyMipmapCache::GetByteSize(const Texture& texture) const {
+  auto found = entries_.find(&texture);
+  return found == entries_.end() ? 0u : found->second.byte_size;
+}
+
+void LazyMipmapCache::EvictToByteSize(size_t byte_size) {
+  while (total_byte_size_ > byte_size && !entries_.empty()) {
+    auto least_recently_used = std::min_element(
+        entries_.begin(), entries_.end(), [](const auto& a, const auto& b) {
+          return a.second.last_use < b.second.last_use;
+        });
+    Erase(least_recently_used);
+  }
+}
+
+void LazyMipmapCache::Erase(
+    std::unordered_map<const Texture*, Entry>::iterator it) {
+  total_byte_size_ -= it->second.byte_size;
+  entries_.erase(it);
+}
+
 }  // namespace impeller
@@ -5,6 +5,9 @@
 #ifndef FLUTTER_IMPELLER_RENDERER_TEXTURE_MIPMAP_H_
 #define FLUTTER_IMPELLER_RENDERER_TEXTURE_MIPMAP_H_
 
+#include <memory>
+#include <unordered_map>
+
 #include "flutter/fml/status.h"
 #include "impeller/core/texture.h"
 #include "impeller/renderer/command_buffer.h"
@@ -18,6 +21,90 @@ namespace impeller {
     const std::shared_ptr<Context>& context,
     const std::shared_ptr<Texture>& texture);
 
+//------------------------------------------------------------------------------
+/// @brief      Lazily generates mip chains for textures that were created
+///             without one, such as images uploaded without mipmaps, the
+///             first time they are sampled minified.
+///
+///             Render targets are not mipmapped, since they are usually
+///             rendered to again every frame.
+///
+///             The mipmapped copy of each texture is kept for as long as the
+///             source texture is alive and its contents are unchanged, and
+///             the copies together fit in the byte budget. Once the budget is
+///             exceeded, the least recently used copies are released. Copies
+///             of collected textures are released by `Sweep`.
+///
+///             This is not thread safe and must only be used from the raster
+///             thread.
+///
+class LazyMipmapCache {
+ public:
+  /// The default budget for the mipmapped copies, in bytes.
+  static constexpr size_t kDefaultMaxByteSize = 64u * 1024u * 1024u;
+
+  explicit LazyMipmapCache(size_t max_byte_size = kDefaultMaxByteSize);
+
+  ~LazyMipmapCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Get a copy of `texture` with a full mip chain, creating it
+  ///             and submitting the mipmap generation if necessary.
+  ///
+  /// @return     The mipmapped copy, or `texture` itself if it already has
+  ///             mips, is too small to have any, is a render target, its copy
+  ///             would not fit in the budget, or the copy could not be
+  ///             created.
+  ///
+  std::shared_ptr<Texture> GetMipmappedTexture(
+      const std::shared_ptr<Context>& context,
+      const std::shared_ptr<Texture>& texture);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Release the mipmapped copies of textures that have been
+  ///             collected.
+  ///
+  void Sweep();
+
+  //----------------------------------------------------------------------------
+  /// @return     The number of bytes used by the mipmapped copy of `texture`,
+  ///             or 0 if there is none.
+  ///
+  size_t GetByteSize(const Texture& texture) const;
+
+  //----------------------------------------------------------------------------
+  /// @return     The number of bytes used by all mipmapped copies.
+  ///
+  size_t GetTotalByteSize() const { return total_byte_size_; }
+
+  size_t GetEntryCount() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    std::weak_ptr<Texture> source;
+    // The content generation of the source when it was copied.
+    uint64_t content_generation = 0u;
+    std::shared_ptr<Texture> mipmapped;
+    size_t byte_size = 0u;
+    uint64_t last_use = 0u;
+  };
+
+  const size_t max_byte_size_;
+  std::unordered_map<const Texture*, Entry> entries_;
+  size_t total_byte_size_ = 0u;
+  uint64_t use_count_ = 0u;
+
+  void Erase(std::unordered_map<const Texture*, Entry>::iterator it);
+
+  // Release the least recently used copies until at most `byte_size` bytes
+  // are used.
+  void EvictToByteSize(size_t byte_size);
+
+  LazyMipmapCache(const LazyMipmapCache&) = delete;
+
+  LazyMipmapCache& operator=(const LazyMipmapCache&) = delete;
+};
+
 }  // namespace impeller
 
 #endif  // FLUTTER_IMPELLER_RENDERER_TEXTURE_MIPMAP_H_
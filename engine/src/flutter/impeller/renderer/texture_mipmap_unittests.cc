@@ -0,0 +1,170 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "gtest/gtest.h"
+#include "impeller/core/formats.h"
+#include "impeller/core/texture_descriptor.h"
+#include "impeller/playground/playground_test.h"
+#include "impeller/renderer/blit_pass.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/command_queue.h"
+#include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/render_target.h"
+#include "impeller/renderer/texture_mipmap.h"
+
+namespace impeller {
+namespace testing {
+
+using TextureMipmapTest = PlaygroundTest;
+INSTANTIATE_PLAYGROUND_SUITE(TextureMipmapTest);
+
+namespace {
+std::shared_ptr<Texture> CreateTexture(const std::shared_ptr<Context>& context,
+                                       ISize size,
+                                       size_t mip_count) {
+  TextureDescriptor desc;
+  desc.storage_mode = StorageMode::kDevicePrivate;
+  desc.format = PixelFormat::kR8G8B8A8UNormInt;
+  desc.size = size;
+  desc.mip_count = mip_count;
+  return context->GetResourceAllocator()->CreateTexture(desc);
+}
+
+// Overwrites the contents of |texture| with a blit.
+bool OverwriteTexture(const std::shared_ptr<Context>& context,
+                      const std::shared_ptr<Texture>& texture) {
+  const TextureDescriptor& desc = texture->GetTextureDescriptor();
+  DeviceBufferDescriptor buffer_desc;
+  buffer_desc.storage_mode = StorageMode::kHostVisible;
+  buffer_desc.size = desc.GetByteSizeOfBaseMipLevel();
+  auto buffer = context->GetResourceAllocator()->CreateBuffer(buffer_desc);
+  auto command_buffer = context->CreateCommandBuffer();
+  if (!buffer || !command_buffer) {
+    return false;
+  }
+  auto blit_pass = command_buffer->CreateBlitPass();
+  return blit_pass &&
+         blit_pass->AddCopy(DeviceBuffer::AsBufferView(buffer), texture) &&
+         blit_pass->EncodeCommands(context->GetResourceAllocator()) &&
+         context->GetCommandQueue()->Submit({command_buffer}).ok();
+}
+}  // namespace
+
+TEST_P(TextureMipmapTest, LazyMipmapCacheCreatesMipmappedCopy) {
+  auto context = GetContext();
+  auto texture = CreateTexture(context, {256, 128}, 1u);
+  ASSERT_TRUE(texture);
+
+  LazyMipmapCache cache;
+  auto mipmapped = cache.GetMipmappedTexture(context, texture);
+  ASSERT_TRUE(mipmapped);
+  EXPECT_NE(mipmapped, texture);
+  EXPECT_EQ(mipmapped->GetSize(), texture->GetSize());
+  EXPECT_EQ(mipmapped->GetTextureDescriptor().mip_count, 9u);
+  EXPECT_EQ(cache.GetEntryCount(), 1u);
+  EXPECT_EQ(cache.GetByteSize(*texture),
+            mipmapped->GetTextureDescriptor().GetByteSizeOfAllMipLevels());
+  EXPECT_EQ(cache.GetTotalByteSize(), cache.GetByteSize(*texture));
+
+  // The copy is reused.
+  EXPECT_EQ(cache.GetMipmappedTexture(context, texture), mipmapped);
+  EXPECT_EQ(cache.GetEntryCount(), 1u);
+}
+
+TEST_P(TextureMipmapTest, LazyMipmapCacheSkipsTexturesWithMips) {
+  auto context = GetContext();
+  auto texture = CreateTexture(context, {256, 128}, 9u);
+  ASSERT_TRUE(texture);
+
+  LazyMipmapCache cache;
+  EXPECT_EQ(cache.GetMipmappedTexture(context, texture), texture);
+  EXPECT_EQ(cache.GetEntryCount(), 0u);
+  EXPECT_EQ(cache.GetTotalByteSize(), 0u);
+}
+
+TEST_P(TextureMipmapTest, LazyMipmapCacheRecreatesCopyWhenContentsChange) {
+  auto context = GetContext();
+  auto texture = CreateTexture(context, {256, 128}, 1u);
+  ASSERT_TRUE(texture);
+
+  LazyMipmapCache cache;
+  auto mipmapped = cache.GetMipmappedTexture(context, texture);
+  ASSERT_NE(mipmapped, texture);
+
+  const uint64_t generation = texture->GetContentGeneration();
+  ASSERT_TRUE(OverwriteTexture(context, texture));
+  EXPECT_NE(texture->GetContentGeneration(), generation);
+
+  auto recreated = cache.GetMipmappedTexture(context, texture);
+  EXPECT_NE(recreated, texture);
+  EXPECT_NE(recreated, mipmapped);
+  EXPECT_EQ(cache.GetEntryCount(), 1u);
+  EXPECT_EQ(cache.GetTotalByteSize(), cache.GetByteSize(*texture));
+  EXPECT_EQ(cache.GetMipmappedTexture(context, texture), recreated);
+}
+
+TEST_P(TextureMipmapTest, LazyMipmapCacheSkipsRenderTargetsRenderedEachFrame) {
+  auto context = GetContext();
+  RenderTargetAllocator allocator(context->GetResourceAllocator());
+  RenderTarget render_target =
+      allocator.CreateOffscreen(*context, {256, 128}, /*mip_count=*/1);
+  std::shared_ptr<Texture> texture =
+      render_target.GetColorAttachments().at(0).texture;
+  ASSERT_TRUE(texture);
+
+  LazyMipmapCache cache;
+  for (int frame = 0; frame < 2; frame++) {
+    // Render to the target, then draw it minified.
+    auto command_buffer = context->CreateCommandBuffer();
+    ASSERT_TRUE(command_buffer);
+    auto render_pass = command_buffer->CreateRenderPass(render_target);
+    ASSERT_TRUE(render_pass);
+    ASSERT_TRUE(render_pass->EncodeCommands());
+    ASSERT_TRUE(context->GetCommandQueue()->Submit({command_buffer}).ok());
+
+    EXPECT_EQ(cache.GetMipmappedTexture(context, texture), texture);
+    EXPECT_EQ(cache.GetEntryCount(), 0u);
+    EXPECT_EQ(cache.GetTotalByteSize(), 0u);
+  }
+}
+
+TEST_P(TextureMipmapTest, LazyMipmapCacheEvictsLeastRecentlyUsedCopies) {
+  auto context = GetContext();
+  auto a = CreateTexture(context, {256, 128}, 1u);
+  auto b = CreateTexture(context, {256, 128}, 1u);
+  auto c = CreateTexture(context, {256, 128}, 1u);
+  ASSERT_TRUE(a && b && c);
+
+  TextureDescriptor mipmapped_desc = a->GetTextureDescriptor();
+  mipmapped_desc.mip_count = mipmapped_desc.size.MipCount();
+  const size_t copy_size = mipmapped_desc.GetByteSizeOfAllMipLevels();
+
+  LazyMipmapCache cache(/*max_byte_size=*/copy_size * 2);
+  auto a_mipmapped = cache.GetMipmappedTexture(context, a);
+  ASSERT_NE(a_mipmapped, a);
+  ASSERT_NE(cache.GetMipmappedTexture(context, b), b);
+  // Use the copy of a again, so b's is the least recently used.
+  EXPECT_EQ(cache.GetMipmappedTexture(context, a), a_mipmapped);
+  ASSERT_NE(cache.GetMipmappedTexture(context, c), c);
+
+  EXPECT_EQ(cache.GetEntryCount(), 2u);
+  EXPECT_EQ(cache.GetTotalByteSize(), copy_size * 2);
+  EXPECT_EQ(cache.GetByteSize(*a), copy_size);
+  EXPECT_EQ(cache.GetByteSize(*b), 0u);
+  EXPECT_EQ(cache.GetByteSize(*c), copy_size);
+}
+
+TEST_P(TextureMipmapTest, LazyMipmapCacheSkipsCopiesLargerThanBudget) {
+  auto context = GetContext();
+  auto texture = CreateTexture(context, {256, 128}, 1u);
+  ASSERT_TRUE(texture);
+
+  LazyMipmapCache cache(/*max_byte_size=*/1024u);
+  EXPECT_EQ(cache.GetMipmappedTexture(context, texture), texture);
+  EXPECT_EQ(cache.GetEntryCount(), 0u);
+  EXPECT_EQ(cache.GetTotalByteSize(), 0u);
+}
+
+}  // namespace testing
+}  // namespace impeller
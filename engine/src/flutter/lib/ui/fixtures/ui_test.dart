@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 import 'dart:async';
+import 'dart:convert';
 import 'dart:typed_data';
 import 'dart:ui';
 import 'dart:isolate';
@@ -112,6 +113,32 @@ Future<void> createSingleFrameCodec() async {
 @pragma('vm:external-name', 'ValidateCodec')
 external void _validateCodec(Codec codec);
 
+// A 1x1 PNG.
+const String _kOnePixelPng =
+    'iVBORw0KGgoAAAANSUhEUgAAAAEAAAABCAYAAAAfFcSJAAAADUlEQVR42mP8z8BQDwAEhQGA'
+    'hKmMIQAAAABJRU5ErkJggg==';
+
+@pragma('vm:entry-point')
+Future<void> decodeSameImageTwice() async {
+  final Uint8List bytes = base64.decode(_kOnePixelPng);
+  for (int i = 0; i < 2; i++) {
+    // A new buffer each time, as when the same asset is loaded again.
+    final ImmutableBuffer buffer = await ImmutableBuffer.fromUint8List(bytes);
+    final ImageDescriptor descriptor = await ImageDescriptor.encoded(buffer);
+    final Codec codec = await descriptor.instantiateCodec();
+    final FrameInfo info = await codec.getNextFrame();
+    info.image.dispose();
+    codec.dispose();
+    descriptor.dispose();
+    buffer.dispose();
+  }
+  _validateDecodedImageCache();
+  _finish();
+}
+
+@pragma('vm:external-name', 'ValidateDecodedImageCache')
+external void _validateDecodedImageCache();
+
 @pragma('vm:entry-point')
 void createVertices() {
   const int uint16max = 65535;
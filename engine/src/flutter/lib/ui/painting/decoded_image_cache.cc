@@ -0,0 +1,143 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
+
+#include <string_view>
+
+#include "flutter/fml/hash_combine.h"
+#include "flutter/fml/trace_event.h"
+
+namespace flutter {
+
+bool DecodedImageCache::Key::operator==(const Key& other) const {
+  return data_hash == other.data_hash && data_size == other.data_size &&
+         target_size == other.target_size && color_type == other.color_type;
+}
+
+std::size_t DecodedImageCache::KeyHash::operator()(const Key& key) const {
+  return fml::HashCombine(key.data_hash, key.data_size,
+                          key.target_size.width(), key.target_size.height(),
+                          static_cast<int>(key.color_type));
+}
+
+namespace {
+
+// Data of up to |kHashChunkSize| * |kHashChunkCount| bytes is hashed whole.
+constexpr size_t kHashChunkSize = 1024u;
+constexpr size_t kHashChunkCount = 64u;
+
+}  // namespace
+
+uint64_t DecodedImageCache::HashData(const SkData& data) {
+  TRACE_EVENT0("flutter", "DecodedImageCache::HashData");
+  const char* bytes = static_cast<const char*>(data.data());
+  const size_t size = data.size();
+  std::hash<std::string_view> hash_bytes;
+  if (size <= kHashChunkSize * kHashChunkCount) {
+    return hash_bytes(std::string_view(bytes, size));
+  }
+  // The first chunk starts at the first byte and the last one ends at the
+  // last byte.
+  const size_t stride = (size - kHashChunkSize) / (kHashChunkCount - 1);
+  uint64_t hash = size;
+  for (size_t i = 0; i < kHashChunkCount; i++) {
+    hash = fml::HashCombine(
+        hash, hash_bytes(std::string_view(bytes + i * stride, kHashChunkSize)));
+  }
+  return hash;
+}
+
+DecodedImageCache::Key DecodedImageCache::MakeKey(uint64_t data_hash,
+                                                  size_t data_size,
+                                                  SkISize target_size,
+                                                  SkColorType color_type) {
+  return Key{
+      .data_hash = data_hash,
+      .data_size = data_size,
+      .target_size = target_size,
+      .color_type = color_type,
+  };
+}
+
+DecodedImageCache::Key DecodedImageCache::MakeKey(const sk_sp<SkData>& data,
+                                                  SkISize target_size,
+                                                  SkColorType color_type) {
+  if (!data) {
+    return MakeKey(0u, 0u, target_size, color_type);
+  }
+  return MakeKey(HashData(*data), data->size(), target_size, color_type);
+}
+
+DecodedImageCache::DecodedImageCache() = default;
+
+DecodedImageCache::~DecodedImageCache() = default;
+
+void DecodedImageCache::SetMaxBytes(size_t max_bytes) {
+  max_bytes_ = max_bytes;
+  EvictToFit(max_bytes_);
+}
+
+sk_sp<DlImage> DecodedImageCache::Get(const Key& key,
+                                      const sk_sp<SkData>& data) {
+  // The data is only compared once an entry with the same hash and size is
+  // found, and not at all if it is the very same data.
+  auto found = index_.find(key);
+  if (found == index_.end() || !data ||
+      (found->second->data != data &&
+       !found->second->data->equals(data.get()))) {
+    miss_count_++;
+    return nullptr;
+  }
+  hit_count_++;
+  entries_.splice(entries_.begin(), entries_, found->second);
+  return found->second->image;
+}
+
+void DecodedImageCache::Put(const Key& key,
+                            sk_sp<SkData> data,
+                            sk_sp<DlImage> image) {
+  if (!IsEnabled() || !data || !image) {
+    return;
+  }
+  const size_t bytes = image->GetApproximateByteSize() + data->size();
+  if (bytes > max_bytes_) {
+    return;
+  }
+
+  auto found = index_.find(key);
+  if (found != index_.end()) {
+    current_bytes_ -= found->second->bytes;
+    entries_.erase(found->second);
+    index_.erase(found);
+  }
+
+  EvictToFit(max_bytes_ - bytes);
+  entries_.push_front(Entry{
+      .key = key,
+      .data = std::move(data),
+      .image = std::move(image),
+      .bytes = bytes,
+  });
+  index_[key] = entries_.begin();
+  current_bytes_ += bytes;
+}
+
+void DecodedImageCache::Clear() {
+  TRACE_EVENT0("flutter", "DecodedImageCache::Clear");
+  index_.clear();
+  entries_.clear();
+  current_bytes_ = 0;
+}
+
+void DecodedImageCache::EvictToFit(size_t max_bytes) {
+  while (current_bytes_ > max_bytes && !entries_.empty()) {
+    const Entry& entry = entries_.back();
+    current_bytes_ -= entry.bytes;
+    index_.erase(entry.key);
+    entries_.pop_back();
+  }
+}
+
+}  // namespace flutter
@@ -0,0 +1,157 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
+#define FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+#include "flutter/display_list/image/dl_image.h"
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkData.h"
+#include "third_party/skia/include/core/SkImageInfo.h"
+#include "third_party/skia/include/core/SkSize.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      A byte budgeted, least recently used cache of uploaded images,
+///             keyed on the encoded data they were decoded from along with the
+///             target size and pixel format of the decode.
+///
+///             Instantiating a codec for the same encoded bytes and target
+///             size (e.g. a thumbnail scrolling back into view in a list) can
+///             then skip decompression and texture upload entirely.
+///
+///             The cache is disabled (has a budget of zero bytes) by default.
+///             Like the `ImageDecoder` that owns it, this object must only be
+///             accessed on the UI task runner.
+///
+class DecodedImageCache {
+ public:
+  struct Key {
+    uint64_t data_hash = 0;
+    size_t data_size = 0;
+    SkISize target_size = SkISize::MakeEmpty();
+    SkColorType color_type = kUnknown_SkColorType;
+
+    bool operator==(const Key& other) const;
+  };
+
+  //----------------------------------------------------------------------------
+  /// @brief      Hash encoded image data for use in a `Key`.
+  ///
+  ///             Hashing all of a large encoded image would cost about as
+  ///             much as decoding it, so only a bounded number of evenly
+  ///             spaced chunks of large data are hashed. Data with colliding
+  ///             hashes is told apart by `Get`.
+  ///
+  static uint64_t HashData(const SkData& data);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Compute the cache key for decoding data of `data_size` bytes
+  ///             that hashes to `data_hash` into an image of `target_size`
+  ///             and `color_type`.
+  ///
+  static Key MakeKey(uint64_t data_hash,
+                     size_t data_size,
+                     SkISize target_size,
+                     SkColorType color_type);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Compute the cache key for decoding `data` into an image of
+  ///             `target_size` and `color_type`. This hashes `data` with
+  ///             `HashData`.
+  ///
+  static Key MakeKey(const sk_sp<SkData>& data,
+                     SkISize target_size,
+                     SkColorType color_type);
+
+  DecodedImageCache();
+
+  ~DecodedImageCache();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Set the maximum number of bytes of decoded images (and their
+  ///             encoded source data) retained by the cache. Entries are
+  ///             evicted immediately if the current size exceeds the new
+  ///             budget. A budget of zero disables the cache.
+  ///
+  void SetMaxBytes(size_t max_bytes);
+
+  size_t GetMaxBytes() const { return max_bytes_; }
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the cache has a non-zero budget.
+  ///
+  bool IsEnabled() const { return max_bytes_ > 0; }
+
+  //----------------------------------------------------------------------------
+  /// @brief      Look up a previously decoded image. On a hit, the entry is
+  ///             marked as the most recently used.
+  ///
+  /// @param[in]  key   The key computed with `MakeKey`.
+  /// @param[in]  data  The encoded data the key was computed from. Only if
+  ///                   an entry has the same key, this is compared against
+  ///                   the data of the entry, so that hash collisions never
+  ///                   return the wrong image.
+  ///
+  /// @return     The cached image or nullptr on a miss.
+  ///
+  sk_sp<DlImage> Get(const Key& key, const sk_sp<SkData>& data);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Insert a decoded image, evicting the least recently used
+  ///             entries until the cache fits in its budget. Images larger
+  ///             than the entire budget are not cached.
+  ///
+  void Put(const Key& key, sk_sp<SkData> data, sk_sp<DlImage> image);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Drop all cached entries. This is called in response to low
+  ///             memory warnings.
+  ///
+  void Clear();
+
+  size_t GetCurrentBytes() const { return current_bytes_; }
+
+  size_t GetEntryCount() const { return entries_.size(); }
+
+  size_t GetHitCount() const { return hit_count_; }
+
+  size_t GetMissCount() const { return miss_count_; }
+
+ private:
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const;
+  };
+
+  struct Entry {
+    Key key;
+    sk_sp<SkData> data;
+    sk_sp<DlImage> image;
+    size_t bytes = 0;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  size_t max_bytes_ = 0;
+  size_t current_bytes_ = 0;
+  size_t hit_count_ = 0;
+  size_t miss_count_ = 0;
+  // Ordered from most to least recently used.
+  EntryList entries_;
+  std::unordered_map<Key, EntryList::iterator, KeyHash> index_;
+
+  void EvictToFit(size_t max_bytes);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(DecodedImageCache);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_DECODED_IMAGE_CACHE_H_
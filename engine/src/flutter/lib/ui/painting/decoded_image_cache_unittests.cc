@@ -0,0 +1,277 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
+
+#include <memory>
+
+#include "flutter/common/task_runners.h"
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/lib/ui/painting/image_decoder.h"
+#include "flutter/lib/ui/ui_dart_state.h"
+#include "flutter/shell/common/shell_test.h"
+#include "flutter/testing/testing.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkImage.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+sk_sp<DlImage> MakeTestImage(int width, int height) {
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(width, height);
+  bitmap.eraseColor(SK_ColorRED);
+  bitmap.setImmutable();
+  return DlImage::Make(bitmap.asImage());
+}
+
+sk_sp<SkData> MakeTestData(uint8_t value, size_t size = 64) {
+  std::vector<uint8_t> bytes(size, value);
+  return SkData::MakeWithCopy(bytes.data(), bytes.size());
+}
+
+Settings CreateSettingsWithDecodedImageCache(Settings settings) {
+  settings.decoded_image_cache_max_bytes = 1024 * 1024;
+  return settings;
+}
+
+}  // namespace
+
+TEST(DecodedImageCacheTest, IsDisabledByDefault) {
+  DecodedImageCache cache;
+  ASSERT_FALSE(cache.IsEnabled());
+
+  auto data = MakeTestData(1);
+  auto key = DecodedImageCache::MakeKey(data, SkISize::Make(10, 10),
+                                        kRGBA_8888_SkColorType);
+  cache.Put(key, data, MakeTestImage(10, 10));
+  ASSERT_EQ(cache.GetEntryCount(), 0u);
+  ASSERT_EQ(cache.Get(key, data), nullptr);
+}
+
+TEST(DecodedImageCacheTest, KeysIncludeTargetSizeAndFormat) {
+  DecodedImageCache cache;
+  cache.SetMaxBytes(1024 * 1024);
+
+  auto data = MakeTestData(1);
+  auto key = DecodedImageCache::MakeKey(data, SkISize::Make(10, 10),
+                                        kRGBA_8888_SkColorType);
+  auto image = MakeTestImage(10, 10);
+  cache.Put(key, data, image);
+
+  // Equal bytes in a different buffer hit.
+  auto same_data = MakeTestData(1);
+  auto same_key = DecodedImageCache::MakeKey(same_data, SkISize::Make(10, 10),
+                                             kRGBA_8888_SkColorType);
+  ASSERT_EQ(cache.Get(same_key, same_data), image);
+
+  auto other_size = DecodedImageCache::MakeKey(data, SkISize::Make(20, 20),
+                                               kRGBA_8888_SkColorType);
+  ASSERT_EQ(cache.Get(other_size, data), nullptr);
+
+  auto other_format = DecodedImageCache::MakeKey(data, SkISize::Make(10, 10),
+                                                 kRGBA_F16_SkColorType);
+  ASSERT_EQ(cache.Get(other_format, data), nullptr);
+
+  auto other_data = MakeTestData(2);
+  auto other_data_key = DecodedImageCache::MakeKey(
+      other_data, SkISize::Make(10, 10), kRGBA_8888_SkColorType);
+  ASSERT_EQ(cache.Get(other_data_key, other_data), nullptr);
+
+  ASSERT_EQ(cache.GetHitCount(), 1u);
+  ASSERT_EQ(cache.GetMissCount(), 3u);
+}
+
+TEST(DecodedImageCacheTest, EvictsLeastRecentlyUsedToFitBudget) {
+  auto image = MakeTestImage(10, 10);
+  auto data_a = MakeTestData(1);
+  auto data_b = MakeTestData(2);
+  auto data_c = MakeTestData(3);
+  const size_t entry_bytes = image->GetApproximateByteSize() + data_a->size();
+
+  DecodedImageCache cache;
+  cache.SetMaxBytes(entry_bytes * 2);
+
+  auto key = [](const sk_sp<SkData>& data) {
+    return DecodedImageCache::MakeKey(data, SkISize::Make(10, 10),
+                                      kRGBA_8888_SkColorType);
+  };
+  cache.Put(key(data_a), data_a, image);
+  cache.Put(key(data_b), data_b, image);
+  ASSERT_EQ(cache.GetCurrentBytes(), entry_bytes * 2);
+
+  // Touch A so that B is the least recently used entry.
+  ASSERT_EQ(cache.Get(key(data_a), data_a), image);
+  cache.Put(key(data_c), data_c, image);
+
+  ASSERT_EQ(cache.GetEntryCount(), 2u);
+  ASSERT_EQ(cache.Get(key(data_a), data_a), image);
+  ASSERT_EQ(cache.Get(key(data_b), data_b), nullptr);
+  ASSERT_EQ(cache.Get(key(data_c), data_c), image);
+
+  // Shrinking the budget evicts immediately.
+  cache.SetMaxBytes(entry_bytes);
+  ASSERT_EQ(cache.GetEntryCount(), 1u);
+  ASSERT_EQ(cache.Get(key(data_c), data_c), image);
+}
+
+TEST(DecodedImageCacheTest, DoesNotCacheImagesLargerThanBudget) {
+  DecodedImageCache cache;
+  cache.SetMaxBytes(16);
+
+  auto data = MakeTestData(1);
+  auto key = DecodedImageCache::MakeKey(data, SkISize::Make(10, 10),
+                                        kRGBA_8888_SkColorType);
+  cache.Put(key, data, MakeTestImage(10, 10));
+  ASSERT_EQ(cache.GetEntryCount(), 0u);
+  ASSERT_EQ(cache.GetCurrentBytes(), 0u);
+}
+
+TEST(DecodedImageCacheTest, ClearDropsAllEntries) {
+  DecodedImageCache cache;
+  cache.SetMaxBytes(1024 * 1024);
+
+  auto data = MakeTestData(1);
+  auto key = DecodedImageCache::MakeKey(data, SkISize::Make(10, 10),
+                                        kRGBA_8888_SkColorType);
+  cache.Put(key, data, MakeTestImage(10, 10));
+  ASSERT_EQ(cache.GetEntryCount(), 1u);
+
+  cache.Clear();
+  ASSERT_EQ(cache.GetEntryCount(), 0u);
+  ASSERT_EQ(cache.GetCurrentBytes(), 0u);
+  ASSERT_EQ(cache.Get(key, data), nullptr);
+}
+
+TEST(DecodedImageCacheTest, TellsApartLargeDataWithCollidingHashes) {
+  DecodedImageCache cache;
+  cache.SetMaxBytes(16 * 1024 * 1024);
+
+  // Large data is only hashed in parts, so a change to a single byte between
+  // them goes unnoticed by the hash.
+  const size_t size = 4 * 1024 * 1024;
+  auto data = MakeTestData(1, size);
+  auto other_data = MakeTestData(1, size);
+  static_cast<uint8_t*>(other_data->writable_data())[size / 2 + 100] = 2;
+  ASSERT_EQ(DecodedImageCache::HashData(*data),
+            DecodedImageCache::HashData(*other_data));
+
+  auto key = DecodedImageCache::MakeKey(data, SkISize::Make(10, 10),
+                                        kRGBA_8888_SkColorType);
+  auto other_key = DecodedImageCache::MakeKey(other_data, SkISize::Make(10, 10),
+                                              kRGBA_8888_SkColorType);
+  ASSERT_EQ(key, other_key);
+
+  auto image = MakeTestImage(10, 10);
+  cache.Put(key, data, image);
+  ASSERT_EQ(cache.Get(key, data), image);
+  ASSERT_EQ(cache.Get(other_key, other_data), nullptr);
+}
+
+TEST_F(ShellTest, DecodedImageCacheIsHitByInstantiateCodec) {
+  auto message_latch = std::make_shared<fml::AutoResetWaitableEvent>();
+  size_t hit_count = 0;
+  size_t miss_count = 0;
+  size_t entry_count = 0;
+
+  auto validate_cache = [&](Dart_NativeArguments args) {
+    auto decoder = UIDartState::Current()->GetImageDecoder();
+    ASSERT_TRUE(decoder);
+    const DecodedImageCache& cache = decoder->GetDecodedImageCache();
+    hit_count = cache.GetHitCount();
+    miss_count = cache.GetMissCount();
+    entry_count = cache.GetEntryCount();
+  };
+  auto finish = [message_latch](Dart_NativeArguments args) {
+    message_latch->Signal();
+  };
+
+  Settings settings =
+      CreateSettingsWithDecodedImageCache(CreateSettingsForFixture());
+  TaskRunners task_runners("test",                  // label
+                           GetCurrentTaskRunner(),  // platform
+                           CreateNewThread(),       // raster
+                           CreateNewThread(),       // ui
+                           CreateNewThread()        // io
+  );
+
+  AddNativeCallback("ValidateDecodedImageCache",
+                    CREATE_NATIVE_ENTRY(validate_cache));
+  AddNativeCallback("Finish", CREATE_NATIVE_ENTRY(finish));
+
+  std::unique_ptr<Shell> shell = CreateShell(settings, task_runners);
+
+  ASSERT_TRUE(shell->IsSetup());
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("decodeSameImageTwice");
+
+  shell->RunEngine(std::move(configuration), [](auto result) {
+    ASSERT_EQ(result, Engine::RunStatus::Success);
+  });
+
+  message_latch->Wait();
+  // The first codec decoded the image and the second one reused it.
+  EXPECT_EQ(miss_count, 1u);
+  EXPECT_EQ(hit_count, 1u);
+  EXPECT_EQ(entry_count, 1u);
+  DestroyShell(std::move(shell), task_runners);
+}
+
+TEST_F(ShellTest, DecodedImageCacheIsClearedOnLowMemory) {
+  auto message_latch = std::make_shared<fml::AutoResetWaitableEvent>();
+
+  auto finish = [message_latch](Dart_NativeArguments args) {
+    message_latch->Signal();
+  };
+
+  Settings settings =
+      CreateSettingsWithDecodedImageCache(CreateSettingsForFixture());
+  TaskRunners task_runners("test",                  // label
+                           GetCurrentTaskRunner(),  // platform
+                           CreateNewThread(),       // raster
+                           CreateNewThread(),       // ui
+                           CreateNewThread()        // io
+  );
+
+  AddNativeCallback("ValidateDecodedImageCache",
+                    CREATE_NATIVE_ENTRY([](Dart_NativeArguments args) {}));
+  AddNativeCallback("Finish", CREATE_NATIVE_ENTRY(finish));
+
+  std::unique_ptr<Shell> shell = CreateShell(settings, task_runners);
+
+  ASSERT_TRUE(shell->IsSetup());
+  auto configuration = RunConfiguration::InferFromSettings(settings);
+  configuration.SetEntrypoint("decodeSameImageTwice");
+
+  shell->RunEngine(std::move(configuration), [](auto result) {
+    ASSERT_EQ(result, Engine::RunStatus::Success);
+  });
+  message_latch->Wait();
+
+  auto get_entry_count = [&shell, &task_runners]() {
+    size_t entry_count = 0;
+    fml::AutoResetWaitableEvent latch;
+    fml::TaskRunner::RunNowOrPostTask(
+        task_runners.GetUITaskRunner(), [&shell, &entry_count, &latch]() {
+          auto decoder = shell->GetEngine()->GetImageDecoderWeakPtr();
+          entry_count = decoder->GetDecodedImageCache().GetEntryCount();
+          latch.Signal();
+        });
+    latch.Wait();
+    return entry_count;
+  };
+
+  ASSERT_EQ(get_entry_count(), 1u);
+  // The warning is handled on the UI task runner before the entry count is
+  // read again.
+  shell->NotifyLowMemoryWarning();
+  ASSERT_EQ(get_entry_count(), 0u);
+
+  DestroyShell(std::move(shell), task_runners);
+}
+
+}  // namespace testing
+}  // namespace flutter
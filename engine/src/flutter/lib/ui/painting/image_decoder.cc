@@ -18,26 +18,34 @@ std::unique_ptr<ImageDecoder> ImageDecoder::Make(
     std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner,
     fml::WeakPtr<IOManager> io_manager,
     const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch) {
+  std::unique_ptr<ImageDecoder> decoder;
 #if IMPELLER_SUPPORTS_RENDERING
   if (settings.enable_impeller) {
-    return std::make_unique<ImageDecoderImpeller>(
+    decoder = std::make_unique<ImageDecoderImpeller>(
         runners,                            //
         std::move(concurrent_task_runner),  //
         std::move(io_manager),              //
         settings.enable_wide_gamut,         //
-        gpu_disabled_switch);
+        gpu_disabled_switch,                //
+        settings.enable_impeller_yuv_image_decoding);
   }
 #endif  // IMPELLER_SUPPORTS_RENDERING
 #if !SLIMPELLER
-  return std::make_unique<ImageDecoderSkia>(
-      runners,                            //
-      std::move(concurrent_task_runner),  //
-      std::move(io_manager)               //
-  );
-#else   //  !SLIMPELLER
-  FML_LOG(FATAL) << "Could not setup an image decoder.";
-  return nullptr;
+  if (!decoder) {
+    decoder = std::make_unique<ImageDecoderSkia>(
+        runners,                            //
+        std::move(concurrent_task_runner),  //
+        std::move(io_manager)               //
+    );
+  }
 #endif  //  !SLIMPELLER
+  if (!decoder) {
+    FML_LOG(FATAL) << "Could not setup an image decoder.";
+    return nullptr;
+  }
+  decoder->GetDecodedImageCache().SetMaxBytes(
+      settings.decoded_image_cache_max_bytes);
+  return decoder;
 }
 
 ImageDecoder::ImageDecoder(
@@ -10,8 +10,10 @@
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
 #include "flutter/display_list/image/dl_image.h"
+#include "flutter/flow/frame_phase_profiler.h"
 #include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/lib/ui/io_manager.h"
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
 #include "flutter/lib/ui/painting/image_descriptor.h"
 
 namespace flutter {
@@ -46,10 +48,21 @@ class ImageDecoder {
 
   fml::WeakPtr<ImageDecoder> GetWeakPtr() const;
 
+  // The cache of images decoded by this decoder, consulted when codecs are
+  // instantiated. Its budget is `Settings::decoded_image_cache_max_bytes`.
+  DecodedImageCache& GetDecodedImageCache() { return decoded_image_cache_; }
+
+  // Sets the profiler that records the durations of the texture uploads of
+  // this decoder. Must be called before the first image is decoded.
+  void SetFramePhaseProfiler(std::shared_ptr<FramePhaseProfiler> profiler) {
+    frame_phase_profiler_ = std::move(profiler);
+  }
+
  protected:
   TaskRunners runners_;
   std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner_;
   fml::WeakPtr<IOManager> io_manager_;
+  std::shared_ptr<FramePhaseProfiler> frame_phase_profiler_;
 
   ImageDecoder(
       const TaskRunners& runners,
@@ -57,6 +70,7 @@ class ImageDecoder {
       fml::WeakPtr<IOManager> io_manager);
 
  private:
+  DecodedImageCache decoded_image_cache_;
   fml::WeakPtrFactory<ImageDecoder> weak_factory_;
 
   FML_DISALLOW_COPY_AND_ASSIGN(ImageDecoder);
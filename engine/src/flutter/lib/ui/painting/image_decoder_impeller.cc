@@ -4,20 +4,26 @@
 
 #include "flutter/lib/ui/painting/image_decoder_impeller.h"
 
+#include <cstring>
 #include <memory>
+#include <vector>
 
+#include "flutter/flow/frame_phase_profiler.h"
 #include "flutter/fml/closure.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/impeller/core/allocator.h"
 #include "flutter/impeller/display_list/dl_image_impeller.h"
+#include "flutter/impeller/renderer/blit_pass.h"
 #include "flutter/impeller/renderer/command_buffer.h"
 #include "flutter/impeller/renderer/context.h"
 #include "impeller/base/strings.h"
 #include "impeller/core/device_buffer.h"
 #include "impeller/core/formats.h"
+#include "impeller/core/texture.h"
 #include "impeller/core/texture_descriptor.h"
 #include "impeller/display_list/skia_conversions.h"
+#include "impeller/geometry/rect.h"
 #include "impeller/geometry/size.h"
 #include "third_party/skia/include/core/SkAlphaType.h"
 #include "third_party/skia/include/core/SkBitmap.h"
@@ -29,6 +35,8 @@
 #include "third_party/skia/include/core/SkPixmap.h"
 #include "third_party/skia/include/core/SkPoint.h"
 #include "third_party/skia/include/core/SkSize.h"
+#include "third_party/skia/include/core/SkYUVAInfo.h"
+#include "third_party/skia/include/core/SkYUVAPixmaps.h"
 
 namespace flutter {
 
@@ -74,6 +82,276 @@ bool IsWideGamut(const SkColorSpace* color_space) {
   float area = CalculateArea(rgb);
   return area > kSrgbGamutArea;
 }
+
+// Images whose decoded size is at least this large are decoded and uploaded
+// in chunks of rows when the generator supports it, instead of materializing
+// the whole decoded image in host memory first.
+static constexpr size_t kStreamingDecodeMinBytes = 4 * 1024 * 1024;
+
+// The target size of the host visible staging buffer used for each chunk of
+// rows in a streaming decode.
+static constexpr size_t kStreamingDecodeChunkBytes = 1024 * 1024;
+
+/**
+ *  Creates the device private destination texture for an image upload.
+ */
+std::shared_ptr<impeller::Texture> CreatePrivateTexture(
+    const std::shared_ptr<impeller::Context>& context,
+    impeller::PixelFormat pixel_format,
+    const SkImageInfo& image_info,
+    const std::optional<SkImageInfo>& resize_info) {
+  impeller::TextureDescriptor texture_descriptor;
+  texture_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
+  texture_descriptor.format = pixel_format;
+  texture_descriptor.size = {image_info.width(), image_info.height()};
+  texture_descriptor.mip_count = texture_descriptor.size.MipCount();
+  texture_descriptor.compression_type = impeller::CompressionType::kLossy;
+  if (resize_info.has_value()) {
+    // This texture is only the source of a resize on the GPU, which reads the
+    // base level on all backends, and the resized texture gets its own mips.
+    texture_descriptor.mip_count = 1;
+  }
+
+  auto dest_texture =
+      context->GetResourceAllocator()->CreateTexture(texture_descriptor);
+  if (!dest_texture) {
+    return nullptr;
+  }
+  dest_texture->SetLabel(
+      impeller::SPrintF("ui.Image(%p)", dest_texture.get()).c_str());
+  return dest_texture;
+}
+
+/**
+ *  Records mipmap generation for an uploaded texture and, if requested, a
+ *  resize into a new texture. Returns the texture that backs the image.
+ */
+std::pair<std::shared_ptr<impeller::Texture>, std::string>
+EncodeMipmapsAndResize(const std::shared_ptr<impeller::Context>& context,
+                       impeller::BlitPass& blit_pass,
+                       const std::shared_ptr<impeller::Texture>& dest_texture,
+                       impeller::PixelFormat pixel_format,
+                       const std::optional<SkImageInfo>& resize_info) {
+  if (dest_texture->GetTextureDescriptor().mip_count > 1) {
+    blit_pass.GenerateMipmap(dest_texture);
+  }
+
+  if (!resize_info.has_value()) {
+    return std::make_pair(dest_texture, std::string());
+  }
+
+  impeller::TextureDescriptor resize_desc;
+  resize_desc.storage_mode = impeller::StorageMode::kDevicePrivate;
+  resize_desc.format = pixel_format;
+  resize_desc.size = {resize_info->width(), resize_info->height()};
+  resize_desc.mip_count = resize_desc.size.MipCount();
+  resize_desc.compression_type = impeller::CompressionType::kLossy;
+  resize_desc.usage = impeller::TextureUsage::kShaderRead;
+  if (context->GetBackendType() == impeller::Context::BackendType::kMetal) {
+    // Resizing requires a MPS on Metal platforms.
+    resize_desc.usage |= impeller::TextureUsage::kShaderWrite;
+    resize_desc.compression_type = impeller::CompressionType::kLossless;
+  }
+
+  auto resize_texture =
+      context->GetResourceAllocator()->CreateTexture(resize_desc);
+  if (!resize_texture) {
+    std::string decode_error("Could not create resized Impeller texture.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+
+  blit_pass.ResizeTexture(/*source=*/dest_texture,
+                          /*destination=*/resize_texture);
+  if (resize_desc.mip_count > 1) {
+    blit_pass.GenerateMipmap(resize_texture);
+  }
+  return std::make_pair(std::move(resize_texture), std::string());
+}
+
+/**
+ *  Finishes a streaming upload into |dest_texture|. Copies |rows|, if any,
+ *  into the rows of the texture starting at |first_row|, then generates
+ *  mipmaps and resizes. Only call this if the GPU is available.
+ */
+std::pair<sk_sp<DlImage>, std::string> UnsafeFinishStreamedUpload(
+    const std::shared_ptr<impeller::Context>& context,
+    const std::shared_ptr<impeller::Texture>& dest_texture,
+    const std::shared_ptr<impeller::DeviceBuffer>& rows,
+    int first_row,
+    impeller::PixelFormat pixel_format,
+    const std::optional<SkImageInfo>& resize_info) {
+  auto command_buffer = context->CreateCommandBuffer();
+  if (!command_buffer) {
+    std::string decode_error(
+        "Could not create command buffer for mipmap generation.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  command_buffer->SetLabel("Mipmap Command Buffer");
+  auto blit_pass = command_buffer->CreateBlitPass();
+  if (!blit_pass) {
+    std::string decode_error(
+        "Could not create blit pass for mipmap generation.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  blit_pass->SetLabel("Mipmap Blit Pass");
+  if (rows) {
+    const impeller::ISize size = dest_texture->GetSize();
+    blit_pass->AddCopy(
+        impeller::DeviceBuffer::AsBufferView(rows), dest_texture,
+        impeller::IRect::MakeXYWH(0, first_row, size.width,
+                                  size.height - first_row));
+  }
+  auto [result_texture, resize_error] = EncodeMipmapsAndResize(
+      context, *blit_pass, dest_texture, pixel_format, resize_info);
+  if (!result_texture) {
+    return std::make_pair(nullptr, resize_error);
+  }
+  blit_pass->EncodeCommands(context->GetResourceAllocator());
+  if (!context->GetCommandQueue()->Submit({command_buffer}).ok()) {
+    std::string decode_error("Failed to submit image decoding command buffer.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  context->DisposeThreadLocalCachedResources();
+  return std::make_pair(
+      impeller::DlImageImpeller::Make(std::move(result_texture)),
+      std::string());
+}
+
+/**
+ *  Finishes a streaming upload into |dest_texture| as soon as the GPU is
+ *  available, and invokes |result| with the image. Like
+ *  `ImageDecoderImpeller::UploadTextureToPrivate`, the upload is deferred
+ *  until GPU access is restored if it is currently disabled.
+ */
+void FinishStreamedUpload(
+    const ImageDecoder::ImageResult& result,
+    const std::shared_ptr<impeller::Context>& context,
+    const std::shared_ptr<impeller::Texture>& dest_texture,
+    const std::shared_ptr<impeller::DeviceBuffer>& rows,
+    int first_row,
+    impeller::PixelFormat pixel_format,
+    const std::optional<SkImageInfo>& resize_info,
+    const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch) {
+  gpu_disabled_switch->Execute(
+      fml::SyncSwitch::Handlers()
+          .SetIfFalse([&] {
+            auto [image, decode_error] = UnsafeFinishStreamedUpload(
+                context, dest_texture, rows, first_row, pixel_format,
+                resize_info);
+            result(image, decode_error);
+          })
+          .SetIfTrue([&] {
+            context->StoreTaskForGPU(
+                [result, context, dest_texture, rows, first_row, pixel_format,
+                 resize_info]() {
+                  auto [image, decode_error] = UnsafeFinishStreamedUpload(
+                      context, dest_texture, rows, first_row, pixel_format,
+                      resize_info);
+                  result(image, decode_error);
+                },
+                [result]() {
+                  result(nullptr,
+                         "Image upload failed due to loss of GPU access.");
+                });
+          }));
+}
+
+/**
+ *  Uploads the luma and interleaved chroma planes in |y_buffer| and
+ *  |uv_buffer|, converts them to RGB with |converter|, then generates mipmaps
+ *  and resizes, all in a single command buffer. Only call this if the GPU is
+ *  available.
+ */
+std::pair<sk_sp<DlImage>, std::string> UnsafeConvertYUVToPrivate(
+    const std::shared_ptr<impeller::Context>& context,
+    const std::shared_ptr<YUVToRGBConverterImpeller>& converter,
+    const std::shared_ptr<impeller::DeviceBuffer>& y_buffer,
+    impeller::ISize y_size,
+    const std::shared_ptr<impeller::DeviceBuffer>& uv_buffer,
+    impeller::ISize uv_size,
+    impeller::YUVColorSpace yuv_color_space,
+    const std::optional<SkImageInfo>& resize_info) {
+  impeller::TextureDescriptor y_descriptor;
+  y_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
+  y_descriptor.format = impeller::PixelFormat::kR8UNormInt;
+  y_descriptor.size = y_size;
+  impeller::TextureDescriptor uv_descriptor = y_descriptor;
+  uv_descriptor.format = impeller::PixelFormat::kR8G8UNormInt;
+  uv_descriptor.size = uv_size;
+  auto y_texture = context->GetResourceAllocator()->CreateTexture(y_descriptor);
+  auto uv_texture =
+      context->GetResourceAllocator()->CreateTexture(uv_descriptor);
+  if (!y_texture || !uv_texture) {
+    std::string decode_error("Could not create Impeller YUV plane textures.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  y_texture->SetLabel("ui.Image Y Plane");
+  uv_texture->SetLabel("ui.Image UV Plane");
+
+  auto command_buffer = context->CreateCommandBuffer();
+  if (!command_buffer) {
+    std::string decode_error(
+        "Could not create command buffer for image upload.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  command_buffer->SetLabel("YUV Image Command Buffer");
+
+  auto upload_pass = command_buffer->CreateBlitPass();
+  if (!upload_pass) {
+    std::string decode_error("Could not create blit pass for image upload.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  upload_pass->SetLabel("YUV Plane Upload Blit Pass");
+  upload_pass->AddCopy(impeller::DeviceBuffer::AsBufferView(y_buffer),
+                       y_texture);
+  upload_pass->AddCopy(impeller::DeviceBuffer::AsBufferView(uv_buffer),
+                       uv_texture);
+  upload_pass->EncodeCommands(context->GetResourceAllocator());
+
+  // As in `CreatePrivateTexture`, the source of a resize doesn't need mips.
+  const size_t mip_count = resize_info.has_value() ? 1 : y_size.MipCount();
+  auto rgb_texture =
+      converter->EncodeConversion(context, *command_buffer, y_texture,
+                                  uv_texture, yuv_color_space, mip_count);
+  if (!rgb_texture) {
+    std::string decode_error("Could not convert YUV planes to RGB.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+
+  auto blit_pass = command_buffer->CreateBlitPass();
+  if (!blit_pass) {
+    std::string decode_error(
+        "Could not create blit pass for mipmap generation.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  blit_pass->SetLabel("Mipmap Blit Pass");
+  auto [result_texture, resize_error] = EncodeMipmapsAndResize(
+      context, *blit_pass, rgb_texture,
+      rgb_texture->GetTextureDescriptor().format, resize_info);
+  if (!result_texture) {
+    return std::make_pair(nullptr, resize_error);
+  }
+  blit_pass->EncodeCommands(context->GetResourceAllocator());
+
+  if (!context->GetCommandQueue()->Submit({command_buffer}).ok()) {
+    std::string decode_error("Failed to submit image decoding command buffer.");
+    FML_DLOG(ERROR) << decode_error;
+    return std::make_pair(nullptr, decode_error);
+  }
+  context->DisposeThreadLocalCachedResources();
+  return std::make_pair(
+      impeller::DlImageImpeller::Make(std::move(result_texture)),
+      std::string());
+}
 }  // namespace
 
 ImageDecoderImpeller::ImageDecoderImpeller(
@@ -81,10 +359,14 @@ ImageDecoderImpeller::ImageDecoderImpeller(
     std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner,
     const fml::WeakPtr<IOManager>& io_manager,
     bool supports_wide_gamut,
-    const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch)
+    const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch,
+    bool enable_yuv_decoding)
     : ImageDecoder(runners, std::move(concurrent_task_runner), io_manager),
       supports_wide_gamut_(supports_wide_gamut),
-      gpu_disabled_switch_(gpu_disabled_switch) {
+      gpu_disabled_switch_(gpu_disabled_switch),
+      yuv_converter_(enable_yuv_decoding
+                         ? std::make_shared<YUVToRGBConverterImpeller>()
+                         : nullptr) {
   std::promise<std::shared_ptr<impeller::Context>> context_promise;
   context_ = context_promise.get_future();
   runners_.GetIOTaskRunner()->PostTask(fml::MakeCopyable(
@@ -287,6 +569,7 @@ ImageDecoderImpeller::UnsafeUploadTextureToPrivate(
     const std::shared_ptr<impeller::DeviceBuffer>& buffer,
     const SkImageInfo& image_info,
     const std::optional<SkImageInfo>& resize_info) {
+  FramePhaseProfiler::ScopedPhase phase(FramePhase::kImageUpload);
   const auto pixel_format =
       impeller::skia_conversions::ToPixelFormat(image_info.colorType());
   if (!pixel_format) {
@@ -296,30 +579,14 @@ ImageDecoderImpeller::UnsafeUploadTextureToPrivate(
     return std::make_pair(nullptr, decode_error);
   }
 
-  impeller::TextureDescriptor texture_descriptor;
-  texture_descriptor.storage_mode = impeller::StorageMode::kDevicePrivate;
-  texture_descriptor.format = pixel_format.value();
-  texture_descriptor.size = {image_info.width(), image_info.height()};
-  texture_descriptor.mip_count = texture_descriptor.size.MipCount();
-  texture_descriptor.compression_type = impeller::CompressionType::kLossy;
-  if (context->GetBackendType() == impeller::Context::BackendType::kMetal &&
-      resize_info.has_value()) {
-    // The MPS used to resize images on iOS does not require mip generation.
-    // Remove mip count if we are resizing the image on the GPU.
-    texture_descriptor.mip_count = 1;
-  }
-
-  auto dest_texture =
-      context->GetResourceAllocator()->CreateTexture(texture_descriptor);
+  auto dest_texture = CreatePrivateTexture(context, pixel_format.value(),
+                                           image_info, resize_info);
   if (!dest_texture) {
     std::string decode_error("Could not create Impeller texture.");
     FML_DLOG(ERROR) << decode_error;
     return std::make_pair(nullptr, decode_error);
   }
 
-  dest_texture->SetLabel(
-      impeller::SPrintF("ui.Image(%p)", dest_texture.get()).c_str());
-
   auto command_buffer = context->CreateCommandBuffer();
   if (!command_buffer) {
     std::string decode_error(
@@ -339,40 +606,11 @@ ImageDecoderImpeller::UnsafeUploadTextureToPrivate(
   blit_pass->SetLabel("Mipmap Blit Pass");
   blit_pass->AddCopy(impeller::DeviceBuffer::AsBufferView(buffer),
                      dest_texture);
-  if (texture_descriptor.mip_count > 1) {
-    blit_pass->GenerateMipmap(dest_texture);
-  }
 
-  std::shared_ptr<impeller::Texture> result_texture = dest_texture;
-  if (resize_info.has_value()) {
-    impeller::TextureDescriptor resize_desc;
-    resize_desc.storage_mode = impeller::StorageMode::kDevicePrivate;
-    resize_desc.format = pixel_format.value();
-    resize_desc.size = {resize_info->width(), resize_info->height()};
-    resize_desc.mip_count = resize_desc.size.MipCount();
-    resize_desc.compression_type = impeller::CompressionType::kLossy;
-    resize_desc.usage = impeller::TextureUsage::kShaderRead;
-    if (context->GetBackendType() == impeller::Context::BackendType::kMetal) {
-      // Resizing requires a MPS on Metal platforms.
-      resize_desc.usage |= impeller::TextureUsage::kShaderWrite;
-      resize_desc.compression_type = impeller::CompressionType::kLossless;
-    }
-
-    auto resize_texture =
-        context->GetResourceAllocator()->CreateTexture(resize_desc);
-    if (!resize_texture) {
-      std::string decode_error("Could not create resized Impeller texture.");
-      FML_DLOG(ERROR) << decode_error;
-      return std::make_pair(nullptr, decode_error);
-    }
-
-    blit_pass->ResizeTexture(/*source=*/dest_texture,
-                             /*destination=*/resize_texture);
-    if (resize_desc.mip_count > 1) {
-      blit_pass->GenerateMipmap(resize_texture);
-    }
-
-    result_texture = std::move(resize_texture);
+  auto [result_texture, resize_error] = EncodeMipmapsAndResize(
+      context, *blit_pass, dest_texture, pixel_format.value(), resize_info);
+  if (!result_texture) {
+    return std::make_pair(nullptr, resize_error);
   }
   blit_pass->EncodeCommands(context->GetResourceAllocator());
 
@@ -389,6 +627,358 @@ ImageDecoderImpeller::UnsafeUploadTextureToPrivate(
       std::string());
 }
 
+// static
+bool ImageDecoderImpeller::DecompressAndStreamToPrivate(
+    const ImageResult& result,
+    ImageDescriptor* descriptor,
+    SkISize target_size,
+    const std::shared_ptr<impeller::Context>& context,
+    bool supports_wide_gamut,
+    const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch) {
+  if (!descriptor || !descriptor->is_compressed() || !context) {
+    return false;
+  }
+
+  // The I/O image uploads are not threadsafe on GLES, so chunks can't be
+  // uploaded from the thread doing the decode.
+  if (context->GetBackendType() == impeller::Context::BackendType::kOpenGLES) {
+    return false;
+  }
+
+  const auto base_image_info = descriptor->image_info();
+  if (supports_wide_gamut && IsWideGamut(base_image_info.colorSpace())) {
+    return false;
+  }
+
+  // Images that exceed the max texture size need the slow CPU resize in
+  // `DecompressTexture`, which requires the whole decoded image.
+  const auto max_texture_size =
+      context->GetResourceAllocator()->GetMaxTextureSizeSupported();
+  const SkISize source_size = base_image_info.dimensions();
+  if (source_size.width() > max_texture_size.width ||
+      source_size.height() > max_texture_size.height) {
+    return false;
+  }
+
+  const auto decode_size = descriptor->get_scaled_dimensions(std::max(
+      static_cast<float>(target_size.width()) / source_size.width(),
+      static_cast<float>(target_size.height()) / source_size.height()));
+
+  // Row decoding can premultiply as it goes, so there is no need for a
+  // separate premultiplication pass.
+  SkAlphaType alpha_type = base_image_info.alphaType();
+  if (alpha_type == SkAlphaType::kUnpremul_SkAlphaType) {
+    alpha_type = SkAlphaType::kPremul_SkAlphaType;
+  }
+  const auto image_info =
+      base_image_info.makeWH(decode_size.width(), decode_size.height())
+          .makeColorType(ChooseCompatibleColorType(base_image_info.colorType()))
+          .makeAlphaType(alpha_type);
+  if (image_info.computeMinByteSize() < kStreamingDecodeMinBytes) {
+    return false;
+  }
+
+  const auto pixel_format =
+      impeller::skia_conversions::ToPixelFormat(image_info.colorType());
+  if (!pixel_format.has_value()) {
+    return false;
+  }
+
+  bool gpu_available = false;
+  gpu_disabled_switch->Execute(fml::SyncSwitch::Handlers().SetIfFalse(
+      [&gpu_available] { gpu_available = true; }));
+  if (!gpu_available || !descriptor->start_row_decode(image_info)) {
+    return false;
+  }
+
+  //----------------------------------------------------------------------------
+  /// From here on the generator is committed to the row decode, so failures
+  /// are reported as errors instead of falling back.
+  ///
+  TRACE_EVENT0("impeller", __FUNCTION__);
+
+  std::optional<SkImageInfo> resize_info =
+      decode_size == target_size
+          ? std::nullopt
+          : std::optional<SkImageInfo>(image_info.makeDimensions(target_size));
+
+  auto dest_texture = CreatePrivateTexture(context, pixel_format.value(),
+                                           image_info, resize_info);
+  if (!dest_texture) {
+    std::string decode_error("Could not create Impeller texture.");
+    FML_DLOG(ERROR) << decode_error;
+    result(nullptr, decode_error);
+    return true;
+  }
+
+  const size_t row_bytes = image_info.minRowBytes();
+  const int rows_per_chunk = static_cast<int>(
+      std::max<size_t>(1u, kStreamingDecodeChunkBytes / row_bytes));
+  auto create_rows_buffer = [&context, row_bytes](int row_count) {
+    impeller::DeviceBufferDescriptor buffer_descriptor;
+    buffer_descriptor.storage_mode = impeller::StorageMode::kHostVisible;
+    buffer_descriptor.size = row_count * row_bytes;
+    return context->GetResourceAllocator()->CreateBuffer(buffer_descriptor);
+  };
+  auto fail = [&result](const std::string& decode_error) {
+    FML_DLOG(ERROR) << decode_error;
+    result(nullptr, decode_error);
+    return true;
+  };
+
+  for (int row = 0; row < image_info.height(); row += rows_per_chunk) {
+    const int chunk_rows = std::min(rows_per_chunk, image_info.height() - row);
+
+    // Each chunk gets its own staging buffer, which is released as soon as
+    // the GPU is done copying out of it.
+    auto buffer = create_rows_buffer(chunk_rows);
+    if (!buffer) {
+      return fail("Could not allocate intermediate for image decompression.");
+    }
+
+    {
+      TRACE_EVENT0("impeller", "DecodeRows");
+      if (descriptor->get_rows(buffer->OnGetContents(), row_bytes,
+                               chunk_rows) != chunk_rows) {
+        return fail("Could not decompress image.");
+      }
+    }
+    buffer->Flush();
+
+    std::string upload_error;
+    bool gpu_lost = false;
+    gpu_disabled_switch->Execute(
+        fml::SyncSwitch::Handlers()
+            .SetIfFalse([&]() {
+              auto command_buffer = context->CreateCommandBuffer();
+              if (!command_buffer) {
+                upload_error =
+                    "Could not create command buffer for image upload.";
+                return;
+              }
+              command_buffer->SetLabel("Streaming Upload Command Buffer");
+              auto blit_pass = command_buffer->CreateBlitPass();
+              if (!blit_pass) {
+                upload_error = "Could not create blit pass for image upload.";
+                return;
+              }
+              blit_pass->AddCopy(
+                  impeller::DeviceBuffer::AsBufferView(buffer), dest_texture,
+                  impeller::IRect::MakeXYWH(0, row, image_info.width(),
+                                            chunk_rows));
+              blit_pass->EncodeCommands(context->GetResourceAllocator());
+              if (!context->GetCommandQueue()->Submit({command_buffer}).ok()) {
+                upload_error =
+                    "Failed to submit image decoding command buffer.";
+              }
+            })
+            .SetIfTrue([&gpu_lost]() { gpu_lost = true; }));
+    if (!upload_error.empty()) {
+      return fail(upload_error);
+    }
+    if (!gpu_lost) {
+      continue;
+    }
+
+    // GPU access was lost part way through the image. Decode the rows that
+    // are left into a single buffer, and upload them along with the mipmaps
+    // once access is restored.
+    const int remaining_rows = image_info.height() - row;
+    auto remaining = create_rows_buffer(remaining_rows);
+    if (!remaining) {
+      return fail("Could not allocate intermediate for image decompression.");
+    }
+    uint8_t* remaining_contents = remaining->OnGetContents();
+    memcpy(remaining_contents, buffer->OnGetContents(), chunk_rows * row_bytes);
+    buffer.reset();
+    if (remaining_rows > chunk_rows) {
+      TRACE_EVENT0("impeller", "DecodeRows");
+      if (descriptor->get_rows(remaining_contents + chunk_rows * row_bytes,
+                               row_bytes, remaining_rows - chunk_rows) !=
+          remaining_rows - chunk_rows) {
+        return fail("Could not decompress image.");
+      }
+    }
+    remaining->Flush();
+    FinishStreamedUpload(result, context, dest_texture, remaining, row,
+                         pixel_format.value(), resize_info,
+                         gpu_disabled_switch);
+    return true;
+  }
+
+  //----------------------------------------------------------------------------
+  /// All rows are resident on the GPU, finish up with mipmaps and resizing.
+  ///
+  FinishStreamedUpload(result, context, dest_texture, nullptr, 0,
+                       pixel_format.value(), resize_info, gpu_disabled_switch);
+  return true;
+}
+
+// static
+bool ImageDecoderImpeller::DecompressYUVAndConvertToPrivate(
+    const ImageResult& result,
+    ImageDescriptor* descriptor,
+    SkISize target_size,
+    const std::shared_ptr<impeller::Context>& context,
+    const std::shared_ptr<YUVToRGBConverterImpeller>& converter,
+    const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch) {
+  if (!converter || !descriptor || !descriptor->is_compressed() || !context) {
+    return false;
+  }
+
+  // The I/O image uploads are not threadsafe on GLES, and the GLES backend
+  // can't sample from the R8 and RG8 plane textures on all devices.
+  if (context->GetBackendType() == impeller::Context::BackendType::kOpenGLES) {
+    return false;
+  }
+
+  // The planes are not color managed, so only images that are already sRGB
+  // can skip the RGB decode.
+  const auto base_image_info = descriptor->image_info();
+  if (base_image_info.colorSpace() && !base_image_info.colorSpace()->isSRGB()) {
+    return false;
+  }
+
+  const auto max_texture_size =
+      context->GetResourceAllocator()->GetMaxTextureSizeSupported();
+  const SkISize source_size = base_image_info.dimensions();
+  if (source_size.width() > max_texture_size.width ||
+      source_size.height() > max_texture_size.height) {
+    return false;
+  }
+
+  // The planes are always decoded at full size. Leave images that the RGB
+  // decode can scale down while decoding to that path, since it is cheaper
+  // than a full size planar decode and a GPU resize.
+  const auto decode_size = descriptor->get_scaled_dimensions(std::max(
+      static_cast<float>(target_size.width()) / source_size.width(),
+      static_cast<float>(target_size.height()) / source_size.height()));
+  if (decode_size != source_size) {
+    return false;
+  }
+
+  SkYUVAPixmapInfo::SupportedDataTypes supported_data_types;
+  supported_data_types.enableDataType(SkYUVAPixmapInfo::DataType::kUnorm8, 1);
+  SkYUVAPixmapInfo yuva_pixmap_info;
+  if (!descriptor->query_yuva_info(supported_data_types, &yuva_pixmap_info)) {
+    return false;
+  }
+  const SkYUVAInfo& yuva_info = yuva_pixmap_info.yuvaInfo();
+  if (yuva_info.planeConfig() != SkYUVAInfo::PlaneConfig::kY_U_V ||
+      yuva_pixmap_info.dataType() != SkYUVAPixmapInfo::DataType::kUnorm8 ||
+      yuva_info.dimensions() != source_size) {
+    return false;
+  }
+  impeller::YUVColorSpace yuv_color_space;
+  switch (yuva_info.yuvColorSpace()) {
+    case kJPEG_Full_SkYUVColorSpace:
+      yuv_color_space = impeller::YUVColorSpace::kBT601FullRange;
+      break;
+    case kRec601_Limited_SkYUVColorSpace:
+      yuv_color_space = impeller::YUVColorSpace::kBT601LimitedRange;
+      break;
+    default:
+      return false;
+  }
+
+  TRACE_EVENT0("impeller", __FUNCTION__);
+
+  //----------------------------------------------------------------------------
+  /// 1. Decode the planes. The luma plane is decoded straight into its staging
+  ///    buffer, the chroma planes are interleaved into a single RG plane.
+  ///
+  const SkImageInfo y_info = yuva_pixmap_info.planeInfo(0);
+  const SkImageInfo u_info = yuva_pixmap_info.planeInfo(1);
+  const SkImageInfo v_info = yuva_pixmap_info.planeInfo(2);
+  if (u_info.dimensions() != v_info.dimensions()) {
+    return false;
+  }
+
+  impeller::DeviceBufferDescriptor y_buffer_descriptor;
+  y_buffer_descriptor.storage_mode = impeller::StorageMode::kHostVisible;
+  y_buffer_descriptor.size = y_info.computeMinByteSize();
+  auto y_buffer =
+      context->GetResourceAllocator()->CreateBuffer(y_buffer_descriptor);
+
+  impeller::DeviceBufferDescriptor uv_buffer_descriptor;
+  uv_buffer_descriptor.storage_mode = impeller::StorageMode::kHostVisible;
+  uv_buffer_descriptor.size = u_info.computeMinByteSize() * 2;
+  auto uv_buffer =
+      context->GetResourceAllocator()->CreateBuffer(uv_buffer_descriptor);
+  if (!y_buffer || !uv_buffer) {
+    std::string decode_error(
+        "Could not allocate intermediates for YUV image decompression.");
+    FML_DLOG(ERROR) << decode_error;
+    result(nullptr, decode_error);
+    return true;
+  }
+
+  std::vector<uint8_t> chroma(u_info.computeMinByteSize() +
+                              v_info.computeMinByteSize());
+  SkPixmap planes[SkYUVAInfo::kMaxPlanes];
+  planes[0] = SkPixmap(y_info, y_buffer->OnGetContents(), y_info.minRowBytes());
+  planes[1] = SkPixmap(u_info, chroma.data(), u_info.minRowBytes());
+  planes[2] = SkPixmap(v_info, chroma.data() + u_info.computeMinByteSize(),
+                       v_info.minRowBytes());
+  if (!descriptor->get_yuva_planes(
+          SkYUVAPixmaps::FromExternalPixmaps(yuva_info, planes))) {
+    std::string decode_error("Could not decompress image to YUV planes.");
+    FML_DLOG(ERROR) << decode_error;
+    result(nullptr, decode_error);
+    return true;
+  }
+
+  {
+    TRACE_EVENT0("impeller", "InterleaveChromaPlanes");
+    auto* uv = reinterpret_cast<uint8_t*>(uv_buffer->OnGetContents());
+    const uint8_t* u = planes[1].addr8();
+    const uint8_t* v = planes[2].addr8();
+    const size_t chroma_pixels = u_info.width() * u_info.height();
+    for (size_t i = 0; i < chroma_pixels; i++) {
+      uv[2 * i] = u[i];
+      uv[2 * i + 1] = v[i];
+    }
+  }
+  y_buffer->Flush();
+  uv_buffer->Flush();
+
+  //----------------------------------------------------------------------------
+  /// 2. Upload the planes, convert them to RGB, and finish up with mipmaps and
+  ///    resizing, once the GPU is available.
+  ///
+  std::optional<SkImageInfo> resize_info =
+      source_size == target_size
+          ? std::nullopt
+          : std::optional<SkImageInfo>(base_image_info.makeDimensions(
+                target_size));
+
+  const impeller::ISize y_size(y_info.width(), y_info.height());
+  const impeller::ISize uv_size(u_info.width(), u_info.height());
+  gpu_disabled_switch->Execute(
+      fml::SyncSwitch::Handlers()
+          .SetIfFalse([&] {
+            auto [image, decode_error] = UnsafeConvertYUVToPrivate(
+                context, converter, y_buffer, y_size, uv_buffer, uv_size,
+                yuv_color_space, resize_info);
+            result(image, decode_error);
+          })
+          .SetIfTrue([&] {
+            context->StoreTaskForGPU(
+                [result, context, converter, y_buffer, y_size, uv_buffer,
+                 uv_size, yuv_color_space, resize_info]() {
+                  auto [image, decode_error] = UnsafeConvertYUVToPrivate(
+                      context, converter, y_buffer, y_size, uv_buffer,
+                      uv_size, yuv_color_space, resize_info);
+                  result(image, decode_error);
+                },
+                [result]() {
+                  result(nullptr,
+                         "Image upload failed due to loss of GPU access.");
+                });
+          }));
+  return true;
+}
+
 void ImageDecoderImpeller::UploadTextureToPrivate(
     ImageResult result,
     const std::shared_ptr<impeller::Context>& context,
@@ -443,6 +1033,7 @@ ImageDecoderImpeller::UploadTextureToStorage(
     const std::shared_ptr<impeller::Context>& context,
     std::shared_ptr<SkBitmap> bitmap) {
   TRACE_EVENT0("impeller", __FUNCTION__);
+  FramePhaseProfiler::ScopedPhase phase(FramePhase::kImageUpload);
   if (!context) {
     return std::make_pair(nullptr, "No Impeller context is available");
   }
@@ -518,13 +1109,41 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
        io_runner = runners_.GetIOTaskRunner(),                    //
        result,
        supports_wide_gamut = supports_wide_gamut_,  //
-       gpu_disabled_switch = gpu_disabled_switch_]() {
+       gpu_disabled_switch = gpu_disabled_switch_,  //
+       yuv_converter = yuv_converter_,              //
+       profiler = frame_phase_profiler_]() {
+        // Uploads that are deferred until GPU access is restored are not
+        // recorded.
+        FramePhaseProfiler::ScopedCurrent current_profiler(profiler.get());
         if (!context) {
           result(nullptr, "No Impeller context is available");
           return;
         }
         auto max_size_supported =
             context->GetResourceAllocator()->GetMaxTextureSizeSupported();
+        const auto clamped_target_size = SkISize::Make(
+            std::min(static_cast<int32_t>(max_size_supported.width),
+                     target_size.width()),
+            std::min(static_cast<int32_t>(max_size_supported.height),
+                     target_size.height()));
+
+        // When enabled, JPEGs are uploaded as YUV planes and converted to RGB
+        // on the GPU.
+        if (DecompressYUVAndConvertToPrivate(result, raw_descriptor,
+                                             clamped_target_size, context,
+                                             yuv_converter,
+                                             gpu_disabled_switch)) {
+          return;
+        }
+
+        // Large images are decoded and uploaded a few rows at a time when
+        // possible so the decoded image is never fully resident on the host.
+        if (DecompressAndStreamToPrivate(result, raw_descriptor,
+                                         clamped_target_size, context,
+                                         supports_wide_gamut,
+                                         gpu_disabled_switch)) {
+          return;
+        }
 
         // Always decompress on the concurrent runner.
         auto bitmap_result = DecompressTexture(
@@ -536,7 +1155,9 @@ void ImageDecoderImpeller::Decode(fml::RefPtr<ImageDescriptor> descriptor,
         }
 
         auto upload_texture_and_invoke_result = [result, context, bitmap_result,
-                                                 gpu_disabled_switch]() {
+                                                 gpu_disabled_switch,
+                                                 profiler]() {
+          FramePhaseProfiler::ScopedCurrent current_profiler(profiler.get());
           UploadTextureToPrivate(result, context,              //
                                  bitmap_result.device_buffer,  //
                                  bitmap_result.image_info,     //
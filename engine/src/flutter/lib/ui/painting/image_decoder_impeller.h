@@ -9,6 +9,7 @@
 
 #include "flutter/fml/macros.h"
 #include "flutter/lib/ui/painting/image_decoder.h"
+#include "flutter/lib/ui/painting/yuv_to_rgb_converter_impeller.h"
 #include "impeller/core/formats.h"
 #include "impeller/geometry/size.h"
 #include "include/core/SkImageInfo.h"
@@ -53,7 +54,8 @@ class ImageDecoderImpeller final : public ImageDecoder {
       std::shared_ptr<fml::ConcurrentTaskRunner> concurrent_task_runner,
       const fml::WeakPtr<IOManager>& io_manager,
       bool supports_wide_gamut,
-      const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch);
+      const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch,
+      bool enable_yuv_decoding = false);
 
   ~ImageDecoderImpeller() override;
 
@@ -70,6 +72,69 @@ class ImageDecoderImpeller final : public ImageDecoder {
       bool supports_wide_gamut,
       const std::shared_ptr<impeller::Allocator>& allocator);
 
+  /// @brief Decode the image a chunk of rows at a time, uploading each chunk
+  ///        into a device private texture as soon as it is decoded. Only a
+  ///        single chunk of decoded pixels is resident in host memory at any
+  ///        time, instead of the whole image as with `DecompressTexture`.
+  ///
+  ///        If GPU access is lost part way through, the remaining rows are
+  ///        decoded into a single buffer and uploaded once access is
+  ///        restored, as `UploadTextureToPrivate` does for whole images.
+  ///
+  /// @param result      The image result closure that accepts the DlImage and
+  ///                    any encoding error messages.
+  /// @param descriptor  The descriptor of the image to decode.
+  /// @param target_size The requested size, already clamped to the max
+  ///                    texture size.
+  /// @param context     The Impeller graphics context.
+  /// @param supports_wide_gamut Whether the device supports wide gamut images.
+  /// @param gpu_disabled_switch Whether the GPU is available command encoding.
+  ///
+  /// @return false if streaming is not applicable to this image (for
+  ///         example, small images, wide gamut images, images that need
+  ///         reorientation, or decoders that can't decode by rows), in which
+  ///         case `result` is not invoked and the caller should use
+  ///         `DecompressTexture`. Otherwise true, and `result` is invoked
+  ///         with the decoded image or a decode error, possibly later.
+  static bool DecompressAndStreamToPrivate(
+      const ImageResult& result,
+      ImageDescriptor* descriptor,
+      SkISize target_size,
+      const std::shared_ptr<impeller::Context>& context,
+      bool supports_wide_gamut,
+      const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch);
+
+  /// @brief Decode the image to its Y and UV planes on the CPU, upload them as
+  ///        separate textures, and convert them to RGB on the GPU. This
+  ///        skips the CPU color conversion and uploads less than half the
+  ///        bytes of an RGBA image for 4:2:0 subsampled JPEGs.
+  ///
+  ///        If GPU access is disabled, the conversion is deferred until it is
+  ///        restored, as `UploadTextureToPrivate` does for RGB images.
+  ///
+  /// @param result      The image result closure that accepts the DlImage and
+  ///                    any encoding error messages.
+  /// @param descriptor  The descriptor of the image to decode.
+  /// @param target_size The requested size, already clamped to the max
+  ///                    texture size.
+  /// @param context     The Impeller graphics context.
+  /// @param converter   The converter that owns the YUV to RGB pipeline.
+  /// @param gpu_disabled_switch Whether the GPU is available command encoding.
+  ///
+  /// @return false if the image can't be decoded to YUV planes, or needs
+  ///         color management or CPU scaling that only the RGB decode
+  ///         performs, in which case `result` is not invoked and the caller
+  ///         should fall back to the RGB paths. Otherwise true, and `result`
+  ///         is invoked with the decoded image or a decode error, possibly
+  ///         later.
+  static bool DecompressYUVAndConvertToPrivate(
+      const ImageResult& result,
+      ImageDescriptor* descriptor,
+      SkISize target_size,
+      const std::shared_ptr<impeller::Context>& context,
+      const std::shared_ptr<YUVToRGBConverterImpeller>& converter,
+      const std::shared_ptr<fml::SyncSwitch>& gpu_disabled_switch);
+
   /// @brief Create a device private texture from the provided host buffer.
   ///
   /// @param result     The image result closure that accepts the DlImage and
@@ -101,6 +166,8 @@ class ImageDecoderImpeller final : public ImageDecoder {
   FutureContext context_;
   const bool supports_wide_gamut_;
   std::shared_ptr<fml::SyncSwitch> gpu_disabled_switch_;
+  // Null unless YUV decoding is enabled.
+  std::shared_ptr<YUVToRGBConverterImpeller> yuv_converter_;
 
   /// Only call this method if the GPU is available.
   static std::pair<sk_sp<DlImage>, std::string> UnsafeUploadTextureToPrivate(
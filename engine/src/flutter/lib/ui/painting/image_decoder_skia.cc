@@ -8,6 +8,7 @@
 
 #include <algorithm>
 
+#include "flutter/flow/frame_phase_profiler.h"
 #include "flutter/fml/logging.h"
 #include "flutter/fml/make_copyable.h"
 #include "flutter/lib/ui/painting/display_list_image_gpu.h"
@@ -167,6 +168,7 @@ static SkiaGPUObject<SkImage> UploadRasterImage(
     const fml::tracing::TraceFlow& flow) {
   TRACE_EVENT0("flutter", __FUNCTION__);
   flow.Step(__FUNCTION__);
+  FramePhaseProfiler::ScopedPhase phase(FramePhase::kImageUpload);
 
   // Should not already be a texture image because that is the entire point of
   // the this method.
@@ -273,6 +275,7 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
                          result,                                  //
                          target_width = target_width,             //
                          target_height = target_height,           //
+                         profiler = frame_phase_profiler_,        //
                          flow = std::move(flow)                   //
   ]() mutable {
         // Step 1: Decompress the image.
@@ -298,8 +301,10 @@ void ImageDecoderSkia::Decode(fml::RefPtr<ImageDescriptor> descriptor_ref_ptr,
         // On IO Thread.
 
         io_runner->PostTask(fml::MakeCopyable([io_manager, decompressed, result,
+                                               profiler,
                                                flow =
                                                    std::move(flow)]() mutable {
+          FramePhaseProfiler::ScopedCurrent current_profiler(profiler.get());
           if (!io_manager) {
             FML_DLOG(ERROR) << "Could not acquire IO manager.";
             result({}, std::move(flow));
@@ -26,10 +26,12 @@
 #include "fml/logging.h"
 #include "impeller/renderer/command_queue.h"
 #include "third_party/skia/include/codec/SkCodecAnimation.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkData.h"
 #include "third_party/skia/include/core/SkImage.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkSize.h"
+#include "third_party/skia/include/core/SkYUVAPixmaps.h"
 #include "third_party/skia/include/encode/SkPngEncoder.h"
 
 // CREATE_NATIVE_ENTRY is leaky by design
@@ -419,6 +421,121 @@ TEST_F(ImageDecoderFixtureTest,
   EXPECT_NE(message, "");
 }
 
+TEST_F(ImageDecoderFixtureTest, ImpellerStreamedUploadDefersOnGpuLoss) {
+#if !IMPELLER_SUPPORTS_RENDERING
+  GTEST_SKIP() << "Impeller only test.";
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
+  // Disables GPU access while the first chunk of rows is being decoded,
+  // after the streamed upload has started.
+  class GpuLosingAllocator : public impeller::TestImpellerAllocator {
+   public:
+    explicit GpuLosingAllocator(std::shared_ptr<fml::SyncSwitch> gpu_switch)
+        : gpu_switch_(std::move(gpu_switch)) {}
+
+   private:
+    std::shared_ptr<impeller::DeviceBuffer> OnCreateBuffer(
+        const impeller::DeviceBufferDescriptor& desc) override {
+      gpu_switch_->SetSwitch(true);
+      return std::make_shared<impeller::TestImpellerDeviceBuffer>(desc);
+    }
+
+    std::shared_ptr<fml::SyncSwitch> gpu_switch_;
+  };
+
+  class GpuLosingContext : public impeller::TestImpellerContext {
+   public:
+    explicit GpuLosingContext(std::shared_ptr<fml::SyncSwitch> gpu_switch)
+        : allocator_(std::make_shared<GpuLosingAllocator>(gpu_switch)) {}
+
+    std::shared_ptr<impeller::Allocator> GetResourceAllocator()
+        const override {
+      return allocator_;
+    }
+
+   private:
+    std::shared_ptr<impeller::Allocator> allocator_;
+  };
+
+  // Large enough to be streamed in several chunks.
+  SkBitmap source;
+  ASSERT_TRUE(source.tryAllocPixels(SkImageInfo::Make(
+      1024, 1200, kRGBA_8888_SkColorType, kPremul_SkAlphaType)));
+  source.eraseColor(SK_ColorBLUE);
+  auto data = SkPngEncoder::Encode(
+      nullptr, SkImages::RasterFromBitmap(source).get(), {});
+  ASSERT_TRUE(data);
+  ImageGeneratorRegistry registry;
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(
+      data, registry.CreateCompatibleGenerator(data));
+
+  auto gpu_disabled_switch = std::make_shared<fml::SyncSwitch>(false);
+  auto context = std::make_shared<GpuLosingContext>(gpu_disabled_switch);
+
+  bool invoked = false;
+  std::string message;
+  auto cb = [&invoked, &message](const sk_sp<DlImage>& image,
+                                 const std::string& p_message) {
+    invoked = true;
+    message = p_message;
+  };
+
+  ASSERT_TRUE(ImageDecoderImpeller::DecompressAndStreamToPrivate(
+      cb, descriptor.get(), SkISize::Make(1024, 1200), context,
+      /*supports_wide_gamut=*/false, gpu_disabled_switch));
+
+  // The upload was deferred instead of failing.
+  EXPECT_FALSE(invoked);
+  EXPECT_EQ(context->command_buffer_count_, 0ul);
+
+  // Running the deferred upload tries to encode it. Creating the command
+  // buffer still fails with the mocked context.
+  context->FlushTasks(/*fail=*/true);
+  EXPECT_TRUE(invoked);
+  EXPECT_EQ(context->command_buffer_count_, 1ul);
+  EXPECT_NE(message, "Image upload failed due to loss of GPU access.");
+}
+
+TEST_F(ImageDecoderFixtureTest, ImpellerYUVConversionDefersWithoutGpu) {
+#if !IMPELLER_SUPPORTS_RENDERING
+  GTEST_SKIP() << "Impeller only test.";
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
+  // A 4:2:0 subsampled sRGB JPEG.
+  auto data = flutter::testing::OpenFixtureAsSkData("gradient_420.jpg");
+  ASSERT_TRUE(data);
+  ImageGeneratorRegistry registry;
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(
+      data, registry.CreateCompatibleGenerator(data));
+
+  auto gpu_disabled_switch = std::make_shared<fml::SyncSwitch>(true);
+  auto context = std::make_shared<impeller::TestImpellerContext>();
+  auto converter = std::make_shared<YUVToRGBConverterImpeller>();
+
+  bool invoked = false;
+  std::string message;
+  auto cb = [&invoked, &message](const sk_sp<DlImage>& image,
+                                 const std::string& p_message) {
+    invoked = true;
+    message = p_message;
+  };
+
+  ASSERT_TRUE(ImageDecoderImpeller::DecompressYUVAndConvertToPrivate(
+      cb, descriptor.get(), SkISize::Make(64, 48), context, converter,
+      gpu_disabled_switch));
+
+  // The planes were decoded, and the conversion deferred instead of failing.
+  EXPECT_FALSE(invoked);
+  EXPECT_EQ(context->command_buffer_count_, 0ul);
+
+  // Running the deferred conversion tries to encode it. Creating the command
+  // buffer still fails with the mocked context.
+  context->FlushTasks(/*fail=*/true);
+  EXPECT_TRUE(invoked);
+  EXPECT_EQ(context->command_buffer_count_, 1ul);
+  EXPECT_NE(message, "Image upload failed due to loss of GPU access.");
+}
+
 TEST_F(ImageDecoderFixtureTest, ImpellerNullColorspace) {
   auto info = SkImageInfo::Make(10, 10, SkColorType::kRGBA_8888_SkColorType,
                                 SkAlphaType::kPremul_SkAlphaType);
@@ -823,6 +940,92 @@ TEST(ImageDecoderTest, VerifySimpleDecoding) {
 #endif  // IMPELLER_SUPPORTS_RENDERING
 }
 
+TEST(ImageDecoderTest, RowDecodingMatchesFullDecode) {
+  auto data = flutter::testing::OpenFixtureAsSkData("DashInNooglerHat.jpg");
+  ASSERT_TRUE(data);
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(std::move(data),
+                                                         std::move(generator));
+  const auto info = descriptor->image_info().makeColorType(
+      kRGBA_8888_SkColorType);
+
+  SkBitmap expected;
+  ASSERT_TRUE(expected.tryAllocPixels(info));
+  ASSERT_TRUE(descriptor->get_pixels(expected.pixmap()));
+
+  SkBitmap actual;
+  ASSERT_TRUE(actual.tryAllocPixels(info));
+  ASSERT_TRUE(descriptor->start_row_decode(info));
+  const int rows_per_chunk = 7;
+  for (int row = 0; row < info.height(); row += rows_per_chunk) {
+    const int chunk_rows = std::min(rows_per_chunk, info.height() - row);
+    ASSERT_EQ(descriptor->get_rows(actual.getAddr(0, row), actual.rowBytes(),
+                                   chunk_rows),
+              chunk_rows);
+  }
+
+  ASSERT_EQ(memcmp(expected.getPixels(), actual.getPixels(),
+                   info.computeMinByteSize()),
+            0);
+}
+
+TEST(ImageDecoderTest, RowDecodingIsUnsupportedForReorientedImages) {
+  auto data = flutter::testing::OpenFixtureAsSkData("Horizontal.jpg");
+  ASSERT_TRUE(data);
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(std::move(data),
+                                                         std::move(generator));
+  ASSERT_FALSE(descriptor->start_row_decode(descriptor->image_info()));
+}
+
+TEST(ImageDecoderTest, JPEGsCanBeDecodedToYUVPlanes) {
+  auto data = flutter::testing::OpenFixtureAsSkData("DashInNooglerHat.jpg");
+  ASSERT_TRUE(data);
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(std::move(data),
+                                                         std::move(generator));
+  SkYUVAPixmapInfo::SupportedDataTypes supported_data_types;
+  supported_data_types.enableDataType(SkYUVAPixmapInfo::DataType::kUnorm8, 1);
+  SkYUVAPixmapInfo yuva_pixmap_info;
+  ASSERT_TRUE(
+      descriptor->query_yuva_info(supported_data_types, &yuva_pixmap_info));
+  ASSERT_EQ(yuva_pixmap_info.yuvaInfo().planeConfig(),
+            SkYUVAInfo::PlaneConfig::kY_U_V);
+  ASSERT_EQ(yuva_pixmap_info.yuvaInfo().dimensions(),
+            descriptor->image_info().dimensions());
+
+  auto yuva_pixmaps = SkYUVAPixmaps::Allocate(yuva_pixmap_info);
+  ASSERT_TRUE(yuva_pixmaps.isValid());
+  ASSERT_TRUE(descriptor->get_yuva_planes(yuva_pixmaps));
+}
+
+TEST(ImageDecoderTest, YUVDecodingIsUnsupportedForReorientedImages) {
+  auto data = flutter::testing::OpenFixtureAsSkData("Horizontal.jpg");
+  ASSERT_TRUE(data);
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  ASSERT_TRUE(generator);
+
+  auto descriptor = fml::MakeRefCounted<ImageDescriptor>(std::move(data),
+                                                         std::move(generator));
+  SkYUVAPixmapInfo yuva_pixmap_info;
+  ASSERT_FALSE(descriptor->query_yuva_info(
+      SkYUVAPixmapInfo::SupportedDataTypes::All(), &yuva_pixmap_info));
+}
+
 TEST(ImageDecoderTest, ImagesWithTransparencyArePremulAlpha) {
   auto data = flutter::testing::OpenFixtureAsSkData("heart_end.png");
   ASSERT_TRUE(data);
@@ -112,9 +112,29 @@ void ImageDescriptor::instantiateCodec(Dart_Handle codec_handle,
                                        int target_height) {
   fml::RefPtr<Codec> ui_codec;
   if (!generator_ || generator_->GetFrameCount() == 1) {
+    // Encoded images that were recently decoded to the same size can reuse
+    // the uploaded image instead of being decoded again.
+    std::optional<DecodedImageCache::Key> cache_key;
+    auto decoder = UIDartState::Current()->GetImageDecoder();
+    if (generator_ && decoder &&
+        decoder->GetDecodedImageCache().IsEnabled()) {
+      // The data is only hashed once, however many codecs are instantiated.
+      if (!buffer_hash_.has_value()) {
+        buffer_hash_ = DecodedImageCache::HashData(*buffer_);
+      }
+      cache_key = DecodedImageCache::MakeKey(
+          buffer_hash_.value(), buffer_->size(),
+          SkISize::Make(target_width, target_height), image_info_.colorType());
+      if (auto cached_image =
+              decoder->GetDecodedImageCache().Get(*cache_key, buffer_)) {
+        ui_codec = fml::MakeRefCounted<SingleFrameCodec>(cached_image);
+        ui_codec->AssociateWithDartWrapper(codec_handle);
+        return;
+      }
+    }
     ui_codec = fml::MakeRefCounted<SingleFrameCodec>(
         static_cast<fml::RefPtr<ImageDescriptor>>(this), target_width,
-        target_height);
+        target_height, cache_key);
   } else {
     ui_codec = fml::MakeRefCounted<MultiFrameCodec>(generator_);
   }
@@ -131,4 +151,32 @@ bool ImageDescriptor::get_pixels(const SkPixmap& pixmap) const {
                                pixmap.rowBytes());
 }
 
+bool ImageDescriptor::start_row_decode(const SkImageInfo& info) const {
+  if (!generator_) {
+    return false;
+  }
+  return generator_->StartRowDecode(info);
+}
+
+int ImageDescriptor::get_rows(void* pixels,
+                              size_t row_bytes,
+                              int row_count) const {
+  FML_DCHECK(generator_);
+  return generator_->GetRows(pixels, row_bytes, row_count);
+}
+
+bool ImageDescriptor::query_yuva_info(
+    const SkYUVAPixmapInfo::SupportedDataTypes& supported_data_types,
+    SkYUVAPixmapInfo* yuva_pixmap_info) const {
+  if (!generator_) {
+    return false;
+  }
+  return generator_->QueryYUVAInfo(supported_data_types, yuva_pixmap_info);
+}
+
+bool ImageDescriptor::get_yuva_planes(const SkYUVAPixmaps& yuva_pixmaps) const {
+  FML_DCHECK(generator_);
+  return generator_->GetYUVAPlanes(yuva_pixmaps);
+}
+
 }  // namespace flutter
@@ -18,6 +18,7 @@
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkPixmap.h"
 #include "third_party/skia/include/core/SkSize.h"
+#include "third_party/skia/include/core/SkYUVAPixmaps.h"
 #include "third_party/tonic/dart_library_natives.h"
 
 namespace flutter {
@@ -110,6 +111,28 @@ class ImageDescriptor : public RefCountedDartWrappable<ImageDescriptor> {
   ///         orientation tag, if applicable.
   bool get_pixels(const SkPixmap& pixmap) const;
 
+  /// @brief  Starts decoding this image incrementally into `info`, if backed
+  ///         by an `ImageGenerator` that supports row decoding.
+  /// @see    `ImageGenerator::StartRowDecode`
+  bool start_row_decode(const SkImageInfo& info) const;
+
+  /// @brief  Decodes the next `row_count` rows after a successful call to
+  ///         `start_row_decode`.
+  /// @see    `ImageGenerator::GetRows`
+  int get_rows(void* pixels, size_t row_bytes, int row_count) const;
+
+  /// @brief  Whether this image can be decoded to YUV planes, if backed by an
+  ///         `ImageGenerator` that supports planar decoding.
+  /// @see    `ImageGenerator::QueryYUVAInfo`
+  bool query_yuva_info(
+      const SkYUVAPixmapInfo::SupportedDataTypes& supported_data_types,
+      SkYUVAPixmapInfo* yuva_pixmap_info) const;
+
+  /// @brief  Decodes this image to YUV planes after a successful call to
+  ///         `query_yuva_info`.
+  /// @see    `ImageGenerator::GetYUVAPlanes`
+  bool get_yuva_planes(const SkYUVAPixmaps& yuva_pixmaps) const;
+
   void dispose() {
     buffer_.reset();
     generator_.reset();
@@ -127,6 +150,8 @@ class ImageDescriptor : public RefCountedDartWrappable<ImageDescriptor> {
   std::shared_ptr<ImageGenerator> generator_;
   const SkImageInfo image_info_;
   std::optional<size_t> row_bytes_;
+  // The hash of |buffer_| for the decoded image cache, computed on first use.
+  std::optional<uint64_t> buffer_hash_;
 
   const SkImageInfo CreateImageInfo() const;
 
@@ -35,6 +35,24 @@ sk_sp<SkImage> ImageGenerator::GetImage() {
   return SkImages::RasterFromBitmap(bitmap);
 }
 
+bool ImageGenerator::StartRowDecode(const SkImageInfo& info) {
+  return false;
+}
+
+int ImageGenerator::GetRows(void* pixels, size_t row_bytes, int row_count) {
+  return 0;
+}
+
+bool ImageGenerator::QueryYUVAInfo(
+    const SkYUVAPixmapInfo::SupportedDataTypes& supported_data_types,
+    SkYUVAPixmapInfo* yuva_pixmap_info) const {
+  return false;
+}
+
+bool ImageGenerator::GetYUVAPlanes(const SkYUVAPixmaps& yuva_pixmaps) {
+  return false;
+}
+
 BuiltinSkiaImageGenerator::~BuiltinSkiaImageGenerator() = default;
 
 BuiltinSkiaImageGenerator::BuiltinSkiaImageGenerator(
@@ -188,6 +206,45 @@ bool BuiltinSkiaCodecImageGenerator::GetPixels(
   return SkPixmapUtils::Orient(output_pixmap, temp_pixmap, origin);
 }
 
+bool BuiltinSkiaCodecImageGenerator::StartRowDecode(const SkImageInfo& info) {
+  // Rows are only handed out in their final position, so images that need
+  // to be reoriented after decoding can't be streamed.
+  if (codec_->getOrigin() != kTopLeft_SkEncodedOrigin ||
+      codec_->getFrameCount() > 1) {
+    return false;
+  }
+  SkCodec::Result result = codec_->startScanlineDecode(info);
+  if (result != SkCodec::kSuccess) {
+    return false;
+  }
+  // Interlaced or bottom-up encodings would require the whole image to be
+  // buffered anyway.
+  return codec_->getScanlineOrder() == SkCodec::kTopDown_SkScanlineOrder;
+}
+
+int BuiltinSkiaCodecImageGenerator::GetRows(void* pixels,
+                                            size_t row_bytes,
+                                            int row_count) {
+  return codec_->getScanlines(pixels, row_count, row_bytes);
+}
+
+bool BuiltinSkiaCodecImageGenerator::QueryYUVAInfo(
+    const SkYUVAPixmapInfo::SupportedDataTypes& supported_data_types,
+    SkYUVAPixmapInfo* yuva_pixmap_info) const {
+  // The planes are handed out as encoded, so images that need to be
+  // reoriented after decoding aren't supported.
+  if (codec_->getOrigin() != kTopLeft_SkEncodedOrigin ||
+      codec_->getFrameCount() > 1) {
+    return false;
+  }
+  return codec_->queryYUVAInfo(supported_data_types, yuva_pixmap_info);
+}
+
+bool BuiltinSkiaCodecImageGenerator::GetYUVAPlanes(
+    const SkYUVAPixmaps& yuva_pixmaps) {
+  return codec_->getYUVAPlanes(yuva_pixmaps) == SkCodec::kSuccess;
+}
+
 std::unique_ptr<ImageGenerator> BuiltinSkiaCodecImageGenerator::MakeFromData(
     sk_sp<SkData> data) {
   auto codec = SkCodec::MakeFromData(std::move(data));
@@ -14,6 +14,7 @@
 #include "third_party/skia/include/core/SkImageGenerator.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkSize.h"
+#include "third_party/skia/include/core/SkYUVAPixmaps.h"
 
 namespace flutter {
 
@@ -135,6 +136,63 @@ class ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) = 0;
 
+  /// @brief      Prepare the generator to decode a still image a few rows at
+  ///             a time, from top to bottom, via `GetRows`. This allows
+  ///             callers to consume each group of rows (e.g. by uploading it
+  ///             to the GPU) before the next one is decoded, so that the full
+  ///             decoded image never needs to be resident in host memory.
+  ///             Decoders that cannot decode incrementally, or that need to
+  ///             reorient the decoded image, should return false, which is
+  ///             the default.
+  /// @param[in]  info  The desired size and color info of the decoded image.
+  ///                   As with `GetPixels`, the size must be one returned by
+  ///                   `GetScaledDimensions`.
+  /// @return     True if row decoding was started and `GetRows` may be
+  ///             called until all `info.height()` rows have been produced.
+  /// @note       Like `GetPixels`, the subsequent calls to `GetRows` perform
+  ///             potentially long synchronous work and should never be
+  ///             executed on the UI thread.
+  /// @see        `GetRows`
+  virtual bool StartRowDecode(const SkImageInfo& info);
+
+  /// @brief      Decode the next `row_count` rows of an image for which
+  ///             `StartRowDecode` returned true.
+  /// @param[in]  pixels     The location where the decoded rows should be
+  ///                        written.
+  /// @param[in]  row_bytes  The total number of bytes that make up a single
+  ///                        row in `pixels`.
+  /// @param[in]  row_count  The number of rows to decode.
+  /// @return     The number of rows that were successfully decoded. Rows
+  ///             past this count in `pixels` are left in an unspecified
+  ///             state.
+  /// @see        `StartRowDecode`
+  virtual int GetRows(void* pixels, size_t row_bytes, int row_count);
+
+  /// @brief      Query whether the image can be decoded directly to separate
+  ///             planes of YUV data with `GetYUVAPlanes`, skipping the
+  ///             conversion to RGB. This is typically the case for JPEGs.
+  ///             Decoders that can't produce planar data, or that need to
+  ///             reorient the decoded image, should return false, which is
+  ///             the default.
+  /// @param[in]  supported_data_types  The plane data types the caller is able
+  ///                                   to consume.
+  /// @param[out] yuva_pixmap_info      The layout of the planes that
+  ///                                   `GetYUVAPlanes` would produce.
+  /// @return     True if the image can be decoded to YUV planes.
+  /// @see        `GetYUVAPlanes`
+  virtual bool QueryYUVAInfo(
+      const SkYUVAPixmapInfo::SupportedDataTypes& supported_data_types,
+      SkYUVAPixmapInfo* yuva_pixmap_info) const;
+
+  /// @brief      Decode the image to YUV planes laid out as described by a
+  ///             prior successful call to `QueryYUVAInfo`.
+  /// @param[in]  yuva_pixmaps  The planes to decode into.
+  /// @return     True if the planes were fully decoded.
+  /// @note       This performs potentially long synchronous work and should
+  ///             never be executed on the UI thread.
+  /// @see        `QueryYUVAInfo`
+  virtual bool GetYUVAPlanes(const SkYUVAPixmaps& yuva_pixmaps);
+
   /// @brief   Creates an `SkImage` based on the current `ImageInfo` of this
   ///          `ImageGenerator`.
   /// @return  A new `SkImage` containing the decoded image data.
@@ -212,6 +270,20 @@ class BuiltinSkiaCodecImageGenerator : public ImageGenerator {
       unsigned int frame_index = 0,
       std::optional<unsigned int> prior_frame = std::nullopt) override;
 
+  // |ImageGenerator|
+  bool StartRowDecode(const SkImageInfo& info) override;
+
+  // |ImageGenerator|
+  int GetRows(void* pixels, size_t row_bytes, int row_count) override;
+
+  // |ImageGenerator|
+  bool QueryYUVAInfo(
+      const SkYUVAPixmapInfo::SupportedDataTypes& supported_data_types,
+      SkYUVAPixmapInfo* yuva_pixmap_info) const override;
+
+  // |ImageGenerator|
+  bool GetYUVAPlanes(const SkYUVAPixmaps& yuva_pixmaps) override;
+
   static std::unique_ptr<ImageGenerator> MakeFromData(sk_sp<SkData> data);
 
  private:
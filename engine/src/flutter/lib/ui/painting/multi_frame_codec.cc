@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/lib/ui/painting/display_list_image_gpu.h"
 #include "flutter/lib/ui/painting/image.h"
 #if IMPELLER_SUPPORTS_RENDERING
@@ -22,18 +23,20 @@
 namespace flutter {
 
 MultiFrameCodec::MultiFrameCodec(std::shared_ptr<ImageGenerator> generator)
-    : state_(new State(std::move(generator))) {}
+    : state_(new State(std::move(generator),
+                       UIDartState::Current()->IsImpellerEnabled())) {}
 
 MultiFrameCodec::~MultiFrameCodec() = default;
 
-MultiFrameCodec::State::State(std::shared_ptr<ImageGenerator> generator)
+MultiFrameCodec::State::State(std::shared_ptr<ImageGenerator> generator,
+                              bool is_impeller_enabled)
     : generator_(std::move(generator)),
       frameCount_(generator_->GetFrameCount()),
       repetitionCount_(generator_->GetPlayCount() ==
                                ImageGenerator::kInfinitePlayCount
                            ? -1
                            : generator_->GetPlayCount() - 1),
-      is_impeller_enabled_(UIDartState::Current()->IsImpellerEnabled()) {}
+      is_impeller_enabled_(is_impeller_enabled) {}
 
 static void InvokeNextFrameCallback(
     const fml::RefPtr<CanvasImage>& image,
@@ -53,29 +56,66 @@ static void InvokeNextFrameCallback(
                      tonic::ToDart(decode_error)});
 }
 
-std::pair<sk_sp<DlImage>, std::string>
-MultiFrameCodec::State::GetNextFrameImage(
-    fml::WeakPtr<GrDirectContext> resourceContext,
-    const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
-    const std::shared_ptr<impeller::Context>& impeller_context,
-    fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue) {
-  SkBitmap bitmap = SkBitmap();
+SkBitmap* MultiFrameCodec::State::AcquirePooledBitmap(
+    const SkImageInfo& info) {
+  // A pooled bitmap can only be written to once the previous frame's upload
+  // (or `lastRequiredFrame_`) no longer references its pixels.
+  for (SkBitmap& pooled : bitmapPool_) {
+    if (pooled.info() == info && pooled.pixelRef() &&
+        pooled.pixelRef()->unique()) {
+      return &pooled;
+    }
+  }
+  SkBitmap bitmap;
+  if (!bitmap.tryAllocPixels(info)) {
+    return nullptr;
+  }
+  if (bitmapPool_.size() < kFrameLookAhead + 2) {
+    bitmapPool_.push_back(std::move(bitmap));
+    return &bitmapPool_.back();
+  }
+  // The pool is saturated with buffers still in use. Replace the oldest one,
+  // whose pixels stay alive for as long as they are referenced elsewhere.
+  bitmapPool_.erase(bitmapPool_.begin());
+  bitmapPool_.push_back(std::move(bitmap));
+  return &bitmapPool_.back();
+}
+
+MultiFrameCodec::State::DecodedFrame
+MultiFrameCodec::State::DecodeNextFrame() {
+  TRACE_EVENT1("flutter", "MultiFrameCodec::DecodeNextFrame", "frame",
+               std::to_string(nextFrameIndex_).c_str());
+  const int frameIndex = nextFrameIndex_;
+  nextFrameIndex_ = (nextFrameIndex_ + 1) % frameCount_;
+
+  if (frameIndex == 0) {
+    // The animation is starting over. Nothing from the previous repetition,
+    // which may have been decoded ahead, is a backdrop for its first frames.
+    lastRequiredFrame_.reset();
+    lastRequiredFrameIndex_ = -1;
+    restoreBGColorRect_.reset();
+  }
+
   SkImageInfo info = generator_->GetInfo().makeColorType(kN32_SkColorType);
   if (info.alphaType() == kUnpremul_SkAlphaType) {
     SkImageInfo updated = info.makeAlphaType(kPremul_SkAlphaType);
     info = updated;
   }
-  if (!bitmap.tryAllocPixels(info)) {
+  SkBitmap* pooled_bitmap = AcquirePooledBitmap(info);
+  if (!pooled_bitmap) {
     std::ostringstream ostr;
     ostr << "Failed to allocate memory for bitmap of size "
          << info.computeMinByteSize() << "B";
     std::string decode_error = ostr.str();
     FML_LOG(ERROR) << decode_error;
-    return std::make_pair(nullptr, decode_error);
+    return {.decode_error = decode_error};
   }
+  SkBitmap bitmap = *pooled_bitmap;
+  // Pooled buffers contain a previous frame. Frames without a backdrop
+  // expect to start from a transparent slate.
+  bitmap.eraseColor(SK_ColorTRANSPARENT);
 
-  ImageGenerator::FrameInfo frameInfo =
-      generator_->GetFrameInfo(nextFrameIndex_);
+  ImageGenerator::FrameInfo frameInfo = generator_->GetFrameInfo(frameIndex);
 
   const int requiredFrameIndex =
       frameInfo.required_frame.value_or(SkCodec::kNoFrame);
@@ -86,7 +126,7 @@ MultiFrameCodec::State::GetNextFrameImage(
     // |requiredFrameIndex| is set to ex-frame or ex-ex-frame.
     if (!lastRequiredFrame_.has_value()) {
       FML_DLOG(INFO)
-          << "Frame " << nextFrameIndex_ << " depends on frame "
+          << "Frame " << frameIndex << " depends on frame "
           << requiredFrameIndex
           << " and no required frames are cached. Using blank slate instead.";
     } else {
@@ -102,12 +142,12 @@ MultiFrameCodec::State::GetNextFrameImage(
   // Write the new frame to the output buffer. The bitmap pixels as supplied
   // are already set in accordance with the previous frame's disposal policy.
   if (!generator_->GetPixels(info, bitmap.getPixels(), bitmap.rowBytes(),
-                             nextFrameIndex_, requiredFrameIndex)) {
+                             frameIndex, requiredFrameIndex)) {
     std::ostringstream ostr;
-    ostr << "Could not getPixels for frame " << nextFrameIndex_;
+    ostr << "Could not getPixels for frame " << frameIndex;
     std::string decode_error = ostr.str();
     FML_LOG(ERROR) << decode_error;
-    return std::make_pair(nullptr, decode_error);
+    return {.decode_error = decode_error};
   }
 
   const bool keep_current_frame =
@@ -132,7 +172,7 @@ MultiFrameCodec::State::GetNextFrameImage(
     // Replace the stored frame. The `lastRequiredFrame_` will get used as the
     // starting backdrop for the next frame.
     lastRequiredFrame_ = bitmap;
-    lastRequiredFrameIndex_ = nextFrameIndex_;
+    lastRequiredFrameIndex_ = frameIndex;
   }
 
   if (frameInfo.disposal_method ==
@@ -142,6 +182,77 @@ MultiFrameCodec::State::GetNextFrameImage(
     restoreBGColorRect_.reset();
   }
 
+  return {.bitmap = std::move(bitmap),
+          .duration = static_cast<int>(frameInfo.duration)};
+}
+
+MultiFrameCodec::State::DecodedFrame MultiFrameCodec::State::TakeNextFrame() {
+  {
+    std::scoped_lock lock(frames_mutex_);
+    if (!readyFrames_.empty()) {
+      DecodedFrame frame = std::move(readyFrames_.front());
+      readyFrames_.pop_front();
+      return frame;
+    }
+  }
+
+  // A look-ahead decode in progress publishes its frame before it releases
+  // `decode_mutex_`, so check again once it is held.
+  std::scoped_lock decode_lock(decode_mutex_);
+  {
+    std::scoped_lock lock(frames_mutex_);
+    if (!readyFrames_.empty()) {
+      DecodedFrame frame = std::move(readyFrames_.front());
+      readyFrames_.pop_front();
+      return frame;
+    }
+  }
+  return DecodeNextFrame();
+}
+
+void MultiFrameCodec::State::DecodeAhead() {
+  while (true) {
+    std::scoped_lock decode_lock(decode_mutex_);
+    {
+      std::scoped_lock lock(frames_mutex_);
+      if (readyFrames_.size() >= kFrameLookAhead) {
+        lookAheadScheduled_ = false;
+        return;
+      }
+    }
+    DecodedFrame frame = DecodeNextFrame();
+    std::scoped_lock lock(frames_mutex_);
+    readyFrames_.push_back(std::move(frame));
+  }
+}
+
+void MultiFrameCodec::State::ScheduleDecodeAhead(
+    const std::shared_ptr<State>& self,
+    const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_runner) {
+  // A single frame image has nothing to decode ahead.
+  if (!concurrent_runner || frameCount_ < 2) {
+    return;
+  }
+  {
+    std::scoped_lock lock(frames_mutex_);
+    if (lookAheadScheduled_ || readyFrames_.size() >= kFrameLookAhead) {
+      return;
+    }
+    lookAheadScheduled_ = true;
+  }
+  concurrent_runner->PostTask([weak_state = std::weak_ptr<State>(self)]() {
+    if (auto state = weak_state.lock()) {
+      state->DecodeAhead();
+    }
+  });
+}
+
+std::pair<sk_sp<DlImage>, std::string> MultiFrameCodec::State::UploadFrame(
+    const SkBitmap& bitmap,
+    fml::WeakPtr<GrDirectContext> resourceContext,
+    const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
+    const std::shared_ptr<impeller::Context>& impeller_context,
+    fml::RefPtr<flutter::SkiaUnrefQueue> unref_queue) {
 #if IMPELLER_SUPPORTS_RENDERING
   if (is_impeller_enabled_) {
     // This is safe regardless of whether the GPU is available or not because
@@ -190,21 +301,23 @@ void MultiFrameCodec::State::GetNextFrameAndInvokeCallback(
     const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
     size_t trace_id,
     const std::shared_ptr<impeller::Context>& impeller_context) {
+  DecodedFrame frame = TakeNextFrame();
+
   fml::RefPtr<CanvasImage> image = nullptr;
   int duration = 0;
-  sk_sp<DlImage> dlImage;
-  std::string decode_error;
-  std::tie(dlImage, decode_error) =
-      GetNextFrameImage(std::move(resourceContext), gpu_disable_sync_switch,
-                        impeller_context, std::move(unref_queue));
-  if (dlImage) {
-    image = CanvasImage::Create();
-    image->set_image(dlImage);
-    ImageGenerator::FrameInfo frameInfo =
-        generator_->GetFrameInfo(nextFrameIndex_);
-    duration = frameInfo.duration;
+  std::string decode_error = std::move(frame.decode_error);
+  if (frame.bitmap.has_value()) {
+    sk_sp<DlImage> dlImage;
+    std::tie(dlImage, decode_error) =
+        UploadFrame(frame.bitmap.value(), std::move(resourceContext),
+                    gpu_disable_sync_switch, impeller_context,
+                    std::move(unref_queue));
+    if (dlImage) {
+      image = CanvasImage::Create();
+      image->set_image(dlImage);
+      duration = frame.duration;
+    }
   }
-  nextFrameIndex_ = (nextFrameIndex_ + 1) % frameCount_;
 
   // The static leak checker gets confused by the use of fml::MakeCopyable.
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
@@ -246,6 +359,7 @@ Dart_Handle MultiFrameCodec::getNextFrame(Dart_Handle callback_handle) {
            tonic::DartState::Current(), callback_handle),
        weak_state = std::weak_ptr<MultiFrameCodec::State>(state_), trace_id,
        ui_task_runner = task_runners.GetUITaskRunner(),
+       concurrent_runner = dart_state->GetConcurrentTaskRunner(),
        io_manager = dart_state->GetIOManager()]() mutable {
         auto state = weak_state.lock();
         if (!state) {
@@ -258,6 +372,8 @@ Dart_Handle MultiFrameCodec::getNextFrame(Dart_Handle callback_handle) {
             io_manager->GetResourceContext(), io_manager->GetSkiaUnrefQueue(),
             io_manager->GetIsGpuDisabledSyncSwitch(), trace_id,
             io_manager->GetImpellerContext());
+        // Start on the following frames while this one is being displayed.
+        state->ScheduleDecodeAhead(state, concurrent_runner);
       }));
 
   return Dart_Null();
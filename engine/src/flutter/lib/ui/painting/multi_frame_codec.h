@@ -5,11 +5,15 @@
 #ifndef FLUTTER_LIB_UI_PAINTING_MULTI_FRAME_CODEC_H_
 #define FLUTTER_LIB_UI_PAINTING_MULTI_FRAME_CODEC_H_
 
+#include "flutter/fml/concurrent_message_loop.h"
 #include "flutter/fml/macros.h"
 #include "flutter/lib/ui/painting/codec.h"
 #include "flutter/lib/ui/painting/image_generator.h"
 
+#include <deque>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 namespace flutter {
 
@@ -28,9 +32,11 @@ class MultiFrameCodec : public Codec {
   // |Codec|
   Dart_Handle getNextFrame(Dart_Handle args) override;
 
- private:
   // Captures the state shared between the IO and UI task runners.
   //
+  // It is public so that the frame decoding can be tested and benchmarked
+  // without a Dart isolate.
+  //
   // The state is initialized on the UI task runner when the Dart object is
   // created. Decoding occurs on the IO task runner. Since it is possible for
   // the UI object to be collected independently of the IO task runner work,
@@ -39,15 +45,38 @@ class MultiFrameCodec : public Codec {
   // shares it with the IO task runner's decoding work, and sets the live_
   // member to false when it is destructed.
   struct State {
-    explicit State(std::shared_ptr<ImageGenerator> generator);
+    State(std::shared_ptr<ImageGenerator> generator, bool is_impeller_enabled);
+
+    // The number of frames decoded ahead of the frame most recently handed
+    // out, so that decoding frame N+1 overlaps with displaying frame N.
+    static constexpr size_t kFrameLookAhead = 2;
+
+    // A frame that has been decoded on the CPU but not yet uploaded.
+    struct DecodedFrame {
+      std::optional<SkBitmap> bitmap;
+      int duration = 0;
+      std::string decode_error;
+    };
 
     const std::shared_ptr<ImageGenerator> generator_;
     const int frameCount_;
     const int repetitionCount_;
     bool is_impeller_enabled_ = false;
 
-    // The non-const members and functions below here are only read or written
-    // to on the IO thread. They are not safe to access or write on the UI
+    // Guards the generator and the decode state below, and is held while a
+    // frame decodes. Frames are requested on the IO thread and decoded ahead
+    // on the concurrent task runner, but `ImageGenerator`s must never be
+    // accessed in parallel.
+    std::mutex decode_mutex_;
+
+    // Guards the frames decoded ahead of time. It is only held to publish or
+    // take a frame, so that the IO thread never waits for a look-ahead decode
+    // to hand out a frame that is already decoded. When both are held,
+    // `decode_mutex_` is locked first.
+    std::mutex frames_mutex_;
+
+    // The non-const members below here are only accessed with
+    // `decode_mutex_` held. They are not safe to access or write on the UI
     // thread.
     int nextFrameIndex_ = 0;
     // The last decoded frame that's required to decode any subsequent frames.
@@ -59,7 +88,35 @@ class MultiFrameCodec : public Codec {
     // method was kRestoreBGColor.
     std::optional<SkIRect> restoreBGColorRect_;
 
-    std::pair<sk_sp<DlImage>, std::string> GetNextFrameImage(
+    // Frame buffers that may be reused once nothing else references their
+    // pixels.
+    std::vector<SkBitmap> bitmapPool_;
+
+    // The members below here are only accessed with `frames_mutex_` held.
+
+    // Frames decoded ahead of time, in display order.
+    std::deque<DecodedFrame> readyFrames_;
+    // Whether a look-ahead decode task is pending on the concurrent runner.
+    bool lookAheadScheduled_ = false;
+
+    DecodedFrame DecodeNextFrame();
+
+    SkBitmap* AcquirePooledBitmap(const SkImageInfo& info);
+
+    // Returns the next frame in display order, taking it from the frames
+    // decoded ahead of time if there are any and decoding it otherwise.
+    DecodedFrame TakeNextFrame();
+
+    // Decodes frames until `kFrameLookAhead` of them are ready, releasing
+    // `decode_mutex_` between frames.
+    void DecodeAhead();
+
+    void ScheduleDecodeAhead(
+        const std::shared_ptr<State>& self,
+        const std::shared_ptr<fml::ConcurrentTaskRunner>& concurrent_runner);
+
+    std::pair<sk_sp<DlImage>, std::string> UploadFrame(
+        const SkBitmap& bitmap,
         fml::WeakPtr<GrDirectContext> resourceContext,
         const std::shared_ptr<const fml::SyncSwitch>& gpu_disable_sync_switch,
         const std::shared_ptr<impeller::Context>& impeller_context,
@@ -75,6 +132,7 @@ class MultiFrameCodec : public Codec {
         const std::shared_ptr<impeller::Context>& impeller_context);
   };
 
+ private:
   // Shared across the UI and IO task runners.
   std::shared_ptr<State> state_;
 
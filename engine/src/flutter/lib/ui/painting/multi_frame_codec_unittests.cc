@@ -0,0 +1,172 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/multi_frame_codec.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "flutter/fml/synchronization/waitable_event.h"
+#include "flutter/testing/testing.h"
+#include "third_party/skia/include/core/SkPixmap.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+constexpr SkColor kFrameColor = SK_ColorBLUE;
+
+// An animated image whose frames each paint one pixel, at the x coordinate of
+// their index, on top of the frame before them.
+class TestAnimatedImageGenerator : public ImageGenerator {
+ public:
+  explicit TestAnimatedImageGenerator(
+      unsigned int frame_count,
+      SkCodecAnimation::DisposalMethod first_frame_disposal =
+          SkCodecAnimation::DisposalMethod::kKeep)
+      : info_(SkImageInfo::MakeN32Premul(frame_count, 1)),
+        frame_count_(frame_count),
+        first_frame_disposal_(first_frame_disposal) {}
+
+  ~TestAnimatedImageGenerator() override = default;
+
+  const SkImageInfo& GetInfo() override { return info_; }
+
+  unsigned int GetFrameCount() const override { return frame_count_; }
+
+  unsigned int GetPlayCount() const override { return kInfinitePlayCount; }
+
+  const ImageGenerator::FrameInfo GetFrameInfo(
+      unsigned int frame_index) override {
+    return {
+        .required_frame = frame_index == 0
+                              ? std::nullopt
+                              : std::optional<unsigned int>(frame_index - 1),
+        .duration = 16,
+        .disposal_method = frame_index == 0
+                               ? first_frame_disposal_
+                               : SkCodecAnimation::DisposalMethod::kKeep,
+        .blend_mode = SkCodecAnimation::Blend::kSrcOver};
+  }
+
+  SkISize GetScaledDimensions(float scale) override {
+    return info_.dimensions();
+  }
+
+  bool GetPixels(const SkImageInfo& info,
+                 void* pixels,
+                 size_t row_bytes,
+                 unsigned int frame_index,
+                 std::optional<unsigned int> prior_frame) override {
+    if (frame_index == block_frame_index) {
+      decode_blocked.Signal();
+      unblock_decode.Wait();
+    }
+    decode_count++;
+    SkPixmap(info, pixels, row_bytes)
+        .erase(kFrameColor, SkIRect::MakeXYWH(frame_index, 0, 1, 1));
+    return true;
+  }
+
+  std::atomic<int> decode_count = 0;
+
+  // Decoding this frame signals `decode_blocked` and waits for
+  // `unblock_decode`.
+  std::optional<unsigned int> block_frame_index;
+  fml::AutoResetWaitableEvent decode_blocked;
+  fml::AutoResetWaitableEvent unblock_decode;
+
+ private:
+  const SkImageInfo info_;
+  const unsigned int frame_count_;
+  const SkCodecAnimation::DisposalMethod first_frame_disposal_;
+};
+
+// The indices of the pixels painted in |frame|.
+std::vector<int> PaintedPixels(
+    const MultiFrameCodec::State::DecodedFrame& frame) {
+  std::vector<int> painted;
+  if (!frame.bitmap.has_value()) {
+    return painted;
+  }
+  for (int x = 0; x < frame.bitmap->width(); x++) {
+    if (frame.bitmap->getColor(x, 0) == kFrameColor) {
+      painted.push_back(x);
+    }
+  }
+  return painted;
+}
+
+}  // namespace
+
+TEST(MultiFrameCodecTest, TakesFramesDecodedAhead) {
+  auto generator = std::make_shared<TestAnimatedImageGenerator>(4);
+  MultiFrameCodec::State state(generator, false);
+
+  state.DecodeAhead();
+  EXPECT_EQ(generator->decode_count, 2);
+
+  EXPECT_EQ(PaintedPixels(state.TakeNextFrame()), std::vector<int>({0}));
+  EXPECT_EQ(PaintedPixels(state.TakeNextFrame()), std::vector<int>({0, 1}));
+  EXPECT_EQ(generator->decode_count, 2);
+}
+
+TEST(MultiFrameCodecTest, DecodesFramesThatWereNotDecodedAhead) {
+  auto generator = std::make_shared<TestAnimatedImageGenerator>(4);
+  MultiFrameCodec::State state(generator, false);
+
+  EXPECT_EQ(PaintedPixels(state.TakeNextFrame()), std::vector<int>({0}));
+  EXPECT_EQ(generator->decode_count, 1);
+
+  state.DecodeAhead();
+  EXPECT_EQ(generator->decode_count, 3);
+  EXPECT_EQ(PaintedPixels(state.TakeNextFrame()), std::vector<int>({0, 1}));
+  EXPECT_EQ(PaintedPixels(state.TakeNextFrame()), std::vector<int>({0, 1, 2}));
+  EXPECT_EQ(PaintedPixels(state.TakeNextFrame()),
+            std::vector<int>({0, 1, 2, 3}));
+  EXPECT_EQ(generator->decode_count, 4);
+}
+
+TEST(MultiFrameCodecTest, ResetsBackdropWhenAnimationRepeats) {
+  // Frame 1 starts from a blank slate because frame 0 restores the (empty)
+  // backdrop before it. In later repetitions the backdrop left by the last
+  // frame must not be restored instead.
+  auto generator = std::make_shared<TestAnimatedImageGenerator>(
+      3, SkCodecAnimation::DisposalMethod::kRestorePrevious);
+  MultiFrameCodec::State state(generator, false);
+
+  std::vector<std::vector<int>> frames;
+  for (int i = 0; i < 6; i++) {
+    frames.push_back(PaintedPixels(state.TakeNextFrame()));
+    state.DecodeAhead();
+  }
+  EXPECT_EQ(frames[0], std::vector<int>({0}));
+  EXPECT_EQ(frames[1], std::vector<int>({1}));
+  EXPECT_EQ(frames[2], std::vector<int>({1, 2}));
+  EXPECT_EQ(frames[3], frames[0]);
+  EXPECT_EQ(frames[4], frames[1]);
+  EXPECT_EQ(frames[5], frames[2]);
+}
+
+TEST(MultiFrameCodecTest, HandsOutReadyFramesWhileDecodingAhead) {
+  auto generator = std::make_shared<TestAnimatedImageGenerator>(4);
+  generator->block_frame_index = 1;
+  MultiFrameCodec::State state(generator, false);
+
+  std::thread decode_ahead([&state] { state.DecodeAhead(); });
+  generator->decode_blocked.Wait();
+
+  // Frame 0 is ready while frame 1 is still decoding.
+  EXPECT_EQ(PaintedPixels(state.TakeNextFrame()), std::vector<int>({0}));
+
+  generator->unblock_decode.Signal();
+  decode_ahead.join();
+  EXPECT_EQ(PaintedPixels(state.TakeNextFrame()), std::vector<int>({0, 1}));
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -12,10 +12,20 @@ namespace flutter {
 SingleFrameCodec::SingleFrameCodec(
     const fml::RefPtr<ImageDescriptor>& descriptor,
     uint32_t target_width,
-    uint32_t target_height)
+    uint32_t target_height,
+    std::optional<DecodedImageCache::Key> cache_key)
     : descriptor_(descriptor),
       target_width_(target_width),
-      target_height_(target_height) {}
+      target_height_(target_height),
+      cache_key_(cache_key) {}
+
+SingleFrameCodec::SingleFrameCodec(sk_sp<DlImage> cached_image)
+    : status_(Status::kComplete),
+      target_width_(cached_image->width()),
+      target_height_(cached_image->height()) {
+  cached_image_ = fml::MakeRefCounted<CanvasImage>();
+  cached_image_->set_image(std::move(cached_image));
+}
 
 SingleFrameCodec::~SingleFrameCodec() = default;
 
@@ -70,7 +80,8 @@ Dart_Handle SingleFrameCodec::getNextFrame(Dart_Handle callback_handle) {
 
   decoder->Decode(
       descriptor_, target_width_, target_height_,
-      [raw_codec_ref](auto image, auto decode_error) {
+      [raw_codec_ref, data = descriptor_->data()](auto image,
+                                                  auto decode_error) {
         std::unique_ptr<fml::RefPtr<SingleFrameCodec>> codec_ref(raw_codec_ref);
         fml::RefPtr<SingleFrameCodec> codec(std::move(*codec_ref));
 
@@ -86,6 +97,14 @@ Dart_Handle SingleFrameCodec::getNextFrame(Dart_Handle callback_handle) {
         tonic::DartState::Scope scope(state.get());
 
         if (image) {
+          if (codec->cache_key_.has_value()) {
+            auto decoder = UIDartState::Current()->GetImageDecoder();
+            if (decoder) {
+              decoder->GetDecodedImageCache().Put(codec->cache_key_.value(),
+                                                  data, image);
+            }
+          }
+
           auto canvas_image = fml::MakeRefCounted<CanvasImage>();
           canvas_image->set_image(std::move(image));
 
@@ -7,6 +7,7 @@
 
 #include "flutter/fml/macros.h"
 #include "flutter/lib/ui/painting/codec.h"
+#include "flutter/lib/ui/painting/decoded_image_cache.h"
 #include "flutter/lib/ui/painting/image.h"
 #include "flutter/lib/ui/painting/image_decoder.h"
 #include "flutter/lib/ui/painting/image_descriptor.h"
@@ -15,9 +16,14 @@ namespace flutter {
 
 class SingleFrameCodec : public Codec {
  public:
-  SingleFrameCodec(const fml::RefPtr<ImageDescriptor>& descriptor,
-                   uint32_t target_width,
-                   uint32_t target_height);
+  SingleFrameCodec(
+      const fml::RefPtr<ImageDescriptor>& descriptor,
+      uint32_t target_width,
+      uint32_t target_height,
+      std::optional<DecodedImageCache::Key> cache_key = std::nullopt);
+
+  // Creates a codec whose frame was found in the `DecodedImageCache`.
+  explicit SingleFrameCodec(sk_sp<DlImage> cached_image);
 
   ~SingleFrameCodec() override;
 
@@ -37,6 +43,7 @@ class SingleFrameCodec : public Codec {
   uint32_t target_width_;
   uint32_t target_height_;
   fml::RefPtr<CanvasImage> cached_image_;
+  std::optional<DecodedImageCache::Key> cache_key_;
   std::vector<tonic::DartPersistentValue> pending_callbacks_;
 
   FML_FRIEND_MAKE_REF_COUNTED(SingleFrameCodec);
@@ -0,0 +1,154 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/lib/ui/painting/yuv_to_rgb_converter_impeller.h"
+
+#include "flutter/fml/logging.h"
+#include "flutter/fml/trace_event.h"
+#include "impeller/base/strings.h"
+#include "impeller/core/host_buffer.h"
+#include "impeller/core/sampler_descriptor.h"
+#include "impeller/core/texture.h"
+#include "impeller/entity/contents/content_context.h"
+#include "impeller/entity/contents/filters/yuv_to_rgb_filter_contents.h"
+#include "impeller/geometry/matrix.h"
+#include "impeller/renderer/command_buffer.h"
+#include "impeller/renderer/context.h"
+#include "impeller/renderer/render_pass.h"
+#include "impeller/renderer/render_target.h"
+#include "impeller/renderer/vertex_buffer_builder.h"
+
+namespace flutter {
+
+YUVToRGBConverterImpeller::YUVToRGBConverterImpeller() = default;
+
+YUVToRGBConverterImpeller::~YUVToRGBConverterImpeller() = default;
+
+std::shared_ptr<impeller::Pipeline<impeller::PipelineDescriptor>>
+YUVToRGBConverterImpeller::GetPipeline(const impeller::Context& context,
+                                       impeller::PixelFormat color_format) {
+  std::scoped_lock lock(pipeline_mutex_);
+  if (pipeline_) {
+    return pipeline_;
+  }
+
+  TRACE_EVENT0("impeller", "CreateYUVToRGBConverterPipeline");
+  auto desc = impeller::YUVToRGBFilterPipeline::Builder::
+      MakeDefaultPipelineDescriptor(context);
+  if (!desc.has_value()) {
+    return nullptr;
+  }
+  desc->SetLabel("ImageDecoder YUV to RGB Pipeline");
+  desc->SetSampleCount(impeller::SampleCount::kCount1);
+  desc->SetPrimitiveType(impeller::PrimitiveType::kTriangleStrip);
+  desc->ClearDepthAttachment();
+  desc->ClearStencilAttachments();
+
+  impeller::ColorAttachmentDescriptor color0 =
+      *desc->GetColorAttachmentDescriptor(0u);
+  color0.format = color_format;
+  color0.blending_enabled = false;
+  desc->SetColorAttachmentDescriptor(0u, color0);
+
+  pipeline_ =
+      context.GetPipelineLibrary()->GetPipeline(desc, /*async=*/false).Get();
+  return pipeline_;
+}
+
+std::shared_ptr<impeller::Texture> YUVToRGBConverterImpeller::EncodeConversion(
+    const std::shared_ptr<impeller::Context>& context,
+    impeller::CommandBuffer& command_buffer,
+    const std::shared_ptr<impeller::Texture>& y_texture,
+    const std::shared_ptr<impeller::Texture>& uv_texture,
+    impeller::YUVColorSpace yuv_color_space,
+    size_t mip_count) {
+  using VS = impeller::YUVToRGBFilterPipeline::VertexShader;
+  using FS = impeller::YUVToRGBFilterPipeline::FragmentShader;
+
+  TRACE_EVENT0("impeller", __FUNCTION__);
+  if (y_texture->GetTextureDescriptor().format !=
+          impeller::PixelFormat::kR8UNormInt ||
+      uv_texture->GetTextureDescriptor().format !=
+          impeller::PixelFormat::kR8G8UNormInt) {
+    FML_DLOG(ERROR) << "Unexpected YUV plane formats.";
+    return nullptr;
+  }
+
+  const auto color_format =
+      context->GetCapabilities()->GetDefaultColorFormat();
+  auto pipeline = GetPipeline(*context, color_format);
+  if (!pipeline) {
+    FML_DLOG(ERROR) << "Could not create the YUV to RGB pipeline.";
+    return nullptr;
+  }
+
+  const impeller::ISize size = y_texture->GetSize();
+  impeller::RenderTargetAllocator render_target_allocator(
+      context->GetResourceAllocator());
+  impeller::RenderTarget render_target =
+      render_target_allocator.CreateOffscreen(
+          *context, size, mip_count, "ui.Image YUV to RGB",
+          impeller::RenderTarget::kDefaultColorAttachmentConfig,
+          /*stencil_attachment_config=*/std::nullopt);
+  if (!render_target.IsValid()) {
+    FML_DLOG(ERROR) << "Could not create the YUV to RGB render target.";
+    return nullptr;
+  }
+
+  auto render_pass = command_buffer.CreateRenderPass(render_target);
+  if (!render_pass) {
+    FML_DLOG(ERROR) << "Could not create the YUV to RGB render pass.";
+    return nullptr;
+  }
+  render_pass->SetLabel("YUV to RGB Render Pass");
+  render_pass->SetCommandLabel("YUV to RGB Conversion");
+  render_pass->SetPipeline(pipeline);
+
+  // The buffer views keep the underlying device buffers alive until the
+  // command buffer is done with them.
+  auto host_buffer =
+      impeller::HostBuffer::Create(context->GetResourceAllocator());
+
+  std::array<VS::PerVertexData, 4> vertices = {
+      VS::PerVertexData{impeller::Point(0, 0)},
+      VS::PerVertexData{impeller::Point(1, 0)},
+      VS::PerVertexData{impeller::Point(0, 1)},
+      VS::PerVertexData{impeller::Point(1, 1)},
+  };
+  render_pass->SetVertexBuffer(CreateVertexBuffer(vertices, *host_buffer));
+
+  VS::FrameInfo frame_info;
+  frame_info.mvp = impeller::Matrix::MakeOrthographic(size) *
+                   impeller::Matrix::MakeScale(impeller::Vector2(size));
+  frame_info.texture_sampler_y_coord_scale = y_texture->GetYCoordScale();
+
+  FS::FragInfo frag_info;
+  frag_info.yuv_color_space = static_cast<impeller::Scalar>(yuv_color_space);
+  frag_info.matrix =
+      impeller::YUVToRGBFilterContents::GetYUVToRGBMatrix(yuv_color_space);
+
+  // The chroma plane is usually subsampled, so filter it when upsampling.
+  impeller::SamplerDescriptor sampler_desc;
+  sampler_desc.label = "YUV to RGB Sampler";
+  sampler_desc.min_filter = impeller::MinMagFilter::kLinear;
+  sampler_desc.mag_filter = impeller::MinMagFilter::kLinear;
+  const std::unique_ptr<const impeller::Sampler>& sampler =
+      context->GetSamplerLibrary()->GetSampler(sampler_desc);
+  FS::BindYTexture(*render_pass, y_texture, sampler);
+  FS::BindUvTexture(*render_pass, uv_texture, sampler);
+
+  FS::BindFragInfo(*render_pass, host_buffer->EmplaceUniform(frag_info));
+  VS::BindFrameInfo(*render_pass, host_buffer->EmplaceUniform(frame_info));
+
+  if (!render_pass->Draw().ok() || !render_pass->EncodeCommands()) {
+    FML_DLOG(ERROR) << "Could not encode the YUV to RGB render pass.";
+    return nullptr;
+  }
+
+  auto texture = render_target.GetRenderTargetTexture();
+  texture->SetLabel(impeller::SPrintF("ui.Image(%p)", texture.get()).c_str());
+  return texture;
+}
+
+}  // namespace flutter
@@ -0,0 +1,76 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_LIB_UI_PAINTING_YUV_TO_RGB_CONVERTER_IMPELLER_H_
+#define FLUTTER_LIB_UI_PAINTING_YUV_TO_RGB_CONVERTER_IMPELLER_H_
+
+#include <memory>
+#include <mutex>
+
+#include "flutter/fml/macros.h"
+#include "impeller/core/formats.h"
+#include "impeller/geometry/color.h"
+#include "impeller/renderer/pipeline.h"
+
+namespace impeller {
+class CommandBuffer;
+class Context;
+class Texture;
+}  // namespace impeller
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      Converts decoded images from a luma plane and an interleaved
+///             chroma plane into an RGB texture on the GPU.
+///
+///             The image decoder has no access to the `ContentContext` used
+///             for drawing, so this owns its own copy of the YUV to RGB
+///             pipeline. The pipeline is created on first use and shared by
+///             all conversions of the decoder.
+///
+class YUVToRGBConverterImpeller {
+ public:
+  YUVToRGBConverterImpeller();
+
+  ~YUVToRGBConverterImpeller();
+
+  //----------------------------------------------------------------------------
+  /// @brief      Encode a render pass that converts the provided planes into a
+  ///             new device private texture the size of the luma plane.
+  ///
+  /// @param[in]  context          The Impeller graphics context.
+  /// @param[in]  command_buffer   The command buffer to encode the pass into.
+  /// @param[in]  y_texture        The luma plane, in `kR8UNormInt`.
+  /// @param[in]  uv_texture       The interleaved chroma plane, in
+  ///                              `kR8G8UNormInt`. May be subsampled.
+  /// @param[in]  yuv_color_space  The color space of the planes.
+  /// @param[in]  mip_count        The mip count of the resulting texture. Only
+  ///                              the base level is written.
+  ///
+  /// @return     The converted texture, or nullptr if the pass could not be
+  ///             encoded. Only call this method if the GPU is available.
+  ///
+  std::shared_ptr<impeller::Texture> EncodeConversion(
+      const std::shared_ptr<impeller::Context>& context,
+      impeller::CommandBuffer& command_buffer,
+      const std::shared_ptr<impeller::Texture>& y_texture,
+      const std::shared_ptr<impeller::Texture>& uv_texture,
+      impeller::YUVColorSpace yuv_color_space,
+      size_t mip_count);
+
+ private:
+  std::mutex pipeline_mutex_;
+  std::shared_ptr<impeller::Pipeline<impeller::PipelineDescriptor>> pipeline_;
+
+  std::shared_ptr<impeller::Pipeline<impeller::PipelineDescriptor>>
+  GetPipeline(const impeller::Context& context,
+              impeller::PixelFormat color_format);
+
+  FML_DISALLOW_COPY_AND_ASSIGN(YUVToRGBConverterImpeller);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_LIB_UI_PAINTING_YUV_TO_RGB_CONVERTER_IMPELLER_H_
@@ -3009,6 +3009,38 @@ abstract class Paragraph {
   /// The [ParagraphConstraints] control how wide the text is allowed to be.
   void layout(ParagraphConstraints constraints);
 
+  /// Computes the layout of each paragraph in `paragraphs` with the
+  /// constraints at the same index in `constraints`, as if [layout] had been
+  /// called on each of them.
+  ///
+  /// The paragraphs may be laid out concurrently on background threads. This
+  /// is faster than calling [layout] in a loop when measuring many paragraphs
+  /// at once, such as the cells of a table. Returns once every paragraph has
+  /// been laid out.
+  ///
+  /// A paragraph that appears more than once in `paragraphs` is laid out with
+  /// the last of its constraints.
+  static void layoutAll(List<Paragraph> paragraphs, List<ParagraphConstraints> constraints) {
+    assert(paragraphs.length == constraints.length);
+    if (paragraphs.any((Paragraph paragraph) => paragraph is! _NativeParagraph)) {
+      for (int index = 0; index < paragraphs.length; index += 1) {
+        paragraphs[index].layout(constraints[index]);
+      }
+      return;
+    }
+    final Float64List widths = Float64List(constraints.length);
+    for (int index = 0; index < constraints.length; index += 1) {
+      widths[index] = constraints[index].width;
+    }
+    _layoutAllParagraphs(paragraphs, widths);
+    assert(() {
+      for (final Paragraph paragraph in paragraphs) {
+        (paragraph as _NativeParagraph)._needsLayout = false;
+      }
+      return true;
+    }());
+  }
+
   /// Returns a list of text boxes that enclose the given text range.
   ///
   /// The [boxHeightStyle] and [boxWidthStyle] parameters allow customization
@@ -3712,5 +3744,8 @@ FutureOr<void> _sendFontChangeMessage() async {
   }
 }
 
+@Native<Void Function(Handle, Handle)>(symbol: 'Paragraph::LayoutAll')
+external void _layoutAllParagraphs(List<Paragraph> paragraphs, Float64List widths);
+
 @Native<Void Function(Handle, Handle, Handle)>(symbol: 'FontCollection::LoadFontFromList')
 external void _loadFontFromList(Uint8List list, _Callback<void> callback, String fontFamily);
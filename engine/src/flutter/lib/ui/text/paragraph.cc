@@ -4,10 +4,19 @@
 
 #include "flutter/lib/ui/text/paragraph.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
 #include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
 #include "flutter/fml/task_runner.h"
+#include "flutter/fml/trace_event.h"
+#include "flutter/lib/ui/ui_dart_state.h"
 #include "third_party/dart/runtime/include/dart_api.h"
 #include "third_party/skia/modules/skparagraph/include/DartTypes.h"
 #include "third_party/skia/modules/skparagraph/include/Paragraph.h"
@@ -26,6 +35,88 @@ Paragraph::Paragraph(std::unique_ptr<txt::Paragraph> paragraph)
 
 Paragraph::~Paragraph() = default;
 
+namespace {
+// Batches smaller than this are laid out on the calling thread, where the
+// cost of waking up workers outweighs the layout itself.
+constexpr size_t kMinParallelLayoutCount = 8;
+
+using ParagraphLayout = std::pair<txt::Paragraph*, double>;
+
+struct LayoutBatch {
+  explicit LayoutBatch(std::vector<ParagraphLayout> p_layouts)
+      : layouts(std::move(p_layouts)), latch(layouts.size()) {}
+
+  std::vector<ParagraphLayout> layouts;
+  std::atomic<size_t> next_index = 0;
+  fml::CountDownLatch latch;
+
+  // Lays out paragraphs until none are left. Workers that start after the
+  // batch is done return without touching the paragraphs.
+  void Run() {
+    size_t index;
+    while ((index = next_index.fetch_add(1)) < layouts.size()) {
+      layouts[index].first->Layout(layouts[index].second);
+      latch.CountDown();
+    }
+  }
+};
+}  // namespace
+
+void Paragraph::LayoutAll(Dart_Handle paragraphs_handle,
+                          const tonic::Float64List& widths) {
+  TRACE_EVENT0("flutter", "Paragraph::LayoutAll");
+  std::vector<Paragraph*> paragraphs =
+      tonic::DartConverter<std::vector<Paragraph*>>::FromDart(
+          paragraphs_handle);
+  if (paragraphs.size() != widths.num_elements()) {
+    Dart_ThrowException(tonic::ToDart(
+        "The number of paragraphs and widths must match."));
+    return;
+  }
+
+  // A paragraph that appears more than once is laid out once, with the last
+  // of its widths, so that no paragraph is laid out on two threads at once.
+  std::vector<ParagraphLayout> layouts;
+  layouts.reserve(paragraphs.size());
+  std::unordered_map<txt::Paragraph*, size_t> layout_indices;
+  for (size_t i = 0; i < paragraphs.size(); i++) {
+    // Skip disposed paragraphs.
+    if (!paragraphs[i] || !paragraphs[i]->m_paragraph_) {
+      continue;
+    }
+    txt::Paragraph* paragraph = paragraphs[i]->m_paragraph_.get();
+    auto [it, inserted] = layout_indices.emplace(paragraph, layouts.size());
+    if (inserted) {
+      layouts.emplace_back(paragraph, widths[i]);
+    } else {
+      layouts[it->second].second = widths[i];
+    }
+  }
+
+  std::shared_ptr<fml::ConcurrentTaskRunner> runner =
+      UIDartState::Current()->GetConcurrentTaskRunner();
+  if (!runner || layouts.size() < kMinParallelLayoutCount) {
+    for (const auto& [paragraph, width] : layouts) {
+      paragraph->Layout(width);
+    }
+    return;
+  }
+
+  // The paragraphs are owned by the Dart list, which stays alive because this
+  // thread blocks until every paragraph has been laid out.
+  auto batch = std::make_shared<LayoutBatch>(std::move(layouts));
+  size_t worker_count =
+      std::min<size_t>(std::thread::hardware_concurrency(),
+                       batch->layouts.size() / kMinParallelLayoutCount);
+  for (size_t i = 1; i < worker_count; i++) {
+    runner->PostTask([batch]() { batch->Run(); });
+  }
+  // Take part in the work so the batch completes even if the workers are
+  // busy with other tasks.
+  batch->Run();
+  batch->latch.Wait();
+}
+
 double Paragraph::width() {
   return m_paragraph_->GetMaxWidth();
 }
@@ -23,6 +23,17 @@ class Paragraph : public RefCountedDartWrappable<Paragraph> {
     paragraph->AssociateWithDartWrapper(paragraph_handle);
   }
 
+  //----------------------------------------------------------------------------
+  /// @brief      Lays out each paragraph in the list with the width at the same
+  ///             index, spreading the work across the concurrent task runner.
+  ///             Returns once all paragraphs have been laid out.
+  ///
+  /// @param[in]  paragraphs_handle  A Dart list of paragraphs.
+  /// @param[in]  widths             The layout width of each paragraph.
+  ///
+  static void LayoutAll(Dart_Handle paragraphs_handle,
+                        const tonic::Float64List& widths);
+
   ~Paragraph() override;
 
   double width();
@@ -4,13 +4,18 @@
 
 #include "flutter/benchmarking/benchmarking.h"
 #include "flutter/common/settings.h"
+#include "flutter/fml/time/time_point.h"
+#include "flutter/lib/ui/painting/image_generator_registry.h"
+#include "flutter/lib/ui/painting/multi_frame_codec.h"
 #include "flutter/lib/ui/window/platform_message_response_dart.h"
 #include "flutter/runtime/dart_vm_lifecycle.h"
 #include "flutter/shell/common/thread_host.h"
 #include "flutter/testing/dart_isolate_runner.h"
 #include "flutter/testing/fixture_test.h"
 
+#include <algorithm>
 #include <future>
+#include <vector>
 
 namespace flutter {
 
@@ -69,4 +74,81 @@ static void BM_PlatformMessageResponseDartComplete(benchmark::State& state) {
 BENCHMARK(BM_PlatformMessageResponseDartComplete)
     ->Unit(benchmark::kMicrosecond);
 
+// Plays back an animated image through `MultiFrameCodec`, and reports the
+// latency of handing out each frame in microseconds. With |decode_ahead|, the
+// codec decodes ahead while each frame is displayed, as it does when it has a
+// concurrent task runner, and that decoding isn't timed.
+static void BM_MultiFrameCodecNextFrame(benchmark::State& state,
+                                        const char* fixture_name,
+                                        bool decode_ahead) {
+  auto data = testing::OpenFixtureAsSkData(fixture_name);
+  FML_CHECK(data);
+  ImageGeneratorRegistry registry;
+  std::shared_ptr<ImageGenerator> generator =
+      registry.CreateCompatibleGenerator(data);
+  FML_CHECK(generator);
+
+  MultiFrameCodec::State codec_state(generator, false);
+  const int frame_count = codec_state.frameCount_;
+  std::vector<double> latencies;
+
+  while (state.KeepRunning()) {
+    for (int frame = 0; frame < frame_count; frame++) {
+      const auto start = fml::TimePoint::Now();
+      auto decoded = codec_state.TakeNextFrame();
+      latencies.push_back((fml::TimePoint::Now() - start).ToMicrosecondsF());
+      FML_CHECK(decoded.bitmap.has_value());
+      if (decode_ahead) {
+        state.PauseTiming();
+        codec_state.DecodeAhead();
+        state.ResumeTiming();
+      }
+    }
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](double p) {
+    if (latencies.empty()) {
+      return 0.0;
+    }
+    return latencies[std::min(latencies.size() - 1,
+                              static_cast<size_t>(p * latencies.size()))];
+  };
+  state.counters["frames"] = frame_count;
+  state.counters["p50_us"] = percentile(0.5);
+  state.counters["p90_us"] = percentile(0.9);
+  state.counters["p99_us"] = percentile(0.99);
+}
+
+BENCHMARK_CAPTURE(BM_MultiFrameCodecNextFrame,
+                  alpha_animated,
+                  "alpha_animated.apng",
+                  false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_MultiFrameCodecNextFrame,
+                  alpha_animated_decode_ahead,
+                  "alpha_animated.apng",
+                  true)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_MultiFrameCodecNextFrame,
+                  dispose_op_background,
+                  "dispose_op_background.apng",
+                  false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_MultiFrameCodecNextFrame,
+                  dispose_op_background_decode_ahead,
+                  "dispose_op_background.apng",
+                  true)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_MultiFrameCodecNextFrame,
+                  dispose_op_restore_previous,
+                  "2_dispose_op_restore_previous.apng",
+                  false)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_MultiFrameCodecNextFrame,
+                  dispose_op_restore_previous_decode_ahead,
+                  "2_dispose_op_restore_previous.apng",
+                  true)
+    ->Unit(benchmark::kMicrosecond);
+
 }  // namespace flutter
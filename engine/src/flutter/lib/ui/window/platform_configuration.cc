@@ -4,9 +4,11 @@
 
 #include "flutter/lib/ui/window/platform_configuration.h"
 
+#include <cstdlib>
 #include <cstring>
 
 #include "flutter/common/constants.h"
+#include "flutter/fml/mapping.h"
 #include "flutter/lib/ui/compositing/scene.h"
 #include "flutter/lib/ui/ui_dart_state.h"
 #include "flutter/lib/ui/window/platform_message.h"
@@ -27,6 +29,42 @@ Dart_Handle ToByteData(const fml::Mapping& buffer) {
   return tonic::DartByteData::Create(buffer.GetMapping(), buffer.GetSize());
 }
 
+void DeleteMappingFinalizer(void* isolate_callback_data, void* peer) {
+  delete static_cast<fml::Mapping*>(peer);
+}
+
+void FreeFinalizer(void* isolate_callback_data, void* peer) {
+  free(peer);
+}
+
+// Converts the data of the message to a ByteData. Large buffers are handed
+// over to Dart instead of being copied into the Dart heap.
+Dart_Handle ToByteData(PlatformMessage& message) {
+  const fml::Mapping& data = message.data();
+  if (data.GetSize() < tonic::DartByteData::kExternalSizeThreshold) {
+    return ToByteData(data);
+  }
+  if (message.hasExternalData()) {
+    // The buffer belongs to the embedder, which may still read it, so Dart
+    // only gets an unmodifiable view of it.
+    std::unique_ptr<fml::Mapping> mapping = message.releaseMapping();
+    const void* buffer = mapping->GetMapping();
+    const intptr_t length = mapping->GetSize();
+    fml::Mapping* peer = mapping.release();
+    return Dart_NewUnmodifiableExternalTypedDataWithFinalizer(
+        Dart_TypedData_kByteData, buffer, length, peer, length,
+        DeleteMappingFinalizer);
+  }
+  // The message owns its malloc'd buffer, so Dart can take it over and write
+  // to it like to a copy.
+  fml::MallocMapping mapping = message.releaseData();
+  const intptr_t length = mapping.GetSize();
+  uint8_t* buffer = mapping.Release();
+  return Dart_NewExternalTypedDataWithFinalizer(Dart_TypedData_kByteData,
+                                                buffer, length, buffer, length,
+                                                FreeFinalizer);
+}
+
 }  // namespace
 
 PlatformConfigurationClient::~PlatformConfigurationClient() {}
@@ -305,7 +343,7 @@ void PlatformConfiguration::DispatchPlatformMessage(
   }
   tonic::DartState::Scope scope(dart_state);
   Dart_Handle data_handle =
-      (message->hasData()) ? ToByteData(message->data()) : Dart_Null();
+      (message->hasData()) ? ToByteData(*message) : Dart_Null();
   if (Dart_IsError(data_handle)) {
     FML_DLOG(WARNING)
         << "Dropping platform message because of a Dart error on channel: "
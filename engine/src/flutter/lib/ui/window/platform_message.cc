@@ -15,6 +15,14 @@ PlatformMessage::PlatformMessage(std::string channel,
       data_(std::move(data)),
       has_data_(true),
       response_(std::move(response)) {}
+PlatformMessage::PlatformMessage(std::string channel,
+                                 std::unique_ptr<fml::Mapping> external_data,
+                                 fml::RefPtr<PlatformMessageResponse> response)
+    : channel_(std::move(channel)),
+      data_(),
+      external_data_(std::move(external_data)),
+      has_data_(true),
+      response_(std::move(response)) {}
 PlatformMessage::PlatformMessage(std::string channel,
                                  fml::RefPtr<PlatformMessageResponse> response)
     : channel_(std::move(channel)),
@@ -24,4 +32,21 @@ PlatformMessage::PlatformMessage(std::string channel,
 
 PlatformMessage::~PlatformMessage() = default;
 
+fml::MallocMapping PlatformMessage::releaseData() {
+  if (external_data_) {
+    auto data = fml::MallocMapping::Copy(external_data_->GetMapping(),
+                                         external_data_->GetSize());
+    external_data_.reset();
+    return data;
+  }
+  return std::move(data_);
+}
+
+std::unique_ptr<fml::Mapping> PlatformMessage::releaseMapping() {
+  if (external_data_) {
+    return std::move(external_data_);
+  }
+  return std::make_unique<fml::MallocMapping>(std::move(data_));
+}
+
 }  // namespace flutter
@@ -5,6 +5,7 @@
 #ifndef FLUTTER_LIB_UI_WINDOW_PLATFORM_MESSAGE_H_
 #define FLUTTER_LIB_UI_WINDOW_PLATFORM_MESSAGE_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -19,23 +20,38 @@ class PlatformMessage {
   PlatformMessage(std::string channel,
                   fml::MallocMapping data,
                   fml::RefPtr<PlatformMessageResponse> response);
+  /// Creates a message whose data is owned by a mapping the message takes
+  /// over without copying, such as a buffer handed over by an embedder.
+  PlatformMessage(std::string channel,
+                  std::unique_ptr<fml::Mapping> external_data,
+                  fml::RefPtr<PlatformMessageResponse> response);
   PlatformMessage(std::string channel,
                   fml::RefPtr<PlatformMessageResponse> response);
   ~PlatformMessage();
 
   const std::string& channel() const { return channel_; }
-  const fml::MallocMapping& data() const { return data_; }
+  const fml::Mapping& data() const {
+    return external_data_ ? *external_data_ : data_;
+  }
   bool hasData() { return has_data_; }
+  /// Whether the data is owned by a mapping other than a MallocMapping, such
+  /// as a buffer handed over by an embedder.
+  bool hasExternalData() const { return external_data_ != nullptr; }
 
   const fml::RefPtr<PlatformMessageResponse>& response() const {
     return response_;
   }
 
-  fml::MallocMapping releaseData() { return std::move(data_); }
+  /// Releases the data as a MallocMapping. External data is copied.
+  fml::MallocMapping releaseData();
+
+  /// Releases the data without copying it.
+  std::unique_ptr<fml::Mapping> releaseMapping();
 
  private:
   std::string channel_;
   fml::MallocMapping data_;
+  std::unique_ptr<fml::Mapping> external_data_;
   bool has_data_;
   fml::RefPtr<PlatformMessageResponse> response_;
 };
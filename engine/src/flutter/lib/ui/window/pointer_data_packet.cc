@@ -22,6 +22,15 @@ void PointerDataPacket::SetPointerData(size_t i, const PointerData& data) {
   memcpy(&data_[i * sizeof(PointerData)], &data, sizeof(PointerData));
 }
 
+void PointerDataPacket::AddPointerData(const PointerData& data) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&data);
+  data_.insert(data_.end(), bytes, bytes + sizeof(PointerData));
+}
+
+void PointerDataPacket::Clear() {
+  data_.clear();
+}
+
 PointerData PointerDataPacket::GetPointerData(size_t i) const {
   FML_DCHECK(i < GetLength());
   PointerData result;
@@ -20,6 +20,10 @@ class PointerDataPacket {
   ~PointerDataPacket();
 
   void SetPointerData(size_t i, const PointerData& data);
+  // Appends |data| to the packet.
+  void AddPointerData(const PointerData& data);
+  // Removes all pointer data, keeping the allocated storage for reuse.
+  void Clear();
   PointerData GetPointerData(size_t i) const;
   size_t GetLength() const;
   const std::vector<uint8_t>& data() const { return data_; }
@@ -12,34 +12,25 @@
 namespace flutter {
 
 PointerDataPacketConverter::PointerDataPacketConverter(const Delegate& delegate)
-    : delegate_(delegate) {}
+    : delegate_(delegate), converted_packet_(0) {}
 
 PointerDataPacketConverter::~PointerDataPacketConverter() = default;
 
-std::unique_ptr<PointerDataPacket> PointerDataPacketConverter::Convert(
+const PointerDataPacket& PointerDataPacketConverter::Convert(
     const PointerDataPacket& packet) {
-  std::vector<PointerData> converted_pointers;
   // Converts each pointer data in the buffer and stores it in the
-  // converted_pointers.
+  // converted_packet_, whose storage is reused between calls.
+  converted_packet_.Clear();
   for (size_t i = 0; i < packet.GetLength(); i++) {
     PointerData pointer_data = packet.GetPointerData(i);
-    ConvertPointerData(pointer_data, converted_pointers);
+    ConvertPointerData(pointer_data, converted_packet_);
   }
-
-  // Writes converted_pointers into converted_packet.
-  auto converted_packet =
-      std::make_unique<flutter::PointerDataPacket>(converted_pointers.size());
-  size_t count = 0;
-  for (auto& converted_pointer : converted_pointers) {
-    converted_packet->SetPointerData(count++, converted_pointer);
-  }
-
-  return converted_packet;
+  return converted_packet_;
 }
 
 void PointerDataPacketConverter::ConvertPointerData(
     PointerData pointer_data,
-    std::vector<PointerData>& converted_pointers) {
+    PointerDataPacket& converted_packet) {
   // Ignores pointer events with an invalid view ID.
   if (!delegate_.ViewExists(pointer_data.view_id)) {
     return;
@@ -64,19 +55,19 @@ void PointerDataPacketConverter::ConvertPointerData(
             synthesized_move_event.synthesized = 1;
 
             UpdateDeltaAndState(synthesized_move_event, state);
-            converted_pointers.push_back(synthesized_move_event);
+            converted_packet.AddPointerData(synthesized_move_event);
           }
 
           state.is_down = false;
           states_[pointer_data.device] = state;
-          converted_pointers.push_back(pointer_data);
+          converted_packet.AddPointerData(pointer_data);
         }
         break;
       }
       case PointerData::Change::kAdd: {
         FML_DCHECK(states_.find(pointer_data.device) == states_.end());
         EnsurePointerState(pointer_data);
-        converted_pointers.push_back(pointer_data);
+        converted_packet.AddPointerData(pointer_data);
         break;
       }
       case PointerData::Change::kRemove: {
@@ -94,7 +85,7 @@ void PointerDataPacketConverter::ConvertPointerData(
 
           state.is_down = false;
           states_[synthesized_cancel_event.device] = state;
-          converted_pointers.push_back(synthesized_cancel_event);
+          converted_packet.AddPointerData(synthesized_cancel_event);
         }
 
         if (LocationNeedsUpdate(pointer_data, state)) {
@@ -104,11 +95,11 @@ void PointerDataPacketConverter::ConvertPointerData(
           synthesized_hover_event.synthesized = 1;
 
           UpdateDeltaAndState(synthesized_hover_event, state);
-          converted_pointers.push_back(synthesized_hover_event);
+          converted_packet.AddPointerData(synthesized_hover_event);
         }
 
         states_.erase(pointer_data.device);
-        converted_pointers.push_back(pointer_data);
+        converted_packet.AddPointerData(pointer_data);
         break;
       }
       case PointerData::Change::kHover: {
@@ -121,7 +112,7 @@ void PointerDataPacketConverter::ConvertPointerData(
           synthesized_add_event.synthesized = 1;
           synthesized_add_event.buttons = 0;
           state = EnsurePointerState(synthesized_add_event);
-          converted_pointers.push_back(synthesized_add_event);
+          converted_packet.AddPointerData(synthesized_add_event);
         } else {
           state = iter->second;
         }
@@ -130,7 +121,7 @@ void PointerDataPacketConverter::ConvertPointerData(
         state.buttons = pointer_data.buttons;
         if (LocationNeedsUpdate(pointer_data, state)) {
           UpdateDeltaAndState(pointer_data, state);
-          converted_pointers.push_back(pointer_data);
+          converted_packet.AddPointerData(pointer_data);
         }
         break;
       }
@@ -144,7 +135,7 @@ void PointerDataPacketConverter::ConvertPointerData(
           synthesized_add_event.synthesized = 1;
           synthesized_add_event.buttons = 0;
           state = EnsurePointerState(synthesized_add_event);
-          converted_pointers.push_back(synthesized_add_event);
+          converted_packet.AddPointerData(synthesized_add_event);
         } else {
           state = iter->second;
         }
@@ -158,14 +149,14 @@ void PointerDataPacketConverter::ConvertPointerData(
           synthesized_hover_event.buttons = 0;
 
           UpdateDeltaAndState(synthesized_hover_event, state);
-          converted_pointers.push_back(synthesized_hover_event);
+          converted_packet.AddPointerData(synthesized_hover_event);
         }
 
         UpdatePointerIdentifier(pointer_data, state, true);
         state.is_down = true;
         state.buttons = pointer_data.buttons;
         states_[pointer_data.device] = state;
-        converted_pointers.push_back(pointer_data);
+        converted_packet.AddPointerData(pointer_data);
         break;
       }
       case PointerData::Change::kMove: {
@@ -178,7 +169,7 @@ void PointerDataPacketConverter::ConvertPointerData(
         UpdatePointerIdentifier(pointer_data, state, false);
         UpdateDeltaAndState(pointer_data, state);
         state.buttons = pointer_data.buttons;
-        converted_pointers.push_back(pointer_data);
+        converted_packet.AddPointerData(pointer_data);
         break;
       }
       case PointerData::Change::kUp: {
@@ -198,13 +189,13 @@ void PointerDataPacketConverter::ConvertPointerData(
           synthesized_move_event.synthesized = 1;
 
           UpdateDeltaAndState(synthesized_move_event, state);
-          converted_pointers.push_back(synthesized_move_event);
+          converted_packet.AddPointerData(synthesized_move_event);
         }
 
         state.is_down = false;
         state.buttons = pointer_data.buttons;
         states_[pointer_data.device] = state;
-        converted_pointers.push_back(pointer_data);
+        converted_packet.AddPointerData(pointer_data);
         break;
       }
       case PointerData::Change::kPanZoomStart: {
@@ -218,7 +209,7 @@ void PointerDataPacketConverter::ConvertPointerData(
           synthesized_add_event.synthesized = 1;
           synthesized_add_event.buttons = 0;
           state = EnsurePointerState(synthesized_add_event);
-          converted_pointers.push_back(synthesized_add_event);
+          converted_packet.AddPointerData(synthesized_add_event);
         } else {
           state = iter->second;
         }
@@ -232,7 +223,7 @@ void PointerDataPacketConverter::ConvertPointerData(
           synthesized_hover_event.buttons = 0;
 
           UpdateDeltaAndState(synthesized_hover_event, state);
-          converted_pointers.push_back(synthesized_hover_event);
+          converted_packet.AddPointerData(synthesized_hover_event);
         }
 
         UpdatePointerIdentifier(pointer_data, state, true);
@@ -242,7 +233,7 @@ void PointerDataPacketConverter::ConvertPointerData(
         state.scale = 1;
         state.rotation = 0;
         states_[pointer_data.device] = state;
-        converted_pointers.push_back(pointer_data);
+        converted_packet.AddPointerData(pointer_data);
         break;
       }
       case PointerData::Change::kPanZoomUpdate: {
@@ -256,7 +247,7 @@ void PointerDataPacketConverter::ConvertPointerData(
         UpdatePointerIdentifier(pointer_data, state, false);
         UpdateDeltaAndState(pointer_data, state);
 
-        converted_pointers.push_back(pointer_data);
+        converted_packet.AddPointerData(pointer_data);
         break;
       }
       case PointerData::Change::kPanZoomEnd: {
@@ -281,16 +272,16 @@ void PointerDataPacketConverter::ConvertPointerData(
           synthesized_move_event.synthesized = 1;
 
           UpdateDeltaAndState(synthesized_move_event, state);
-          converted_pointers.push_back(synthesized_move_event);
+          converted_packet.AddPointerData(synthesized_move_event);
         }
 
         state.is_pan_zoom_active = false;
         states_[pointer_data.device] = state;
-        converted_pointers.push_back(pointer_data);
+        converted_packet.AddPointerData(pointer_data);
         break;
       }
       default: {
-        converted_pointers.push_back(pointer_data);
+        converted_packet.AddPointerData(pointer_data);
         break;
       }
     }
@@ -311,7 +302,7 @@ void PointerDataPacketConverter::ConvertPointerData(
           synthesized_add_event.synthesized = 1;
           synthesized_add_event.buttons = 0;
           state = EnsurePointerState(synthesized_add_event);
-          converted_pointers.push_back(synthesized_add_event);
+          converted_packet.AddPointerData(synthesized_add_event);
         } else {
           state = iter->second;
         }
@@ -326,7 +317,7 @@ void PointerDataPacketConverter::ConvertPointerData(
             synthesized_move_event.synthesized = 1;
 
             UpdateDeltaAndState(synthesized_move_event, state);
-            converted_pointers.push_back(synthesized_move_event);
+            converted_packet.AddPointerData(synthesized_move_event);
           } else {
             // Synthesizes a hover event if the pointer is up.
             PointerData synthesized_hover_event = pointer_data;
@@ -337,11 +328,11 @@ void PointerDataPacketConverter::ConvertPointerData(
             synthesized_hover_event.synthesized = 1;
 
             UpdateDeltaAndState(synthesized_hover_event, state);
-            converted_pointers.push_back(synthesized_hover_event);
+            converted_packet.AddPointerData(synthesized_hover_event);
           }
         }
 
-        converted_pointers.push_back(pointer_data);
+        converted_packet.AddPointerData(pointer_data);
         break;
       }
       default: {
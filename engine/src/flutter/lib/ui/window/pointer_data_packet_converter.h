@@ -112,8 +112,10 @@ class PointerDataPacketConverter {
   /// @return     A full converted packet with all the required information
   ///             filled. It may contain synthetic pointer data as the result of
   ///             converter's attempt to correct illegal pointer transitions.
+  ///             The packet is owned by the converter and only valid until the
+  ///             next call to `Convert`, which reuses its storage.
   ///
-  std::unique_ptr<PointerDataPacket> Convert(const PointerDataPacket& packet);
+  const PointerDataPacket& Convert(const PointerDataPacket& packet);
 
  private:
   const Delegate& delegate_;
@@ -123,8 +125,13 @@ class PointerDataPacketConverter {
 
   int64_t pointer_ = 0;
 
+  // The output of the current |Convert| call. The packet is kept between
+  // calls so that its storage does not have to be reallocated for every
+  // packet.
+  PointerDataPacket converted_packet_;
+
   void ConvertPointerData(PointerData pointer_data,
-                          std::vector<PointerData>& converted_pointers);
+                          PointerDataPacket& converted_packet);
 
   PointerState EnsurePointerState(PointerData pointer_data);
 
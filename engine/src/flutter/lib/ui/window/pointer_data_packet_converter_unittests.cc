@@ -157,12 +157,11 @@ void CreateSimulatedTrackpadGestureData(PointerData& data,  // NOLINT
 }
 
 void UnpackPointerPacket(std::vector<PointerData>& output,  // NOLINT
-                         std::unique_ptr<PointerDataPacket> packet) {
-  for (size_t i = 0; i < packet->GetLength(); i++) {
-    PointerData pointer_data = packet->GetPointerData(i);
+                         const PointerDataPacket& packet) {
+  for (size_t i = 0; i < packet.GetLength(); i++) {
+    PointerData pointer_data = packet.GetPointerData(i);
     output.push_back(pointer_data);
   }
-  packet.reset();
 }
 
 TEST(PointerDataPacketConverterTest, CanConvertPointerDataPacket) {
@@ -184,10 +183,10 @@ TEST(PointerDataPacketConverterTest, CanConvertPointerDataPacket) {
   CreateSimulatedPointerData(data, PointerData::Change::kRemove, 0, 3.0, 4.0,
                              0);
   packet->SetPointerData(5, data);
-  auto converted_packet = converter.Convert(*packet);
+  const PointerDataPacket& converted_packet = converter.Convert(*packet);
 
   std::vector<PointerData> result;
-  UnpackPointerPacket(result, std::move(converted_packet));
+  UnpackPointerPacket(result, converted_packet);
 
   ASSERT_EQ(result.size(), (size_t)6);
   ASSERT_EQ(result[0].change, PointerData::Change::kAdd);
@@ -231,10 +230,10 @@ TEST(PointerDataPacketConverterTest, CanSynthesizeDownAndUp) {
   CreateSimulatedPointerData(data, PointerData::Change::kRemove, 0, 3.0, 4.0,
                              0);
   packet->SetPointerData(3, data);
-  auto converted_packet = converter.Convert(*packet);
+  const PointerDataPacket& converted_packet = converter.Convert(*packet);
 
   std::vector<PointerData> result;
-  UnpackPointerPacket(result, std::move(converted_packet));
+  UnpackPointerPacket(result, converted_packet);
 
   ASSERT_EQ(result.size(), (size_t)6);
   ASSERT_EQ(result[0].change, PointerData::Change::kAdd);
@@ -290,10 +289,10 @@ TEST(PointerDataPacketConverterTest, CanUpdatePointerIdentifier) {
   CreateSimulatedPointerData(data, PointerData::Change::kRemove, 0, 3.0, 0.0,
                              0);
   packet->SetPointerData(6, data);
-  auto converted_packet = converter.Convert(*packet);
+  const PointerDataPacket& converted_packet = converter.Convert(*packet);
 
   std::vector<PointerData> result;
-  UnpackPointerPacket(result, std::move(converted_packet));
+  UnpackPointerPacket(result, converted_packet);
 
   ASSERT_EQ(result.size(), (size_t)7);
   ASSERT_EQ(result[0].change, PointerData::Change::kAdd);
@@ -342,10 +341,10 @@ TEST(PointerDataPacketConverterTest, AlwaysForwardMoveEvent) {
   CreateSimulatedPointerData(data, PointerData::Change::kUp, 0, 0.0, 0.0, 0);
   packet->SetPointerData(3, data);
 
-  auto converted_packet = converter.Convert(*packet);
+  const PointerDataPacket& converted_packet = converter.Convert(*packet);
 
   std::vector<PointerData> result;
-  UnpackPointerPacket(result, std::move(converted_packet));
+  UnpackPointerPacket(result, converted_packet);
 
   ASSERT_EQ(result.size(), (size_t)4);
   ASSERT_EQ(result[0].change, PointerData::Change::kAdd);
@@ -397,10 +396,10 @@ TEST(PointerDataPacketConverterTest, CanWorkWithDifferentDevices) {
   CreateSimulatedPointerData(data, PointerData::Change::kRemove, 1, 0.0, 4.0,
                              0);
   packet->SetPointerData(11, data);
-  auto converted_packet = converter.Convert(*packet);
+  const PointerDataPacket& converted_packet = converter.Convert(*packet);
 
   std::vector<PointerData> result;
-  UnpackPointerPacket(result, std::move(converted_packet));
+  UnpackPointerPacket(result, converted_packet);
 
   ASSERT_EQ(result.size(), (size_t)12);
   ASSERT_EQ(result[0].change, PointerData::Change::kAdd);
@@ -475,10 +474,10 @@ TEST(PointerDataPacketConverterTest, CanSynthesizeAdd) {
   packet->SetPointerData(0, data);
   CreateSimulatedPointerData(data, PointerData::Change::kUp, 0, 0.0, 0.0, 0);
   packet->SetPointerData(1, data);
-  auto converted_packet = converter.Convert(*packet);
+  const PointerDataPacket& converted_packet = converter.Convert(*packet);
 
   std::vector<PointerData> result;
-  UnpackPointerPacket(result, std::move(converted_packet));
+  UnpackPointerPacket(result, converted_packet);
 
   ASSERT_EQ(result.size(), (size_t)4);
   // A add should be synthesized.
@@ -521,15 +520,13 @@ TEST(PointerDataPacketConverterTest, CanHandleThreeFingerGesture) {
   auto packet = std::make_unique<PointerDataPacket>(1);
   CreateSimulatedPointerData(data, PointerData::Change::kDown, 0, 0.0, 0.0, 1);
   packet->SetPointerData(0, data);
-  auto converted_packet = converter.Convert(*packet);
-  UnpackPointerPacket(result, std::move(converted_packet));
+  UnpackPointerPacket(result, converter.Convert(*packet));
   // Second finger down.
   packet = std::make_unique<PointerDataPacket>(1);
   CreateSimulatedPointerData(data, PointerData::Change::kDown, 1, 33.0, 44.0,
                              1);
   packet->SetPointerData(0, data);
-  converted_packet = converter.Convert(*packet);
-  UnpackPointerPacket(result, std::move(converted_packet));
+  UnpackPointerPacket(result, converter.Convert(*packet));
   // Triggers three cancels.
   packet = std::make_unique<PointerDataPacket>(3);
   CreateSimulatedPointerData(data, PointerData::Change::kCancel, 1, 33.0, 44.0,
@@ -541,8 +538,7 @@ TEST(PointerDataPacketConverterTest, CanHandleThreeFingerGesture) {
   CreateSimulatedPointerData(data, PointerData::Change::kCancel, 2, 40.0, 50.0,
                              0);
   packet->SetPointerData(2, data);
-  converted_packet = converter.Convert(*packet);
-  UnpackPointerPacket(result, std::move(converted_packet));
+  UnpackPointerPacket(result, converter.Convert(*packet));
 
   ASSERT_EQ(result.size(), (size_t)6);
   ASSERT_EQ(result[0].change, PointerData::Change::kAdd);
@@ -620,10 +616,10 @@ TEST(PointerDataPacketConverterTest, CanConvertPointerSignals) {
     CreateSimulatedMousePointerData(data, PointerData::Change::kHover, kind, 2,
                                     10.0, 20.0, 30.0, 40.0, 0);
     packet->SetPointerData(5, data);
-    auto converted_packet = converter.Convert(*packet);
+    const PointerDataPacket& converted_packet = converter.Convert(*packet);
 
     std::vector<PointerData> result;
-    UnpackPointerPacket(result, std::move(converted_packet));
+    UnpackPointerPacket(result, converted_packet);
 
     ASSERT_EQ(result.size(), (size_t)9);
     ASSERT_EQ(result[0].change, PointerData::Change::kAdd);
@@ -718,10 +714,10 @@ TEST(PointerDataPacketConverterTest, CanConvertTrackpadGesture) {
   CreateSimulatedTrackpadGestureData(data, PointerData::Change::kPanZoomEnd, 0,
                                      0.0, 0.0, 0.0, 0.0, 1.0, 0.0);
   packet->SetPointerData(2, data);
-  auto converted_packet = converter.Convert(*packet);
+  const PointerDataPacket& converted_packet = converter.Convert(*packet);
 
   std::vector<PointerData> result;
-  UnpackPointerPacket(result, std::move(converted_packet));
+  UnpackPointerPacket(result, converted_packet);
 
   ASSERT_EQ(result.size(), (size_t)4);
   ASSERT_EQ(result[0].change, PointerData::Change::kAdd);
@@ -769,15 +765,34 @@ TEST(PointerDataPacketConverterTest, CanConvertViewId) {
   CreateSimulatedPointerData(data, PointerData::Change::kHover, 0, 1.0, 0.0, 0);
   data.view_id = 200;
   packet->SetPointerData(1, data);
-  auto converted_packet = converter.Convert(*packet);
+  const PointerDataPacket& converted_packet = converter.Convert(*packet);
 
   std::vector<PointerData> result;
-  UnpackPointerPacket(result, std::move(converted_packet));
+  UnpackPointerPacket(result, converted_packet);
 
   ASSERT_EQ(result.size(), (size_t)2);
   ASSERT_EQ(result[0].view_id, 100);
   ASSERT_EQ(result[1].view_id, 200);
 }
 
+TEST(PointerDataPacketConverterTest, ReusesConvertedPacket) {
+  TestDelegate delegate;
+  delegate.AddView(kImplicitViewId);
+  PointerDataPacketConverter converter(delegate);
+  PointerDataPacket packet(1);
+  PointerData data;
+  CreateSimulatedPointerData(data, PointerData::Change::kAdd, 0, 0.0, 0.0, 0);
+  packet.SetPointerData(0, data);
+  const PointerDataPacket& first = converter.Convert(packet);
+  ASSERT_EQ(first.GetLength(), (size_t)1);
+
+  CreateSimulatedPointerData(data, PointerData::Change::kHover, 0, 3.0, 0.0, 0);
+  packet.SetPointerData(0, data);
+  const PointerDataPacket& second = converter.Convert(packet);
+  ASSERT_EQ(&second, &first);
+  ASSERT_EQ(second.GetLength(), (size_t)1);
+  ASSERT_EQ(second.GetPointerData(0).change, PointerData::Change::kHover);
+}
+
 }  // namespace testing
 }  // namespace flutter
@@ -65,5 +65,27 @@ TEST(PointerDataPacketTest, CanGetLength) {
   ASSERT_EQ(packet->GetLength(), (size_t)6);
 }
 
+TEST(PointerDataPacketTest, CanAddPointerDataAndClear) {
+  PointerDataPacket packet(0);
+  PointerData data;
+  CreateSimpleSimulatedPointerData(data, PointerData::Change::kAdd, 1, 2.0, 3.0,
+                                   4);
+  packet.AddPointerData(data);
+  CreateSimpleSimulatedPointerData(data, PointerData::Change::kDown, 1, 5.0,
+                                   6.0, 4);
+  packet.AddPointerData(data);
+  ASSERT_EQ(packet.GetLength(), (size_t)2);
+  ASSERT_EQ(packet.GetPointerData(0).physical_x, 2.0);
+  ASSERT_EQ(packet.GetPointerData(1).physical_x, 5.0);
+
+  const uint8_t* storage = packet.data().data();
+  packet.Clear();
+  ASSERT_EQ(packet.GetLength(), (size_t)0);
+  packet.AddPointerData(data);
+  ASSERT_EQ(packet.GetLength(), (size_t)1);
+  // The storage is reused.
+  ASSERT_EQ(packet.data().data(), storage);
+}
+
 }  // namespace testing
 }  // namespace flutter
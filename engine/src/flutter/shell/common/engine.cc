@@ -169,6 +169,11 @@ fml::WeakPtr<ImageDecoder> Engine::GetImageDecoderWeakPtr() {
   return image_decoder_->GetWeakPtr();
 }
 
+void Engine::SetFramePhaseProfiler(
+    std::shared_ptr<FramePhaseProfiler> profiler) {
+  image_decoder_->SetFramePhaseProfiler(std::move(profiler));
+}
+
 fml::WeakPtr<ImageGeneratorRegistry> Engine::GetImageGeneratorRegistry() {
   return image_generator_registry_.GetWeakPtr();
 }
@@ -272,6 +277,10 @@ void Engine::NotifyIdle(fml::TimeDelta deadline) {
   runtime_controller_->NotifyIdle(deadline);
 }
 
+void Engine::NotifyLowMemoryWarning() {
+  image_decoder_->GetDecodedImageCache().Clear();
+}
+
 void Engine::NotifyDestroyed() {
   TRACE_EVENT0("flutter", "Engine::NotifyDestroyed");
   runtime_controller_->NotifyDestroyed();
@@ -548,13 +557,32 @@ void Engine::HandleAssetPlatformMessage(
   std::string asset_name(reinterpret_cast<const char*>(data.GetMapping()),
                          data.GetSize());
 
-  if (asset_manager_) {
-    std::unique_ptr<fml::Mapping> asset_mapping =
-        asset_manager_->GetAsMapping(asset_name);
-    if (asset_mapping) {
-      response->Complete(std::move(asset_mapping));
-      return;
-    }
+  if (!asset_manager_) {
+    response->CompleteEmpty();
+    return;
+  }
+
+  // Read the asset off the UI thread when there are workers to read it on.
+  DartVM* vm = runtime_controller_ ? runtime_controller_->GetDartVM() : nullptr;
+  if (vm) {
+    asset_manager_->GetAsMappingsAsync(
+        {std::move(asset_name)}, vm->GetConcurrentWorkerTaskRunner(),
+        task_runners_.GetUITaskRunner(),
+        [response](std::vector<std::unique_ptr<fml::Mapping>> mappings) {
+          if (mappings.front()) {
+            response->Complete(std::move(mappings.front()));
+          } else {
+            response->CompleteEmpty();
+          }
+        });
+    return;
+  }
+
+  std::unique_ptr<fml::Mapping> asset_mapping =
+      asset_manager_->GetAsMapping(asset_name);
+  if (asset_mapping) {
+    response->Complete(std::move(asset_mapping));
+    return;
   }
 
   response->CompleteEmpty();
@@ -10,6 +10,7 @@
 
 #include "flutter/assets/asset_manager.h"
 #include "flutter/common/task_runners.h"
+#include "flutter/flow/frame_phase_profiler.h"
 #include "flutter/fml/macros.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/memory/weak_ptr.h"
@@ -598,6 +599,14 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   ///             some cleanp activities.
   void NotifyDestroyed();
 
+  //----------------------------------------------------------------------------
+  /// @brief      Notifies the engine that the platform is low on memory. This
+  ///             releases the decoded images retained by the image decoder
+  ///             for reuse. It does not affect images still referenced from
+  ///             Dart.
+  ///
+  void NotifyLowMemoryWarning();
+
   //----------------------------------------------------------------------------
   /// @brief      Dart code cannot fully measure the time it takes for a
   ///             specific frame to be rendered. This is because Dart code only
@@ -854,6 +863,10 @@ class Engine final : public RuntimeDelegate, PointerDataDispatcher::Delegate {
   // Return the weak_ptr of ImageDecoder.
   fml::WeakPtr<ImageDecoder> GetImageDecoderWeakPtr();
 
+  // Sets the profiler that records the texture uploads of the image decoder.
+  // Must be called before the engine is run.
+  void SetFramePhaseProfiler(std::shared_ptr<FramePhaseProfiler> profiler);
+
   //----------------------------------------------------------------------------
   /// @brief      Get the `ImageGeneratorRegistry` associated with the current
   ///             engine.
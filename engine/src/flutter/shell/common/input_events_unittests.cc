@@ -440,6 +440,110 @@ TEST_F(ShellTest, CanCorrectlySynthesizePointerPacket) {
   ASSERT_FALSE(DartVMRef::IsInstanceRunning());
 }
 
+namespace {
+
+class FakePointerDataDispatcherDelegate
+    : public PointerDataDispatcher::Delegate {
+ public:
+  void DoDispatchPacket(std::unique_ptr<PointerDataPacket> packet,
+                        uint64_t trace_flow_id) override {
+    packets.push_back(std::move(packet));
+  }
+
+  void ScheduleSecondaryVsyncCallback(uintptr_t id,
+                                      const fml::closure& callback) override {
+    vsync_callback = callback;
+  }
+
+  void FireVsync() {
+    fml::closure callback = std::move(vsync_callback);
+    vsync_callback = nullptr;
+    if (callback) {
+      callback();
+    }
+  }
+
+  std::vector<std::unique_ptr<PointerDataPacket>> packets;
+  fml::closure vsync_callback;
+};
+
+std::unique_ptr<PointerDataPacket> CreateSimulatedPointerPacket(
+    const std::vector<PointerData>& events) {
+  auto packet = std::make_unique<PointerDataPacket>(events.size());
+  for (size_t i = 0; i < events.size(); i++) {
+    packet->SetPointerData(i, events[i]);
+  }
+  return packet;
+}
+
+}  // namespace
+
+TEST(CoalescingPointerDataDispatcherTest, MergesMovesWithinAFrame) {
+  FakePointerDataDispatcherDelegate delegate;
+  CoalescingPointerDataDispatcher dispatcher(delegate);
+
+  PointerData down;
+  CreateSimulatedPointerData(down, PointerData::Change::kDown, 0.0, 0.0);
+  PointerData moves[4];
+  for (int i = 0; i < 4; i++) {
+    CreateSimulatedPointerData(moves[i], PointerData::Change::kMove, i + 1,
+                               i + 1);
+  }
+  PointerData up;
+  CreateSimulatedPointerData(up, PointerData::Change::kUp, 4.0, 4.0);
+
+  // The first packet of a frame is dispatched right away.
+  dispatcher.DispatchPacket(CreateSimulatedPointerPacket({down}), 0);
+  ASSERT_EQ(delegate.packets.size(), 1u);
+
+  // Later packets in the same frame are merged until the next vsync.
+  dispatcher.DispatchPacket(CreateSimulatedPointerPacket({moves[0]}), 1);
+  dispatcher.DispatchPacket(CreateSimulatedPointerPacket({moves[1]}), 2);
+  dispatcher.DispatchPacket(CreateSimulatedPointerPacket({moves[2], up}), 3);
+  ASSERT_EQ(delegate.packets.size(), 1u);
+
+  delegate.FireVsync();
+  ASSERT_EQ(delegate.packets.size(), 2u);
+  ASSERT_EQ(delegate.packets[1]->GetLength(), 2u);
+  EXPECT_EQ(delegate.packets[1]->GetPointerData(0).change,
+            PointerData::Change::kMove);
+  EXPECT_EQ(delegate.packets[1]->GetPointerData(0).physical_x, 3.0);
+  EXPECT_EQ(delegate.packets[1]->GetPointerData(1).change,
+            PointerData::Change::kUp);
+
+  // A frame without input ends the coalescing, so the next packet is
+  // dispatched right away again.
+  delegate.FireVsync();
+  ASSERT_EQ(delegate.packets.size(), 2u);
+  EXPECT_FALSE(delegate.vsync_callback);
+  dispatcher.DispatchPacket(CreateSimulatedPointerPacket({moves[3]}), 4);
+  ASSERT_EQ(delegate.packets.size(), 3u);
+}
+
+TEST(CoalescingPointerDataDispatcherTest, DoesNotMergeDifferentPointers) {
+  FakePointerDataDispatcherDelegate delegate;
+  CoalescingPointerDataDispatcher dispatcher(delegate);
+
+  PointerData first_move;
+  CreateSimulatedPointerData(first_move, PointerData::Change::kMove, 1.0, 1.0);
+  PointerData second_move = first_move;
+  second_move.device = 1;
+  PointerData pressed_move = first_move;
+  pressed_move.buttons = kPointerButtonMousePrimary;
+
+  dispatcher.DispatchPacket(CreateSimulatedPointerPacket({first_move}), 0);
+  dispatcher.DispatchPacket(
+      CreateSimulatedPointerPacket({first_move, second_move, pressed_move}), 1);
+  delegate.FireVsync();
+
+  ASSERT_EQ(delegate.packets.size(), 2u);
+  ASSERT_EQ(delegate.packets[1]->GetLength(), 3u);
+  EXPECT_EQ(delegate.packets[1]->GetPointerData(0).device, 0);
+  EXPECT_EQ(delegate.packets[1]->GetPointerData(1).device, 1);
+  EXPECT_EQ(delegate.packets[1]->GetPointerData(2).buttons,
+            kPointerButtonMousePrimary);
+}
+
 }  // namespace testing
 }  // namespace flutter
 
@@ -110,6 +110,11 @@ std::shared_ptr<impeller::Context> PlatformView::GetImpellerContext() const {
 void PlatformView::ReleaseResourceContext() const {}
 
 PointerDataDispatcherMaker PlatformView::GetDispatcherMaker() {
+  if (delegate_.OnPlatformViewGetSettings().coalesce_pointer_events) {
+    return [](DefaultPointerDataDispatcher::Delegate& delegate) {
+      return std::make_unique<CoalescingPointerDataDispatcher>(delegate);
+    };
+  }
   return [](DefaultPointerDataDispatcher::Delegate& delegate) {
     return std::make_unique<DefaultPointerDataDispatcher>(delegate);
   };
@@ -4,6 +4,8 @@
 
 #include "flutter/shell/common/pointer_data_dispatcher.h"
 
+#include <string>
+
 #include "flutter/fml/trace_event.h"
 
 namespace flutter {
@@ -15,6 +17,11 @@ SmoothPointerDataDispatcher::SmoothPointerDataDispatcher(Delegate& delegate)
     : DefaultPointerDataDispatcher(delegate), weak_factory_(this) {}
 SmoothPointerDataDispatcher::~SmoothPointerDataDispatcher() = default;
 
+CoalescingPointerDataDispatcher::CoalescingPointerDataDispatcher(
+    Delegate& delegate)
+    : DefaultPointerDataDispatcher(delegate), weak_factory_(this) {}
+CoalescingPointerDataDispatcher::~CoalescingPointerDataDispatcher() = default;
+
 void DefaultPointerDataDispatcher::DispatchPacket(
     std::unique_ptr<PointerDataPacket> packet,
     uint64_t trace_flow_id) {
@@ -72,4 +79,93 @@ void SmoothPointerDataDispatcher::DispatchPendingPacket() {
   ScheduleSecondaryVsyncCallback();
 }
 
+namespace {
+
+// Whether |next| can replace |previous|, the preceding event of the same
+// device, without the framework missing anything but intermediate positions.
+bool CanCoalesce(const PointerData& previous, const PointerData& next) {
+  if (next.change != PointerData::Change::kMove &&
+      next.change != PointerData::Change::kHover) {
+    return false;
+  }
+  return previous.change == next.change &&
+         previous.signal_kind == PointerData::SignalKind::kNone &&
+         next.signal_kind == PointerData::SignalKind::kNone &&
+         previous.kind == next.kind && previous.buttons == next.buttons &&
+         previous.pointer_identifier == next.pointer_identifier &&
+         previous.view_id == next.view_id;
+}
+
+}  // namespace
+
+void CoalescingPointerDataDispatcher::DispatchPacket(
+    std::unique_ptr<PointerDataPacket> packet,
+    uint64_t trace_flow_id) {
+  TRACE_EVENT0_WITH_FLOW_IDS("flutter",
+                             "CoalescingPointerDataDispatcher::DispatchPacket",
+                             /*flow_id_count=*/1, &trace_flow_id);
+  TRACE_FLOW_STEP("flutter", "PointerEvent", trace_flow_id);
+
+  if (!is_pointer_data_in_progress_) {
+    FML_DCHECK(pending_pointer_data_.empty());
+    DefaultPointerDataDispatcher::DispatchPacket(std::move(packet),
+                                                 trace_flow_id);
+  } else {
+    for (size_t i = 0; i < packet->GetLength(); i++) {
+      AddPendingPointerData(packet->GetPointerData(i));
+    }
+    // The pending events are dispatched with the flow of the latest packet.
+    if (has_pending_trace_flow_id_) {
+      TRACE_FLOW_END("flutter", "PointerEvent", pending_trace_flow_id_);
+    }
+    pending_trace_flow_id_ = trace_flow_id;
+    has_pending_trace_flow_id_ = true;
+  }
+  is_pointer_data_in_progress_ = true;
+  ScheduleSecondaryVsyncCallback();
+}
+
+void CoalescingPointerDataDispatcher::AddPendingPointerData(
+    const PointerData& pointer_data) {
+  auto latest = latest_pending_index_.find(pointer_data.device);
+  if (latest != latest_pending_index_.end() &&
+      CanCoalesce(pending_pointer_data_[latest->second], pointer_data)) {
+    pending_pointer_data_[latest->second] = pointer_data;
+    return;
+  }
+  latest_pending_index_[pointer_data.device] = pending_pointer_data_.size();
+  pending_pointer_data_.push_back(pointer_data);
+}
+
+void CoalescingPointerDataDispatcher::ScheduleSecondaryVsyncCallback() {
+  delegate_.ScheduleSecondaryVsyncCallback(
+      reinterpret_cast<uintptr_t>(this),
+      [dispatcher = weak_factory_.GetWeakPtr()]() {
+        if (dispatcher && dispatcher->is_pointer_data_in_progress_) {
+          if (dispatcher->has_pending_trace_flow_id_) {
+            dispatcher->DispatchPendingPointerData();
+          } else {
+            dispatcher->is_pointer_data_in_progress_ = false;
+          }
+        }
+      });
+}
+
+void CoalescingPointerDataDispatcher::DispatchPendingPointerData() {
+  FML_DCHECK(has_pending_trace_flow_id_);
+  FML_DCHECK(is_pointer_data_in_progress_);
+  TRACE_EVENT1("flutter",
+               "CoalescingPointerDataDispatcher::DispatchPendingPointerData",
+               "count", std::to_string(pending_pointer_data_.size()).c_str());
+  auto packet = std::make_unique<PointerDataPacket>(
+      reinterpret_cast<uint8_t*>(pending_pointer_data_.data()),
+      pending_pointer_data_.size() * sizeof(PointerData));
+  pending_pointer_data_.clear();
+  latest_pending_index_.clear();
+  has_pending_trace_flow_id_ = false;
+  DefaultPointerDataDispatcher::DispatchPacket(std::move(packet),
+                                               pending_trace_flow_id_);
+  ScheduleSecondaryVsyncCallback();
+}
+
 }  // namespace flutter
@@ -5,6 +5,9 @@
 #ifndef FLUTTER_SHELL_COMMON_POINTER_DATA_DISPATCHER_H_
 #define FLUTTER_SHELL_COMMON_POINTER_DATA_DISPATCHER_H_
 
+#include <unordered_map>
+#include <vector>
+
 #include "flutter/runtime/runtime_controller.h"
 #include "flutter/shell/common/animator.h"
 
@@ -163,6 +166,54 @@ class SmoothPointerDataDispatcher : public DefaultPointerDataDispatcher {
   FML_DISALLOW_COPY_AND_ASSIGN(SmoothPointerDataDispatcher);
 };
 
+//------------------------------------------------------------------------------
+/// A dispatcher that merges pointer moves which arrive faster than frames are
+/// produced, e.g. from 240Hz touch screens and styluses.
+///
+/// Like `SmoothPointerDataDispatcher`, the first packet of a frame is
+/// dispatched right away, so input delivered at or below the VSYNC rate is
+/// not delayed. Packets that arrive while the pointer data of the current
+/// frame is still in progress are held back until the next VSYNC, and their
+/// events are dispatched together as a single packet.
+///
+/// While held back, a move or hover event replaces the previous pending event
+/// of the same device if that was also a move or hover with the same buttons.
+/// Only the latest position of each pointer reaches the framework. Other
+/// events, such as downs and ups, are never merged, so the pending events of
+/// a pointer always keep their order.
+///
+/// The pending events are kept in a buffer that is reused for every frame.
+///
+/// This is enabled with `Settings::coalesce_pointer_events`.
+class CoalescingPointerDataDispatcher : public DefaultPointerDataDispatcher {
+ public:
+  explicit CoalescingPointerDataDispatcher(Delegate& delegate);
+
+  // |PointerDataDispatcer|
+  void DispatchPacket(std::unique_ptr<PointerDataPacket> packet,
+                      uint64_t trace_flow_id) override;
+
+  virtual ~CoalescingPointerDataDispatcher();
+
+ private:
+  void AddPendingPointerData(const PointerData& pointer_data);
+  void DispatchPendingPointerData();
+  void ScheduleSecondaryVsyncCallback();
+
+  // The events to dispatch at the next VSYNC. The buffer is cleared but not
+  // freed after each dispatch.
+  std::vector<PointerData> pending_pointer_data_;
+  // The index in `pending_pointer_data_` of the latest event of each device.
+  std::unordered_map<int64_t, size_t> latest_pending_index_;
+  uint64_t pending_trace_flow_id_ = 0;
+  bool has_pending_trace_flow_id_ = false;
+  bool is_pointer_data_in_progress_ = false;
+
+  // WeakPtrFactory must be the last member.
+  fml::WeakPtrFactory<CoalescingPointerDataDispatcher> weak_factory_;
+  FML_DISALLOW_COPY_AND_ASSIGN(CoalescingPointerDataDispatcher);
+};
+
 //--------------------------------------------------------------------------
 /// @brief      Signature for constructing PointerDataDispatcher.
 ///
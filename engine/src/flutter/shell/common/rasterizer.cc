@@ -12,6 +12,7 @@
 #include "flow/frame_timings.h"
 #include "flutter/common/constants.h"
 #include "flutter/common/graphics/persistent_cache.h"
+#include "flutter/flow/frame_phase_profiler.h"
 #include "flutter/flow/layers/offscreen_surface.h"
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
@@ -90,6 +91,14 @@ void Rasterizer::Setup(std::unique_ptr<Surface> surface) {
     compositor_context_->OnGrContextCreated();
   }
 
+#if IMPELLER_SUPPORTS_RENDERING
+  if (delegate_.GetSettings().enable_impeller_lazy_mipmaps) {
+    if (auto aiks_context = surface_->GetAiksContext()) {
+      aiks_context->GetContentContext().SetLazyMipmapGeneration(true);
+    }
+  }
+#endif  // IMPELLER_SUPPORTS_RENDERING
+
   if (external_view_embedder_ &&
       external_view_embedder_->SupportsDynamicThreadMerging() &&
       !raster_thread_merger_) {
@@ -577,6 +586,8 @@ Rasterizer::DoDrawResult Rasterizer::DrawToSurfaces(
     std::vector<std::unique_ptr<LayerTreeTask>> tasks) {
   TRACE_EVENT0("flutter", "Rasterizer::DrawToSurfaces");
   FML_DCHECK(surface_);
+  FramePhaseProfiler::ScopedCurrent current_profiler(
+      frame_phase_profiler_.get());
   frame_timings_recorder.AssertInState(FrameTimingsRecorder::State::kBuildEnd);
 
   DoDrawResult result{
@@ -712,7 +723,11 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
   //
   // Deleting a surface also clears the GL context. Therefore, acquire the
   // frame after calling `BeginFrame` as this operation resets the GL context.
-  auto frame = surface_->AcquireFrame(layer_tree.frame_size());
+  std::unique_ptr<SurfaceFrame> frame;
+  {
+    FramePhaseProfiler::ScopedPhase phase(FramePhase::kAcquireFrame);
+    frame = surface_->AcquireFrame(layer_tree.frame_size());
+  }
   if (frame == nullptr) {
     return DrawSurfaceStatus::kFailed;
   }
@@ -785,14 +800,17 @@ DrawSurfaceStatus Rasterizer::DrawToSurfaceUnsafe(
 
     frame->set_submit_info(submit_info);
 
-    if (external_view_embedder_ &&
-        (!raster_thread_merger_ || raster_thread_merger_->IsMerged())) {
-      FML_DCHECK(!frame->IsSubmitted());
-      external_view_embedder_->SubmitFlutterView(
-          view_id, surface_->GetContext(), surface_->GetAiksContext(),
-          std::move(frame));
-    } else {
-      frame->Submit();
+    {
+      FramePhaseProfiler::ScopedPhase phase(FramePhase::kSubmit);
+      if (external_view_embedder_ &&
+          (!raster_thread_merger_ || raster_thread_merger_->IsMerged())) {
+        FML_DCHECK(!frame->IsSubmitted());
+        external_view_embedder_->SubmitFlutterView(
+            view_id, surface_->GetContext(), surface_->GetAiksContext(),
+            std::move(frame));
+      } else {
+        frame->Submit();
+      }
     }
 
 #if !SLIMPELLER
@@ -1091,6 +1109,11 @@ void Rasterizer::SetExternalViewEmbedder(
   external_view_embedder_ = view_embedder;
 }
 
+void Rasterizer::SetFramePhaseProfiler(
+    std::shared_ptr<FramePhaseProfiler> profiler) {
+  frame_phase_profiler_ = std::move(profiler);
+}
+
 void Rasterizer::SetSnapshotSurfaceProducer(
     std::unique_ptr<SnapshotSurfaceProducer> producer) {
   snapshot_surface_producer_ = std::move(producer);
@@ -14,6 +14,7 @@
 #include "flutter/display_list/image/dl_image.h"
 #include "flutter/flow/compositor_context.h"
 #include "flutter/flow/embedded_views.h"
+#include "flutter/flow/frame_phase_profiler.h"
 #include "flutter/flow/frame_timings.h"
 #include "flutter/flow/layers/layer_tree.h"
 #include "flutter/flow/surface.h"
@@ -25,6 +26,7 @@
 #include "flutter/fml/time/time_delta.h"
 #include "flutter/fml/time/time_point.h"
 #if IMPELLER_SUPPORTS_RENDERING
+#include "flutter/shell/common/shared_aiks_context.h"
 #include "impeller/aiks/aiks_context.h"  // nogncheck
 #include "impeller/core/formats.h"       // nogncheck
 #include "impeller/renderer/context.h"   // nogncheck
@@ -485,6 +487,14 @@ class Rasterizer final : public SnapshotDelegate,
   ///
   void SetNextFrameCallback(const fml::closure& callback);
 
+  //----------------------------------------------------------------------------
+  /// @brief Set the profiler that records the phases of the frames drawn by
+  ///        this rasterizer. This is done on shell initialization.
+  ///
+  /// @param[in] profiler The frame phase profiler of the shell.
+  ///
+  void SetFramePhaseProfiler(std::shared_ptr<FramePhaseProfiler> profiler);
+
   //----------------------------------------------------------------------------
   /// @brief Set the External View Embedder. This is done on shell
   ///        initialization. This is non-null on platforms that support
@@ -677,8 +687,7 @@ class Rasterizer final : public SnapshotDelegate,
       return surface_->GetAiksContext();
     }
     if (auto context = impeller_context_.lock()) {
-      return std::make_shared<impeller::AiksContext>(
-          context, impeller::TypographerContextSkia::Make());
+      return GetSharedAiksContext(context);
     }
 #endif
     return nullptr;
@@ -758,6 +767,7 @@ class Rasterizer final : public SnapshotDelegate,
   std::optional<size_t> max_cache_bytes_;
   fml::RefPtr<fml::RasterThreadMerger> raster_thread_merger_;
   std::shared_ptr<ExternalViewEmbedder> external_view_embedder_;
+  std::shared_ptr<FramePhaseProfiler> frame_phase_profiler_;
   std::unique_ptr<SnapshotController> snapshot_controller_;
 
   // WeakPtrFactory must be the last member.
@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "flutter/assets/directory_asset_bundle.h"
+#include "flutter/assets/packed_asset_bundle.h"
 #include "flutter/common/graphics/persistent_cache.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/unique_fd.h"
@@ -16,6 +17,32 @@
 
 namespace flutter {
 
+namespace {
+
+// Resolves assets from the packed archive in |assets_directory| if there is
+// one, ahead of the loose files in the directory.
+//
+// When running from a kernel snapshot, the tool updates the loose files for
+// hot reload and restart, and those must not be shadowed by the assets the
+// archive was packed with. The archive is not used then.
+void PushPackedAssetBundle(AssetManager& asset_manager,
+                           const fml::UniqueFD& assets_directory) {
+  if (!DartVM::IsRunningPrecompiledCode()) {
+    return;
+  }
+  if (!assets_directory.is_valid() ||
+      !fml::FileExists(assets_directory,
+                       PackedAssetBundle::kArchiveFileName)) {
+    return;
+  }
+  asset_manager.PushBack(std::make_unique<PackedAssetBundle>(
+      fml::OpenFileReadOnly(assets_directory,
+                            PackedAssetBundle::kArchiveFileName),
+      true));
+}
+
+}  // namespace
+
 RunConfiguration RunConfiguration::InferFromSettings(
     const Settings& settings,
     const fml::RefPtr<fml::TaskRunner>& io_worker,
@@ -23,14 +50,17 @@ RunConfiguration RunConfiguration::InferFromSettings(
   auto asset_manager = std::make_shared<AssetManager>();
 
   if (fml::UniqueFD::traits_type::IsValid(settings.assets_dir)) {
-    asset_manager->PushBack(std::make_unique<DirectoryAssetBundle>(
-        fml::Duplicate(settings.assets_dir), true));
+    fml::UniqueFD assets_dir = fml::Duplicate(settings.assets_dir);
+    PushPackedAssetBundle(*asset_manager, assets_dir);
+    asset_manager->PushBack(
+        std::make_unique<DirectoryAssetBundle>(std::move(assets_dir), true));
   }
 
-  asset_manager->PushBack(std::make_unique<DirectoryAssetBundle>(
-      fml::OpenDirectory(settings.assets_path.c_str(), false,
-                         fml::FilePermission::kRead),
-      true));
+  fml::UniqueFD assets_path = fml::OpenDirectory(
+      settings.assets_path.c_str(), false, fml::FilePermission::kRead);
+  PushPackedAssetBundle(*asset_manager, assets_path);
+  asset_manager->PushBack(
+      std::make_unique<DirectoryAssetBundle>(std::move(assets_path), true));
 
   return {IsolateConfiguration::InferFromSettings(settings, asset_manager,
                                                   io_worker, launch_type),
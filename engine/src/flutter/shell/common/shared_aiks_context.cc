@@ -0,0 +1,67 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/shared_aiks_context.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "flutter/fml/trace_event.h"
+#include "impeller/typographer/backends/skia/typographer_context_skia.h"
+
+namespace flutter {
+
+namespace {
+
+struct SharedAiksContext {
+  std::weak_ptr<impeller::Context> context;
+  std::weak_ptr<impeller::AiksContext> aiks_context;
+};
+
+}  // namespace
+
+std::shared_ptr<impeller::AiksContext> GetSharedAiksContext(
+    const std::shared_ptr<impeller::Context>& context) {
+  // There are only ever a handful of contexts per thread.
+  thread_local std::vector<SharedAiksContext> shared_aiks_contexts;
+
+  std::shared_ptr<impeller::AiksContext> aiks_context;
+  shared_aiks_contexts.erase(
+      std::remove_if(shared_aiks_contexts.begin(), shared_aiks_contexts.end(),
+                     [&context, &aiks_context](const SharedAiksContext& entry) {
+                       auto shared_aiks_context = entry.aiks_context.lock();
+                       if (!shared_aiks_context) {
+                         return true;
+                       }
+                       if (entry.context.lock() == context) {
+                         aiks_context = std::move(shared_aiks_context);
+                       }
+                       return false;
+                     }),
+      shared_aiks_contexts.end());
+  if (aiks_context) {
+    return aiks_context;
+  }
+
+  TRACE_EVENT0("flutter", "CreateAiksContext");
+  aiks_context = std::make_shared<impeller::AiksContext>(
+      context, impeller::TypographerContextSkia::Make());
+  if (aiks_context->IsValid()) {
+    shared_aiks_contexts.push_back({context, aiks_context});
+  }
+  return aiks_context;
+}
+
+ScopedTransientsBuffer::ScopedTransientsBuffer(
+    impeller::ContentContext& content_context,
+    std::shared_ptr<impeller::HostBuffer> host_buffer)
+    : content_context_(content_context),
+      previous_host_buffer_(
+          content_context.SetTransientsBuffer(std::move(host_buffer))) {}
+
+ScopedTransientsBuffer::~ScopedTransientsBuffer() {
+  content_context_.SetTransientsBuffer(std::move(previous_host_buffer_));
+}
+
+}  // namespace flutter
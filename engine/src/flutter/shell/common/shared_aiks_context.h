@@ -0,0 +1,68 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_SHARED_AIKS_CONTEXT_H_
+#define FLUTTER_SHELL_COMMON_SHARED_AIKS_CONTEXT_H_
+
+#include <memory>
+
+#include "flutter/fml/macros.h"
+#include "impeller/aiks/aiks_context.h"
+#include "impeller/core/host_buffer.h"
+#include "impeller/entity/contents/content_context.h"
+#include "impeller/renderer/context.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      Returns the Aiks context that renders with |context| on the
+///             calling thread, and creates it if there is none.
+///
+///             Creating an Aiks context builds the pipelines of its content
+///             context and starts with an empty glyph atlas. Shells spawned
+///             from one another share their Impeller context and raster
+///             thread, so their surfaces share one Aiks context instead of
+///             each building their own. Surfaces recreated while another
+///             surface is alive reuse it too.
+///
+///             Aiks contexts are not thread safe, so they are only shared on
+///             the thread they were created on. A context is destroyed once
+///             the last surface using it is.
+///
+///             Surfaces sharing an Aiks context must render with their own
+///             transients buffer, see |ScopedTransientsBuffer|.
+///
+/// @return     The shared Aiks context, or an invalid one if it could not be
+///             created.
+///
+std::shared_ptr<impeller::AiksContext> GetSharedAiksContext(
+    const std::shared_ptr<impeller::Context>& context);
+
+//------------------------------------------------------------------------------
+/// @brief      Installs a transients buffer in a content context for as long as
+///             it is in scope, and restores the previous one afterwards.
+///
+///             Each surface resets the transients buffer once per frame it
+///             renders. A host buffer only cycles through a few arenas, so
+///             surfaces sharing one buffer would recycle the allocations of
+///             frames that the GPU may still be reading. Giving each surface
+///             its own buffer makes it cycle once per frame of that surface.
+///
+class ScopedTransientsBuffer {
+ public:
+  ScopedTransientsBuffer(impeller::ContentContext& content_context,
+                         std::shared_ptr<impeller::HostBuffer> host_buffer);
+
+  ~ScopedTransientsBuffer();
+
+ private:
+  impeller::ContentContext& content_context_;
+  std::shared_ptr<impeller::HostBuffer> previous_host_buffer_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(ScopedTransientsBuffer);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_SHARED_AIKS_CONTEXT_H_
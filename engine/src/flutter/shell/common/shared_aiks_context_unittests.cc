@@ -0,0 +1,72 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/shared_aiks_context.h"
+
+#include <memory>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "impeller/renderer/testing/mocks.h"
+#include "impeller/typographer/backends/skia/typographer_context_skia.h"
+
+namespace flutter {
+namespace testing {
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace {
+
+std::shared_ptr<impeller::Context> CreateMockContext() {
+  auto allocator =
+      std::make_shared<NiceMock<impeller::testing::MockAllocator>>();
+  ON_CALL(*allocator, OnCreateBuffer)
+      .WillByDefault([](const impeller::DeviceBufferDescriptor& desc)
+                         -> std::shared_ptr<impeller::DeviceBuffer> {
+        return std::make_shared<impeller::testing::MockDeviceBuffer>(desc);
+      });
+  auto context =
+      std::make_shared<NiceMock<impeller::testing::MockImpellerContext>>();
+  ON_CALL(*context, GetResourceAllocator).WillByDefault(Return(allocator));
+  return context;
+}
+
+}  // namespace
+
+TEST(SharedAiksContextTest, SurfacesCycleTheirOwnTransientsBuffers) {
+  auto context = CreateMockContext();
+  impeller::ContentContext content_context(
+      context, impeller::TypographerContextSkia::Make());
+  impeller::HostBuffer* default_buffer = &content_context.GetTransientsBuffer();
+
+  // More surfaces than a host buffer has arenas.
+  constexpr size_t kSurfaceCount = impeller::kHostBufferArenaSize + 2;
+  std::vector<std::shared_ptr<impeller::HostBuffer>> surface_buffers;
+  for (size_t i = 0; i < kSurfaceCount; i++) {
+    surface_buffers.push_back(
+        impeller::HostBuffer::Create(context->GetResourceAllocator()));
+  }
+
+  constexpr size_t kFrameCount = impeller::kHostBufferArenaSize - 1;
+  for (size_t frame = 0; frame < kFrameCount; frame++) {
+    for (const auto& surface_buffer : surface_buffers) {
+      ScopedTransientsBuffer scoped_transients_buffer(content_context,
+                                                      surface_buffer);
+      ASSERT_EQ(&content_context.GetTransientsBuffer(), surface_buffer.get());
+      content_context.GetTransientsBuffer().Reset();
+    }
+    EXPECT_EQ(&content_context.GetTransientsBuffer(), default_buffer);
+  }
+
+  // Each surface only advanced its own buffer once per frame it rendered.
+  for (const auto& surface_buffer : surface_buffers) {
+    EXPECT_EQ(surface_buffer->GetStateForTest().current_frame, kFrameCount);
+  }
+  EXPECT_EQ(default_buffer->GetStateForTest().current_frame, 0u);
+}
+
+}  // namespace testing
+}  // namespace flutter
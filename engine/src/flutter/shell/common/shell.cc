@@ -176,22 +176,31 @@ std::unique_ptr<Shell> Shell::Create(
 
   TRACE_EVENT0("flutter", "Shell::Create");
 
+  const fml::TimePoint vm_start = fml::TimePoint::Now();
   auto [vm, isolate_snapshot] = InferVmInitDataFromSettings(settings);
+  const fml::TimePoint vm_end = fml::TimePoint::Now();
   auto resource_cache_limit_calculator =
       std::make_shared<ResourceCacheLimitCalculator>(
           settings.resource_cache_max_bytes_threshold);
 
-  return CreateWithSnapshot(platform_data,                     //
-                            task_runners,                      //
-                            /*parent_thread_merger=*/nullptr,  //
-                            /*parent_io_manager=*/nullptr,     //
-                            resource_cache_limit_calculator,   //
-                            settings,                          //
-                            std::move(vm),                     //
-                            std::move(isolate_snapshot),       //
-                            on_create_platform_view,           //
-                            on_create_rasterizer,              //
-                            CreateEngine, is_gpu_disabled);
+  auto shell =
+      CreateWithSnapshot(platform_data,                     //
+                         task_runners,                      //
+                         /*parent_thread_merger=*/nullptr,  //
+                         /*parent_io_manager=*/nullptr,     //
+                         resource_cache_limit_calculator,   //
+                         settings,                          //
+                         std::move(vm),                     //
+                         std::move(isolate_snapshot),       //
+                         on_create_platform_view,           //
+                         on_create_rasterizer,              //
+                         CreateEngine, is_gpu_disabled);
+  if (shell) {
+    // The VM has to exist before the shell, so it is recorded afterwards.
+    shell->GetStartupTimeline()->Record(StartupPhase::kVMInitialization,
+                                        vm_start, vm_end);
+  }
+  return shell;
 }
 
 static impeller::RuntimeStageBackend DetermineRuntimeStageBackend(
@@ -232,8 +241,19 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
       new Shell(std::move(vm), task_runners, std::move(parent_merger),
                 resource_cache_limit_calculator, settings, is_gpu_disabled));
 
+  // The tasks that set up the subsystems below keep their own reference to
+  // the timeline, as the shell is destroyed as soon as one subsystem fails
+  // while the others may still be setting up.
+  const std::shared_ptr<StartupTimeline>& startup_timeline =
+      shell->GetStartupTimeline();
+
   // Create the platform view on the platform thread (this thread).
-  auto platform_view = on_create_platform_view(*shell.get());
+  std::unique_ptr<PlatformView> platform_view;
+  {
+    StartupTimeline::ScopedPhase startup_phase(
+        *startup_timeline, StartupPhase::kPlatformViewSetup);
+    platform_view = on_create_platform_view(*shell.get());
+  }
   if (!platform_view || !platform_view->GetWeakPtr()) {
     return nullptr;
   }
@@ -250,9 +270,12 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
        &snapshot_delegate_promise,
        on_create_rasterizer,                                   //
        shell = shell.get(),                                    //
+       startup_timeline,                                       //
        impeller_context = platform_view->GetImpellerContext()  //
   ]() {
         TRACE_EVENT0("flutter", "ShellSetupGPUSubsystem");
+        StartupTimeline::ScopedPhase startup_phase(
+            *startup_timeline, StartupPhase::kRasterizerSetup);
         std::unique_ptr<Rasterizer> rasterizer(on_create_rasterizer(*shell));
         rasterizer->SetImpellerContext(impeller_context);
         snapshot_delegate_promise.set_value(rasterizer->GetSnapshotDelegate());
@@ -289,9 +312,12 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
        &unref_queue_promise,                                              //
        platform_view_ptr,                                                 //
        io_task_runner,                                                    //
+       startup_timeline,                                                  //
        is_backgrounded_sync_switch = shell->GetIsGpuDisabledSyncSwitch()  //
   ]() {
         TRACE_EVENT0("flutter", "ShellSetupIOSubsystem");
+        StartupTimeline::ScopedPhase startup_phase(
+            *startup_timeline, StartupPhase::kIOManagerSetup);
         std::shared_ptr<ShellIOManager> io_manager;
         if (parent_io_manager) {
           io_manager = parent_io_manager;
@@ -326,10 +352,13 @@ std::unique_ptr<Shell> Shell::CreateShellOnPlatformThread(
                          &weak_io_manager_future,                         //
                          &snapshot_delegate_future,                       //
                          &unref_queue_future,                             //
-                         &on_create_engine,
+                         &on_create_engine,                               //
+                         startup_timeline,                                //
                          runtime_stage_backend = DetermineRuntimeStageBackend(
                              platform_view->GetImpellerContext())]() mutable {
         TRACE_EVENT0("flutter", "ShellSetupUISubsystem");
+        StartupTimeline::ScopedPhase startup_phase(
+            *startup_timeline, StartupPhase::kEngineSetup);
         const auto& task_runners = shell->GetTaskRunners();
 
         // The animator is owned by the UI thread but it gets its vsync pulses
@@ -439,6 +468,8 @@ Shell::Shell(DartVMRef vm,
       settings_(settings),
       vm_(std::move(vm)),
       is_gpu_disabled_sync_switch_(new fml::SyncSwitch(is_gpu_disabled)),
+      startup_timeline_(std::make_shared<StartupTimeline>()),
+      frame_phase_profiler_(std::make_shared<FramePhaseProfiler>()),
       weak_factory_gpu_(nullptr),
       weak_factory_(this) {
   FML_CHECK(!settings.enable_software_rendering || !settings.enable_impeller)
@@ -637,6 +668,11 @@ void Shell::NotifyLowMemoryWarning() const {
         TRACE_EVENT_ASYNC_END0("flutter", "Shell::NotifyLowMemoryWarning",
                                trace_id);
       });
+  task_runners_.GetUITaskRunner()->PostTask([engine = weak_engine_]() {
+    if (engine) {
+      engine->NotifyLowMemoryWarning();
+    }
+  });
   // The IO Manager uses resource cache limits of 0, so it is not necessary
   // to purge them.
 }
@@ -663,14 +699,26 @@ void Shell::RunEngine(
       task_runners_.GetUITaskRunner(),
       fml::MakeCopyable(
           [run_configuration = std::move(run_configuration),
-           weak_engine = weak_engine_, result]() mutable {
+           weak_engine = weak_engine_, result,
+           startup_timeline = startup_timeline_,
+           font_manager_ready = default_font_manager_ready_]() mutable {
             if (!weak_engine) {
               FML_LOG(ERROR)
                   << "Could not launch engine with configuration - no engine.";
               result(Engine::RunStatus::Failure);
               return;
             }
-            auto run_result = weak_engine->Run(std::move(run_configuration));
+            if (font_manager_ready.valid()) {
+              // The root isolate may lay out text as soon as it runs.
+              TRACE_EVENT0("flutter", "Shell::WaitForDefaultFontManager");
+              font_manager_ready.wait();
+            }
+            Engine::RunStatus run_result;
+            {
+              StartupTimeline::ScopedPhase startup_phase(
+                  *startup_timeline, StartupPhase::kRootIsolateLaunch);
+              run_result = weak_engine->Run(std::move(run_configuration));
+            }
             if (run_result == flutter::Engine::RunStatus::Failure) {
               FML_LOG(ERROR) << "Could not launch engine with configuration.";
             }
@@ -739,6 +787,9 @@ bool Shell::Setup(std::unique_ptr<PlatformView> platform_view,
   rasterizer_ = std::move(rasterizer);
   io_manager_ = io_manager;
 
+  rasterizer_->SetFramePhaseProfiler(frame_phase_profiler_);
+  engine_->SetFramePhaseProfiler(frame_phase_profiler_);
+
   // Set the external view embedder for the rasterizer.
   auto view_embedder = platform_view_->CreateExternalViewEmbedder();
   rasterizer_->SetExternalViewEmbedder(view_embedder);
@@ -758,12 +809,36 @@ bool Shell::Setup(std::unique_ptr<PlatformView> platform_view,
 
   // Setup the time-consuming default font manager right after engine created.
   if (!settings_.prefetched_default_font_manager) {
-    fml::TaskRunner::RunNowOrPostTask(task_runners_.GetUITaskRunner(),
-                                      [engine = weak_engine_] {
-                                        if (engine) {
-                                          engine->SetupDefaultFontManager();
-                                        }
-                                      });
+    if (settings_.enable_parallel_startup) {
+      // Set it up on a worker instead of the UI thread so that it overlaps
+      // with the rest of startup. |RunEngine| waits for it before launching
+      // the root isolate.
+      auto font_manager_ready = std::make_shared<std::promise<void>>();
+      default_font_manager_ready_ = font_manager_ready->get_future().share();
+      vm_->GetConcurrentWorkerTaskRunner()->PostTask(
+          [font_collection = engine_->GetFontCollection().GetFontCollection(),
+           font_initialization_data = settings_.font_initialization_data,
+           startup_timeline = startup_timeline_, font_manager_ready]() {
+            TRACE_EVENT0("flutter", "Shell::SetupDefaultFontManager");
+            {
+              StartupTimeline::ScopedPhase startup_phase(
+                  *startup_timeline, StartupPhase::kFontManagerSetup);
+              font_collection->SetupDefaultFontManager(
+                  font_initialization_data);
+            }
+            font_manager_ready->set_value();
+          });
+    } else {
+      fml::TaskRunner::RunNowOrPostTask(
+          task_runners_.GetUITaskRunner(),
+          [engine = weak_engine_, startup_timeline = startup_timeline_] {
+            if (engine) {
+              StartupTimeline::ScopedPhase startup_phase(
+                  *startup_timeline, StartupPhase::kFontManagerSetup);
+              engine->SetupDefaultFontManager();
+            }
+          });
+    }
   }
 
   is_set_up_ = true;
@@ -2261,6 +2336,15 @@ Shell::GetConcurrentWorkerTaskRunner() const {
   return vm_->GetConcurrentWorkerTaskRunner();
 }
 
+const std::shared_ptr<StartupTimeline>& Shell::GetStartupTimeline() const {
+  return startup_timeline_;
+}
+
+const std::shared_ptr<FramePhaseProfiler>& Shell::GetFramePhaseProfiler()
+    const {
+  return frame_phase_profiler_;
+}
+
 SkISize Shell::ExpectedFrameSize(int64_t view_id) {
   auto found = expected_frame_sizes_.find(view_id);
   if (found == expected_frame_sizes_.end()) {
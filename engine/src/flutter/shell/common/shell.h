@@ -6,6 +6,7 @@
 #define FLUTTER_SHELL_COMMON_SHELL_H_
 
 #include <functional>
+#include <future>
 #include <mutex>
 #include <string_view>
 #include <unordered_map>
@@ -14,6 +15,7 @@
 #include "flutter/common/graphics/texture.h"
 #include "flutter/common/settings.h"
 #include "flutter/common/task_runners.h"
+#include "flutter/flow/frame_phase_profiler.h"
 #include "flutter/flow/surface.h"
 #include "flutter/fml/closure.h"
 #include "flutter/fml/macros.h"
@@ -39,6 +41,7 @@
 #include "flutter/shell/common/rasterizer.h"
 #include "flutter/shell/common/resource_cache_limit_calculator.h"
 #include "flutter/shell/common/shell_io_manager.h"
+#include "flutter/shell/common/startup_timeline.h"
 #include "impeller/renderer/context.h"
 #include "impeller/runtime_stage/runtime_stage.h"
 
@@ -410,6 +413,19 @@ class Shell final : public PlatformView::Delegate,
   const std::shared_ptr<fml::ConcurrentTaskRunner>
   GetConcurrentWorkerTaskRunner() const;
 
+  //----------------------------------------------------------------------------
+  /// @brief      The times at which the steps of starting this shell ran. Can
+  ///             be read from any thread.
+  ///
+  const std::shared_ptr<StartupTimeline>& GetStartupTimeline() const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      The profiler that records the durations of the phases of the
+  ///             frames rasterized by this shell and of its image uploads. Can
+  ///             be read from any thread.
+  ///
+  const std::shared_ptr<FramePhaseProfiler>& GetFramePhaseProfiler() const;
+
   // Infer the VM ref and the isolate snapshot based on the settings.
   //
   // If the VM is already running, the settings are ignored, but the returned
@@ -451,6 +467,11 @@ class Shell final : public PlatformView::Delegate,
   std::shared_ptr<fml::SyncSwitch> is_gpu_disabled_sync_switch_;
   std::shared_ptr<PlatformMessageHandler> platform_message_handler_;
   std::atomic<bool> route_messages_through_platform_thread_ = false;
+  std::shared_ptr<StartupTimeline> startup_timeline_;
+  std::shared_ptr<FramePhaseProfiler> frame_phase_profiler_;
+  // Becomes ready once the default font manager has been set up on a worker
+  // thread. Only valid with |Settings::enable_parallel_startup|.
+  std::shared_future<void> default_font_manager_ready_;
 
   fml::WeakPtr<Engine> weak_engine_;  // to be shared across threads
   fml::TaskRunnerAffineWeakPtr<Rasterizer>
@@ -0,0 +1,35 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/startup_timeline.h"
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+StartupTimeline::StartupTimeline() = default;
+
+StartupTimeline::~StartupTimeline() = default;
+
+void StartupTimeline::Record(StartupPhase phase,
+                             fml::TimePoint start,
+                             fml::TimePoint end) {
+  FML_DCHECK(phase < StartupPhase::kCount);
+  std::scoped_lock lock(mutex_);
+  std::optional<Interval>& interval = phases_[static_cast<size_t>(phase)];
+  if (!interval.has_value()) {
+    interval = Interval{start, end};
+  }
+}
+
+std::optional<StartupTimeline::Interval> StartupTimeline::GetPhase(
+    StartupPhase phase) const {
+  if (phase >= StartupPhase::kCount) {
+    return std::nullopt;
+  }
+  std::scoped_lock lock(mutex_);
+  return phases_[static_cast<size_t>(phase)];
+}
+
+}  // namespace flutter
@@ -0,0 +1,93 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_COMMON_STARTUP_TIMELINE_H_
+#define FLUTTER_SHELL_COMMON_STARTUP_TIMELINE_H_
+
+#include <array>
+#include <mutex>
+#include <optional>
+
+#include "flutter/fml/macros.h"
+#include "flutter/fml/time/time_point.h"
+
+namespace flutter {
+
+// The steps of starting an engine whose start and end times are recorded in
+// the |StartupTimeline|. Steps may overlap, as some of them run on different
+// threads.
+enum class StartupPhase : uint32_t {
+  // Creating or attaching to the Dart VM.
+  kVMInitialization,
+  // Creating the asset manager and the run configuration of the root isolate.
+  kAssetManagerSetup,
+  // Creating the platform view on the platform thread.
+  kPlatformViewSetup,
+  // Creating the rasterizer on the raster thread.
+  kRasterizerSetup,
+  // Creating the IO manager and its resource context on the IO thread.
+  kIOManagerSetup,
+  // Creating the engine and the animator on the UI thread.
+  kEngineSetup,
+  // Setting up the default font manager.
+  kFontManagerSetup,
+  // Launching the root isolate and running its entrypoint.
+  kRootIsolateLaunch,
+  kCount,
+};
+
+//------------------------------------------------------------------------------
+/// @brief      Records when each |StartupPhase| of an engine started and
+///             ended.
+///
+///             Phases are recorded from the threads they run on and can be
+///             read from any thread. A phase that runs more than once, like
+///             the font manager setup after a system font change, keeps the
+///             times of its first run.
+///
+class StartupTimeline {
+ public:
+  struct Interval {
+    fml::TimePoint start;
+    fml::TimePoint end;
+  };
+
+  /// Records the time from its construction to its destruction as |phase|.
+  class ScopedPhase {
+   public:
+    ScopedPhase(StartupTimeline& timeline, StartupPhase phase)
+        : timeline_(timeline), phase_(phase), start_(fml::TimePoint::Now()) {}
+
+    ~ScopedPhase() { timeline_.Record(phase_, start_, fml::TimePoint::Now()); }
+
+   private:
+    StartupTimeline& timeline_;
+    const StartupPhase phase_;
+    const fml::TimePoint start_;
+
+    FML_DISALLOW_COPY_AND_ASSIGN(ScopedPhase);
+  };
+
+  StartupTimeline();
+
+  ~StartupTimeline();
+
+  /// Records that |phase| ran from |start| to |end|, unless it was recorded
+  /// before.
+  void Record(StartupPhase phase, fml::TimePoint start, fml::TimePoint end);
+
+  /// Returns when |phase| ran, or |std::nullopt| if it hasn't finished yet.
+  std::optional<Interval> GetPhase(StartupPhase phase) const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::array<std::optional<Interval>, static_cast<size_t>(StartupPhase::kCount)>
+      phases_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(StartupTimeline);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_COMMON_STARTUP_TIMELINE_H_
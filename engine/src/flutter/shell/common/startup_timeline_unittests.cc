@@ -0,0 +1,69 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/common/startup_timeline.h"
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+fml::TimePoint Millis(int64_t millis) {
+  return fml::TimePoint::FromEpochDelta(
+      fml::TimeDelta::FromMilliseconds(millis));
+}
+
+}  // namespace
+
+TEST(StartupTimelineTest, PhasesAreUnrecordedInitially) {
+  StartupTimeline timeline;
+  for (uint32_t i = 0; i < static_cast<uint32_t>(StartupPhase::kCount); i++) {
+    EXPECT_FALSE(timeline.GetPhase(static_cast<StartupPhase>(i)).has_value());
+  }
+  EXPECT_FALSE(timeline.GetPhase(StartupPhase::kCount).has_value());
+}
+
+TEST(StartupTimelineTest, KeepsFirstRecordOfPhase) {
+  StartupTimeline timeline;
+  timeline.Record(StartupPhase::kFontManagerSetup, Millis(10), Millis(30));
+  timeline.Record(StartupPhase::kFontManagerSetup, Millis(50), Millis(60));
+
+  std::optional<StartupTimeline::Interval> interval =
+      timeline.GetPhase(StartupPhase::kFontManagerSetup);
+  ASSERT_TRUE(interval.has_value());
+  EXPECT_EQ(interval->start, Millis(10));
+  EXPECT_EQ(interval->end, Millis(30));
+  EXPECT_FALSE(timeline.GetPhase(StartupPhase::kEngineSetup).has_value());
+}
+
+TEST(StartupTimelineTest, ScopedPhasesRecordFromAnyThread) {
+  StartupTimeline timeline;
+  fml::TimePoint before = fml::TimePoint::Now();
+  std::thread thread([&timeline]() {
+    StartupTimeline::ScopedPhase phase(timeline,
+                                       StartupPhase::kRasterizerSetup);
+  });
+  {
+    StartupTimeline::ScopedPhase phase(timeline, StartupPhase::kEngineSetup);
+  }
+  thread.join();
+  fml::TimePoint after = fml::TimePoint::Now();
+
+  for (StartupPhase phase :
+       {StartupPhase::kRasterizerSetup, StartupPhase::kEngineSetup}) {
+    std::optional<StartupTimeline::Interval> interval =
+        timeline.GetPhase(phase);
+    ASSERT_TRUE(interval.has_value());
+    EXPECT_LE(before, interval->start);
+    EXPECT_LE(interval->start, interval->end);
+    EXPECT_LE(interval->end, after);
+  }
+}
+
+}  // namespace testing
+}  // namespace flutter
@@ -218,6 +218,10 @@ DEF_SWITCH(PrefetchedDefaultFontManager,
            "prefetched-default-font-manager",
            "Indicates whether the embedding started a prefetch of the "
            "default font manager before creating the engine.")
+DEF_SWITCH(EnableParallelStartup,
+           "enable-parallel-startup",
+           "Overlap the setup of the default font manager and of the asset "
+           "manager with the creation of the engine's subsystems.")
 DEF_SWITCH(VerboseLogging,
            "verbose-logging",
            "By default, only errors are logged. This flag enabled logging at "
@@ -262,6 +266,10 @@ DEF_SWITCH(OldGenHeapSize,
 DEF_SWITCH(ResourceCacheMaxBytesThreshold,
            "resource-cache-max-bytes-threshold",
            "The max bytes threshold of resource cache, or 0 for unlimited.")
+DEF_SWITCH(DecodedImageCacheMaxBytes,
+           "decoded-image-cache-max-bytes",
+           "The max bytes of decoded images the engine retains for reuse by "
+           "codecs instantiated from the same data, or 0 to disable.")
 DEF_SWITCH(EnableImpeller,
            "enable-impeller",
            "Enable the Impeller renderer on supported platforms. Ignored if "
@@ -283,6 +291,20 @@ DEF_SWITCH(EnableVulkanGPUTracing,
            "enable-vulkan-gpu-tracing",
            "Enable tracing of GPU execution time when using the Impeller "
            "Vulkan backend.")
+DEF_SWITCH(EnableImpellerYUVImageDecoding,
+           "enable-impeller-yuv-image-decoding",
+           "Decode JPEGs to YUV planes and convert them to RGB on the GPU when "
+           "using the Impeller Metal or Vulkan backends.")
+DEF_SWITCH(EnableImpellerLazyMipmaps,
+           "enable-impeller-lazy-mipmaps",
+           "Generate mipmaps for images the first time Impeller draws them "
+           "minified by more than 2x.")
+DEF_SWITCH(CoalescePointerEvents,
+           "coalesce-pointer-events",
+           "Merge pointer move and hover events that arrive faster than "
+           "frames are produced into the latest event of each pointer. Apps "
+           "that need every input sample, such as drawing apps, should leave "
+           "this disabled.")
 DEF_SWITCH(LeakVM,
            "leak-vm",
            "When the last shell shuts down, the shared VM is leaked by default "
@@ -6,9 +6,9 @@
 
 #include "flow/surface_frame.h"
 #include "flutter/fml/make_copyable.h"
+#include "flutter/shell/common/shared_aiks_context.h"
 #include "impeller/display_list/dl_dispatcher.h"
 #include "impeller/renderer/backend/gles/surface_gles.h"
-#include "impeller/typographer/backends/skia/typographer_context_skia.h"
 
 namespace flutter {
 
@@ -25,8 +25,7 @@ GPUSurfaceGLImpeller::GPUSurfaceGLImpeller(
     return;
   }
 
-  auto aiks_context = std::make_shared<impeller::AiksContext>(
-      context, impeller::TypographerContextSkia::Make());
+  auto aiks_context = GetSharedAiksContext(context);
 
   if (!aiks_context->IsValid()) {
     return;
@@ -36,6 +35,8 @@ GPUSurfaceGLImpeller::GPUSurfaceGLImpeller(
   impeller_context_ = std::move(context);
   render_to_surface_ = render_to_surface;
   aiks_context_ = std::move(aiks_context);
+  transients_buffer_ = impeller::HostBuffer::Create(
+      impeller_context_->GetResourceAllocator());
   is_valid_ = true;
 }
 
@@ -102,7 +103,8 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceGLImpeller::AcquireFrame(
       surface->GetTargetRenderPassDescriptor();
 
   SurfaceFrame::EncodeCallback encode_calback =
-      [aiks_context = aiks_context_,  //
+      [aiks_context = aiks_context_,            //
+       transients_buffer = transients_buffer_,  //
        render_target](SurfaceFrame& surface_frame,
                       DlCanvas* canvas) mutable -> bool {
     if (!aiks_context) {
@@ -117,11 +119,14 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceGLImpeller::AcquireFrame(
 
     auto cull_rect = render_target.GetRenderTargetSize();
     SkIRect sk_cull_rect = SkIRect::MakeWH(cull_rect.width, cull_rect.height);
-    return impeller::RenderToOnscreen(aiks_context->GetContentContext(),  //
-                                      render_target,                      //
-                                      display_list,                       //
-                                      sk_cull_rect,                       //
-                                      /*reset_host_buffer=*/true          //
+    auto& content_context = aiks_context->GetContentContext();
+    ScopedTransientsBuffer scoped_transients_buffer(content_context,
+                                                    transients_buffer);
+    return impeller::RenderToOnscreen(content_context,            //
+                                      render_target,              //
+                                      display_list,               //
+                                      sk_cull_rect,               //
+                                      /*reset_host_buffer=*/true  //
     );
     return true;
   };
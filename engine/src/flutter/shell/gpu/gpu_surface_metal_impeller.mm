@@ -13,9 +13,9 @@
 #include "flutter/fml/make_copyable.h"
 #include "flutter/fml/mapping.h"
 #include "flutter/fml/trace_event.h"
+#include "flutter/shell/common/shared_aiks_context.h"
 #include "impeller/display_list/dl_dispatcher.h"
 #include "impeller/renderer/backend/metal/surface_mtl.h"
-#include "impeller/typographer/backends/skia/typographer_context_skia.h"
 
 static_assert(!__has_feature(objc_arc), "ARC must be disabled.");
 
@@ -26,10 +26,11 @@ GPUSurfaceMetalImpeller::GPUSurfaceMetalImpeller(GPUSurfaceMetalDelegate* delega
                                                  bool render_to_surface)
     : delegate_(delegate),
       render_target_type_(delegate->GetRenderTargetType()),
-      aiks_context_(
-          std::make_shared<impeller::AiksContext>(context,
-                                                  impeller::TypographerContextSkia::Make())),
+      aiks_context_(GetSharedAiksContext(context)),
       render_to_surface_(render_to_surface) {
+  if (context) {
+    transients_buffer_ = impeller::HostBuffer::Create(context->GetResourceAllocator());
+  }
   // If this preference is explicitly set, we allow for disabling partial repaint.
   NSNumber* disablePartialRepaint =
       [[NSBundle mainBundle] objectForInfoDictionaryKey:@"FLTDisablePartialRepaint"];
@@ -108,6 +109,7 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromCAMetalLa
       fml::MakeCopyable([damage = damage_,
                          disable_partial_repaint = disable_partial_repaint_,  //
                          aiks_context = aiks_context_,                        //
+                         transients_buffer = transients_buffer_,              //
                          drawable,                                            //
                          last_texture,                                        //
                          mtl_layer                                            //
@@ -167,8 +169,10 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromCAMetalLa
         impeller::IRect cull_rect = surface->coverage();
         SkIRect sk_cull_rect = SkIRect::MakeWH(cull_rect.GetWidth(), cull_rect.GetHeight());
         surface->SetFrameBoundary(surface_frame.submit_info().frame_boundary);
+        auto& content_context = aiks_context->GetContentContext();
+        ScopedTransientsBuffer scoped_transients_buffer(content_context, transients_buffer);
         auto render_result =
-            impeller::RenderToOnscreen(aiks_context->GetContentContext(),         //
+            impeller::RenderToOnscreen(content_context,                           //
                                        surface->GetTargetRenderPassDescriptor(),  //
                                        display_list,                              //
                                        sk_cull_rect,                              //
@@ -231,8 +235,9 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromMTLTextur
   SurfaceFrame::EncodeCallback encode_callback =
       fml::MakeCopyable([disable_partial_repaint = disable_partial_repaint_,  //
                          damage = damage_,
-                         aiks_context = aiks_context_,  //
-                         mtl_texture                    //
+                         aiks_context = aiks_context_,            //
+                         transients_buffer = transients_buffer_,  //
+                         mtl_texture                              //
   ](SurfaceFrame& surface_frame, DlCanvas* canvas) mutable -> bool {
         if (!aiks_context) {
           return false;
@@ -280,8 +285,10 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceMetalImpeller::AcquireFrameFromMTLTextur
 
         impeller::IRect cull_rect = surface->coverage();
         SkIRect sk_cull_rect = SkIRect::MakeWH(cull_rect.GetWidth(), cull_rect.GetHeight());
+        auto& content_context = aiks_context->GetContentContext();
+        ScopedTransientsBuffer scoped_transients_buffer(content_context, transients_buffer);
         auto render_result =
-            impeller::RenderToOnscreen(aiks_context->GetContentContext(),         //
+            impeller::RenderToOnscreen(content_context,                           //
                                        surface->GetTargetRenderPassDescriptor(),  //
                                        display_list,                              //
                                        sk_cull_rect,                              //
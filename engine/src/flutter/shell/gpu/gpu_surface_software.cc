@@ -14,10 +14,15 @@
 namespace flutter {
 
 GPUSurfaceSoftware::GPUSurfaceSoftware(GPUSurfaceSoftwareDelegate* delegate,
-                                       bool render_to_surface)
+                                       bool render_to_surface,
+                                       size_t tile_worker_count)
     : delegate_(delegate),
       render_to_surface_(render_to_surface),
-      weak_factory_(this) {}
+      weak_factory_(this) {
+  if (render_to_surface_ && tile_worker_count > 1) {
+    tiles_ = std::make_unique<GPUSurfaceSoftwareTiles>(tile_worker_count);
+  }
+}
 
 GPUSurfaceSoftware::~GPUSurfaceSoftware() = default;
 
@@ -59,6 +64,21 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceSoftware::AcquireFrame(
     return nullptr;
   }
 
+  if (delegate_->SupportsPartialRepaint()) {
+    framebuffer_info.supports_partial_repaint = true;
+    // The pixels of a backing store that was presented last are still those
+    // of the previous frame, so only the areas that changed since then need to
+    // be rendered again. Other backing stores are rendered in full.
+    if (backing_store == presented_backing_store_) {
+      framebuffer_info.existing_damage = SkIRect::MakeEmpty();
+    }
+  }
+
+  if (tiles_) {
+    return AcquireTiledFrame(std::move(backing_store), framebuffer_info,
+                             logical_size);
+  }
+
   // If the surface has been scaled, we need to apply the inverse scaling to the
   // underlying canvas so that coordinates are mapped to the same spot
   // irrespective of surface scaling.
@@ -82,8 +102,7 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceSoftware::AcquireFrame(
         if (!self || !self->IsValid()) {
           return false;
         }
-        return self->delegate_->PresentBackingStore(
-            surface_frame.SkiaSurface());
+        return self->Present(surface_frame.SkiaSurface(), surface_frame);
       };
 
   return std::make_unique<SurfaceFrame>(backing_store, framebuffer_info,
@@ -91,6 +110,76 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceSoftware::AcquireFrame(
                                         logical_size);
 }
 
+std::unique_ptr<SurfaceFrame> GPUSurfaceSoftware::AcquireTiledFrame(
+    sk_sp<SkSurface> backing_store,
+    const SurfaceFrame::FramebufferInfo& framebuffer_info,
+    const SkISize& logical_size) {
+  SurfaceFrame::EncodeCallback encode_callback =
+      [self = weak_factory_.GetWeakPtr(), backing_store](
+          SurfaceFrame& surface_frame, DlCanvas* canvas) -> bool {
+    // If the surface itself went away, there is nothing more to do.
+    if (!self || !self->IsValid()) {
+      return false;
+    }
+
+    auto display_list = surface_frame.BuildDisplayList();
+    if (!display_list) {
+      FML_LOG(ERROR) << "Could not build display list for surface frame.";
+      return false;
+    }
+
+    // The tiles write to the pixels directly, so the surface must first copy
+    // the pixels away from any snapshot that still shares them.
+    backing_store->notifyContentWillChange(
+        SkSurface::kRetain_ContentChangeMode);
+    SkPixmap pixmap;
+    if (!backing_store->peekPixels(&pixmap)) {
+      FML_LOG(ERROR) << "Could not peek the pixels of the backing store.";
+      return false;
+    }
+    return self->tiles_->Rasterize(
+        *display_list, pixmap,
+        surface_frame.submit_info().buffer_damage.value_or(pixmap.bounds()));
+  };
+  SurfaceFrame::SubmitCallback submit_callback =
+      [self = weak_factory_.GetWeakPtr(),
+       backing_store](const SurfaceFrame& surface_frame) {
+        // If the surface itself went away, there is nothing more to do.
+        if (!self || !self->IsValid()) {
+          return false;
+        }
+        return self->Present(backing_store, surface_frame);
+      };
+
+  return std::make_unique<SurfaceFrame>(nullptr,           // surface
+                                        framebuffer_info,  // framebuffer info
+                                        encode_callback,   // encode callback
+                                        submit_callback,   // submit callback
+                                        logical_size,      // frame size
+                                        nullptr,           // context result
+                                        true,  // display list fallback
+                                        true   // prepare rtree
+  );
+}
+
+bool GPUSurfaceSoftware::Present(sk_sp<SkSurface> backing_store,
+                                 const SurfaceFrame& surface_frame) {
+  if (!delegate_->SupportsPartialRepaint()) {
+    return delegate_->PresentBackingStore(std::move(backing_store));
+  }
+
+  // Until the present succeeds, the platform may show a different frame than
+  // the one in the backing store.
+  presented_backing_store_ = nullptr;
+  const SkIRect damage = surface_frame.submit_info().frame_damage.value_or(
+      SkIRect::MakeWH(backing_store->width(), backing_store->height()));
+  if (!delegate_->PresentBackingStoreWithDamage(backing_store, damage)) {
+    return false;
+  }
+  presented_backing_store_ = std::move(backing_store);
+  return true;
+}
+
 // |Surface|
 SkMatrix GPUSurfaceSoftware::GetRootTransformation() const {
   // This backend does not currently support root surface transformations. Just
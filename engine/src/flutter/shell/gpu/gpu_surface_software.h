@@ -9,13 +9,27 @@
 #include "flutter/fml/macros.h"
 #include "flutter/fml/memory/weak_ptr.h"
 #include "flutter/shell/gpu/gpu_surface_software_delegate.h"
+#include "flutter/shell/gpu/gpu_surface_software_tiles.h"
 
 namespace flutter {
 
 class GPUSurfaceSoftware : public Surface {
  public:
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a software surface.
+  ///
+  /// @param[in]  delegate           The delegate that provides the backing
+  ///                                stores.
+  /// @param[in]  render_to_surface  Whether frames are drawn into the backing
+  ///                                store.
+  /// @param[in]  tile_worker_count  The number of threads that draw tiles of
+  ///                                the frame in parallel. Frames are drawn
+  ///                                directly into the backing store on the
+  ///                                raster thread if this is 0 or 1.
+  ///
   GPUSurfaceSoftware(GPUSurfaceSoftwareDelegate* delegate,
-                     bool render_to_surface);
+                     bool render_to_surface,
+                     size_t tile_worker_count = 0);
 
   ~GPUSurfaceSoftware() override;
 
@@ -38,7 +52,24 @@ class GPUSurfaceSoftware : public Surface {
   // hack to make avoid allocating resources for the root surface when an
   // external view embedder is present.
   const bool render_to_surface_;
+  std::unique_ptr<GPUSurfaceSoftwareTiles> tiles_;
+  // The backing store of the last frame that was presented, if the delegate
+  // supports partial repaint.
+  sk_sp<SkSurface> presented_backing_store_;
   fml::TaskRunnerAffineWeakPtrFactory<GPUSurfaceSoftware> weak_factory_;
+
+  // Acquires a frame that records a display list and draws it in tiles into
+  // |backing_store| when it is encoded.
+  std::unique_ptr<SurfaceFrame> AcquireTiledFrame(
+      sk_sp<SkSurface> backing_store,
+      const SurfaceFrame::FramebufferInfo& framebuffer_info,
+      const SkISize& logical_size);
+
+  // Presents |backing_store| with the damage of |surface_frame| if the
+  // delegate supports partial repaint.
+  bool Present(sk_sp<SkSurface> backing_store,
+               const SurfaceFrame& surface_frame);
+
   FML_DISALLOW_COPY_AND_ASSIGN(GPUSurfaceSoftware);
 };
 
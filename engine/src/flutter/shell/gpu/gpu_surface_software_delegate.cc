@@ -4,8 +4,20 @@
 
 #include "flutter/shell/gpu/gpu_surface_software_delegate.h"
 
+#include <utility>
+
 namespace flutter {
 
 GPUSurfaceSoftwareDelegate::~GPUSurfaceSoftwareDelegate() = default;
 
+bool GPUSurfaceSoftwareDelegate::PresentBackingStoreWithDamage(
+    sk_sp<SkSurface> backing_store,
+    const SkIRect& damage) {
+  return PresentBackingStore(std::move(backing_store));
+}
+
+bool GPUSurfaceSoftwareDelegate::SupportsPartialRepaint() const {
+  return false;
+}
+
 }  // namespace flutter
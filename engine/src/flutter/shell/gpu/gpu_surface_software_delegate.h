@@ -48,6 +48,33 @@ class GPUSurfaceSoftwareDelegate {
   ///             the screen.
   ///
   virtual bool PresentBackingStore(sk_sp<SkSurface> backing_store) = 0;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Called by the platform when only part of a frame has been
+  ///             rendered into the backing store. The pixels outside of
+  ///             |damage| are the same as in the previously presented frame.
+  ///
+  ///             This is only called if |SupportsPartialRepaint| returns true.
+  ///             The default implementation presents the whole backing store.
+  ///
+  /// @param[in]  backing_store  The software backing store to present.
+  /// @param[in]  damage         The area of the backing store that changed
+  ///                            since the previous present.
+  ///
+  /// @return     Returns if the platform could present the backing store onto
+  ///             the screen.
+  ///
+  virtual bool PresentBackingStoreWithDamage(sk_sp<SkSurface> backing_store,
+                                             const SkIRect& damage);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Whether the backing stores returned by |AcquireBackingStore|
+  ///             keep their pixels between frames, so that only the areas of
+  ///             a frame that changed need to be rendered again.
+  ///
+  /// @return     Returns false by default, which renders whole frames.
+  ///
+  virtual bool SupportsPartialRepaint() const;
 };
 
 }  // namespace flutter
@@ -0,0 +1,171 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/gpu/gpu_surface_software_tiles.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "flutter/display_list/skia/dl_sk_dispatcher.h"
+#include "flutter/display_list/utils/dl_receiver_utils.h"
+#include "flutter/fml/logging.h"
+#include "flutter/fml/synchronization/count_down_latch.h"
+#include "flutter/fml/trace_event.h"
+
+#include "third_party/skia/include/core/SkCanvas.h"
+
+namespace flutter {
+
+namespace {
+
+// Finds save layers with backdrop filters anywhere in a display list,
+// including in the layers and display lists nested in it.
+class BackdropFilterFinder : public virtual DlOpReceiver,
+                             virtual IgnoreAttributeDispatchHelper,
+                             virtual IgnoreClipDispatchHelper,
+                             virtual IgnoreTransformDispatchHelper,
+                             virtual IgnoreDrawDispatchHelper {
+ public:
+  void saveLayer(const DlRect& bounds,
+                 const SaveLayerOptions options,
+                 const DlImageFilter* backdrop) override {
+    found_ = found_ || backdrop != nullptr;
+  }
+
+  void drawDisplayList(const sk_sp<DisplayList> display_list,
+                       DlScalar opacity) override {
+    if (!found_) {
+      display_list->Dispatch(*this);
+    }
+  }
+
+  bool found() const { return found_; }
+
+ private:
+  bool found_ = false;
+};
+
+// Backdrop filters read the pixels drawn around them, which belong to other
+// tiles, so they can't be drawn one tile at a time.
+bool HasBackdropFilter(const DisplayList& display_list) {
+  if (display_list.root_has_backdrop_filter()) {
+    return true;
+  }
+  BackdropFilterFinder finder;
+  display_list.Dispatch(finder);
+  return finder.found();
+}
+
+void RasterizeTile(const DisplayList& display_list,
+                   const SkPixmap& pixmap,
+                   const SkIRect& tile,
+                   const SkIRect& dirty_rect) {
+  TRACE_EVENT0("flutter", "GPUSurfaceSoftwareTiles::RasterizeTile");
+  // The canvas only covers the pixels of the tile, so it clips the drawing
+  // to the tile without any explicit clip.
+  std::unique_ptr<SkCanvas> canvas = SkCanvas::MakeRasterDirect(
+      pixmap.info().makeWH(tile.width(), tile.height()),
+      pixmap.writable_addr(tile.x(), tile.y()), pixmap.rowBytes());
+  if (!canvas) {
+    FML_LOG(ERROR) << "Could not create a canvas for a software tile.";
+    return;
+  }
+  canvas->translate(-tile.x(), -tile.y());
+  SkIRect cull_rect = tile;
+  if (!dirty_rect.contains(tile)) {
+    // Operations that are culled may still cover the rest of the tile, so
+    // the other operations must not draw there either.
+    cull_rect.intersect(dirty_rect);
+    canvas->clipIRect(cull_rect);
+  }
+  DlSkCanvasDispatcher dispatcher(canvas.get());
+  display_list.Dispatch(dispatcher, cull_rect);
+}
+
+}  // namespace
+
+GPUSurfaceSoftwareTiles::GPUSurfaceSoftwareTiles(size_t worker_count,
+                                                 int tile_size)
+    : worker_count_(std::clamp<size_t>(
+          worker_count,
+          1,
+          std::max<size_t>(std::thread::hardware_concurrency(), 1))),
+      tile_size_(tile_size) {
+  FML_DCHECK(tile_size_ > 0);
+  if (worker_count_ > 1) {
+    loop_ = fml::ConcurrentMessageLoop::Create(worker_count_ - 1);
+  }
+}
+
+GPUSurfaceSoftwareTiles::~GPUSurfaceSoftwareTiles() = default;
+
+std::vector<SkIRect> GPUSurfaceSoftwareTiles::ComputeTiles(
+    const SkISize& size) const {
+  std::vector<SkIRect> tiles;
+  for (int y = 0; y < size.height(); y += tile_size_) {
+    for (int x = 0; x < size.width(); x += tile_size_) {
+      tiles.push_back(SkIRect::MakeLTRB(
+          x, y, std::min(x + tile_size_, size.width()),
+          std::min(y + tile_size_, size.height())));
+    }
+  }
+  return tiles;
+}
+
+bool GPUSurfaceSoftwareTiles::Rasterize(const DisplayList& display_list,
+                                        const SkPixmap& pixmap) {
+  return Rasterize(display_list, pixmap, pixmap.bounds());
+}
+
+bool GPUSurfaceSoftwareTiles::Rasterize(const DisplayList& display_list,
+                                        const SkPixmap& pixmap,
+                                        const SkIRect& dirty_rect) {
+  TRACE_EVENT0("flutter", "GPUSurfaceSoftwareTiles::Rasterize");
+  if (pixmap.writable_addr() == nullptr) {
+    return false;
+  }
+
+  if (HasBackdropFilter(display_list)) {
+    RasterizeTile(display_list, pixmap, pixmap.bounds(), dirty_rect);
+    return true;
+  }
+
+  std::vector<SkIRect> tiles = ComputeTiles(pixmap.dimensions());
+  tiles.erase(std::remove_if(tiles.begin(), tiles.end(),
+                             [&dirty_rect](const SkIRect& tile) {
+                               return !SkIRect::Intersects(tile, dirty_rect);
+                             }),
+              tiles.end());
+
+  // Workers claim the next tile until there are none left instead of being
+  // handed a fixed share, as the cost of tiles varies a lot within a frame.
+  std::atomic<size_t> next_tile = 0;
+  auto rasterize_tiles = [&display_list, &pixmap, &dirty_rect, &tiles,
+                          &next_tile]() {
+    for (size_t index = next_tile.fetch_add(1); index < tiles.size();
+         index = next_tile.fetch_add(1)) {
+      RasterizeTile(display_list, pixmap, tiles[index], dirty_rect);
+    }
+  };
+
+  const size_t helper_count =
+      loop_ ? std::min(worker_count_ - 1, tiles.size()) : 0;
+  fml::CountDownLatch latch(helper_count);
+  if (helper_count > 0) {
+    auto task_runner = loop_->GetTaskRunner();
+    for (size_t i = 0; i < helper_count; i++) {
+      task_runner->PostTask([&rasterize_tiles, &latch]() {
+        rasterize_tiles();
+        latch.CountDown();
+      });
+    }
+  }
+  rasterize_tiles();
+  latch.Wait();
+
+  return true;
+}
+
+}  // namespace flutter
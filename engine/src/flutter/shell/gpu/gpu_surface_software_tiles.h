@@ -0,0 +1,95 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_GPU_GPU_SURFACE_SOFTWARE_TILES_H_
+#define FLUTTER_SHELL_GPU_GPU_SURFACE_SOFTWARE_TILES_H_
+
+#include <memory>
+#include <vector>
+
+#include "flutter/display_list/display_list.h"
+#include "flutter/fml/concurrent_message_loop.h"
+#include "flutter/fml/macros.h"
+#include "third_party/skia/include/core/SkPixmap.h"
+
+namespace flutter {
+
+//------------------------------------------------------------------------------
+/// @brief      Rasterizes display lists into a software backing store by
+///             splitting the frame into tiles and drawing the tiles in
+///             parallel.
+///
+///             Each tile draws the display list into its own canvas over the
+///             tile's pixels, so the tiles don't need to be composited
+///             afterwards. Only the operations that intersect a tile are
+///             dispatched to it if the display list has an |DlRTree|.
+///
+///             Display lists with backdrop filters are drawn into a single
+///             canvas on the calling thread, as the filters read pixels from
+///             across tile boundaries.
+///
+///             The thread that calls |Rasterize| draws tiles too, so a
+///             rasterizer with a single worker draws all tiles on that thread
+///             and doesn't create any thread.
+///
+class GPUSurfaceSoftwareTiles {
+ public:
+  static constexpr int kDefaultTileSize = 256;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Creates a rasterizer that draws tiles on |worker_count|
+  ///             threads, including the calling thread.
+  ///
+  /// @param[in]  worker_count  The number of threads that draw tiles. It is
+  ///                           clamped between 1 and the number of hardware
+  ///                           threads.
+  /// @param[in]  tile_size     The width and height of the tiles in pixels.
+  ///                           Keep it a multiple of 8 so that dithering
+  ///                           doesn't show the seams between tiles.
+  ///
+  explicit GPUSurfaceSoftwareTiles(size_t worker_count,
+                                   int tile_size = kDefaultTileSize);
+
+  ~GPUSurfaceSoftwareTiles();
+
+  size_t GetWorkerCount() const { return worker_count_; }
+
+  //----------------------------------------------------------------------------
+  /// @brief      Returns the tiles that cover a frame of the given size, in
+  ///             row major order. Tiles on the right and bottom edges are
+  ///             clipped to the frame.
+  ///
+  std::vector<SkIRect> ComputeTiles(const SkISize& size) const;
+
+  //----------------------------------------------------------------------------
+  /// @brief      Draws |display_list| into |pixmap| and waits for all tiles
+  ///             to be drawn.
+  ///
+  /// @return     Returns false if the pixels of |pixmap| can't be written to.
+  ///
+  bool Rasterize(const DisplayList& display_list, const SkPixmap& pixmap);
+
+  //----------------------------------------------------------------------------
+  /// @brief      Draws the part of |display_list| inside |dirty_rect| into
+  ///             |pixmap| and waits for all tiles to be drawn. Tiles outside
+  ///             of |dirty_rect| are skipped and the pixels outside of it are
+  ///             left untouched.
+  ///
+  /// @return     Returns false if the pixels of |pixmap| can't be written to.
+  ///
+  bool Rasterize(const DisplayList& display_list,
+                 const SkPixmap& pixmap,
+                 const SkIRect& dirty_rect);
+
+ private:
+  const size_t worker_count_;
+  const int tile_size_;
+  std::shared_ptr<fml::ConcurrentMessageLoop> loop_;
+
+  FML_DISALLOW_COPY_AND_ASSIGN(GPUSurfaceSoftwareTiles);
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_GPU_GPU_SURFACE_SOFTWARE_TILES_H_
@@ -0,0 +1,90 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/benchmarking.h"
+
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/shell/gpu/gpu_surface_software_tiles.h"
+
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkRRect.h"
+
+namespace flutter {
+
+namespace {
+
+// A frame of list items: a gradient background, and on every row a card with
+// rounded corners, an avatar and a few lines of placeholder text.
+sk_sp<DisplayList> MakeFrame(const SkISize& size) {
+  DisplayListBuilder builder(SkRect::Make(size), /*prepare_rtree=*/true);
+
+  const DlColor colors[] = {DlColor::kWhite(), DlColor::kLightGrey()};
+  const float stops[] = {0.0f, 1.0f};
+  DlPaint background;
+  background.setColorSource(DlColorSource::MakeLinear(
+      SkPoint::Make(0, 0), SkPoint::Make(0, size.height()), 2, colors, stops,
+      DlTileMode::kClamp));
+  builder.DrawPaint(background);
+
+  DlPaint card;
+  card.setAntiAlias(true);
+  card.setColor(DlColor::kWhite());
+  DlPaint avatar;
+  avatar.setAntiAlias(true);
+  avatar.setColor(DlColor::kBlue().withAlpha(0xC0));
+  DlPaint text;
+  text.setColor(DlColor::kDarkGrey());
+
+  const SkScalar row_height = 72;
+  const SkScalar margin = 8;
+  for (SkScalar y = margin; y < size.height(); y += row_height) {
+    for (SkScalar x = margin; x < size.width(); x += 480) {
+      SkRect bounds = SkRect::MakeXYWH(x, y, 480 - 2 * margin, row_height - 8);
+      builder.DrawRRect(SkRRect::MakeRectXY(bounds, 12, 12), card);
+      builder.DrawCircle(
+          SkPoint::Make(bounds.left() + 32, bounds.centerY()), 24, avatar);
+      for (int line = 0; line < 3; line++) {
+        builder.DrawRect(SkRect::MakeXYWH(bounds.left() + 72,
+                                          bounds.top() + 12 + line * 16,
+                                          bounds.width() - 96, 8),
+                         text);
+      }
+    }
+  }
+  return builder.Build();
+}
+
+}  // namespace
+
+static void BM_RasterizeTiles(benchmark::State& state) {
+  const SkISize size = SkISize::Make(state.range(0), state.range(1));
+  const size_t worker_count = state.range(2);
+
+  sk_sp<DisplayList> display_list = MakeFrame(size);
+  GPUSurfaceSoftwareTiles tiles(worker_count);
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(size.width(), size.height());
+
+  for (auto _ : state) {
+    tiles.Rasterize(*display_list, bitmap.pixmap());
+  }
+  state.SetItemsProcessed(state.iterations() * size.width() * size.height());
+}
+
+static void FrameSizesAndWorkerCounts(benchmark::internal::Benchmark* b) {
+  for (int worker_count : {1, 2, 4, 8}) {
+    b->Args({1920, 1080, worker_count});
+  }
+  for (int worker_count : {1, 2, 4, 8}) {
+    b->Args({3840, 2160, worker_count});
+  }
+}
+
+// The arguments are the frame width, the frame height and the worker count.
+BENCHMARK(BM_RasterizeTiles)
+    ->Apply(FrameSizesAndWorkerCounts)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace flutter
@@ -0,0 +1,145 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/gpu/gpu_surface_software_tiles.h"
+
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#include "flutter/display_list/dl_builder.h"
+#include "flutter/display_list/skia/dl_sk_dispatcher.h"
+#include "gtest/gtest.h"
+
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+
+namespace flutter {
+namespace testing {
+
+namespace {
+
+sk_sp<DisplayList> MakeScene(const SkISize& size,
+                             bool with_backdrop_filter = false) {
+  DisplayListBuilder builder(SkRect::Make(size), /*prepare_rtree=*/true);
+  builder.Clear(DlColor::kWhite());
+
+  const DlColor colors[] = {DlColor::kRed(), DlColor::kBlue()};
+  const float stops[] = {0.0f, 1.0f};
+  DlPaint gradient_paint;
+  gradient_paint.setColorSource(DlColorSource::MakeLinear(
+      SkPoint::Make(0, 0), SkPoint::Make(size.width(), size.height()), 2,
+      colors, stops, DlTileMode::kClamp));
+  builder.DrawRect(SkRect::MakeXYWH(10, 10, 200, 150), gradient_paint);
+
+  // Shapes that straddle tile edges, with and without anti-aliasing.
+  DlPaint paint;
+  paint.setAntiAlias(true);
+  paint.setColor(DlColor::kGreen().withAlpha(0x80));
+  for (int i = 0; i < 8; i++) {
+    builder.DrawCircle(SkPoint::Make(60 + i * 37, 90 + i * 13), 33.5f, paint);
+  }
+  paint.setAntiAlias(false);
+  paint.setColor(DlColor::kCyan());
+  builder.DrawRect(SkRect::MakeXYWH(100, 40, 80, 70), paint);
+
+  if (with_backdrop_filter) {
+    // A blurred backdrop across tile edges, nested in another layer so that
+    // it isn't at the root of the display list.
+    auto blur = DlBlurImageFilter::Make(6, 6, DlTileMode::kClamp);
+    DlPaint layer_paint;
+    layer_paint.setOpacity(0.9f);
+    builder.SaveLayer(nullptr, &layer_paint);
+    builder.ClipRect(SkRect::MakeXYWH(40, 30, 150, 100));
+    builder.SaveLayer(nullptr, nullptr, blur.get());
+    builder.Restore();
+    builder.Restore();
+  }
+  return builder.Build();
+}
+
+SkBitmap Rasterize(const DisplayList& display_list, const SkISize& size) {
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(size.width(), size.height());
+  bitmap.eraseColor(SK_ColorTRANSPARENT);
+  SkCanvas canvas(bitmap);
+  DlSkCanvasDispatcher dispatcher(&canvas);
+  display_list.Dispatch(dispatcher);
+  return bitmap;
+}
+
+}  // namespace
+
+TEST(GPUSurfaceSoftwareTilesTest, ComputeTilesCoversFrame) {
+  GPUSurfaceSoftwareTiles tiles(1, 256);
+  std::vector<SkIRect> rects = tiles.ComputeTiles(SkISize::Make(600, 300));
+  ASSERT_EQ(rects.size(), 6u);
+  EXPECT_EQ(rects[0], SkIRect::MakeLTRB(0, 0, 256, 256));
+  EXPECT_EQ(rects[2], SkIRect::MakeLTRB(512, 0, 600, 256));
+  EXPECT_EQ(rects[5], SkIRect::MakeLTRB(512, 256, 600, 300));
+}
+
+TEST(GPUSurfaceSoftwareTilesTest, WorkerCountIsAtLeastOne) {
+  GPUSurfaceSoftwareTiles tiles(0);
+  EXPECT_EQ(tiles.GetWorkerCount(), 1u);
+}
+
+TEST(GPUSurfaceSoftwareTilesTest, WorkerCountIsAtMostHardwareThreadCount) {
+  GPUSurfaceSoftwareTiles tiles(std::numeric_limits<size_t>::max());
+  EXPECT_EQ(tiles.GetWorkerCount(),
+            std::max<size_t>(std::thread::hardware_concurrency(), 1));
+}
+
+TEST(GPUSurfaceSoftwareTilesTest, MatchesSingleCanvasRasterization) {
+  const SkISize size = SkISize::Make(333, 222);
+  for (bool with_backdrop_filter : {false, true}) {
+    sk_sp<DisplayList> display_list = MakeScene(size, with_backdrop_filter);
+    ASSERT_TRUE(display_list->has_rtree());
+    SkBitmap expected = Rasterize(*display_list, size);
+
+    for (size_t worker_count : {1u, 3u}) {
+      GPUSurfaceSoftwareTiles tiles(worker_count, 64);
+      SkBitmap bitmap;
+      bitmap.allocN32Pixels(size.width(), size.height());
+      bitmap.eraseColor(SK_ColorTRANSPARENT);
+      ASSERT_TRUE(tiles.Rasterize(*display_list, bitmap.pixmap()));
+      EXPECT_EQ(memcmp(bitmap.getPixels(), expected.getPixels(),
+                       expected.computeByteSize()),
+                0)
+          << "worker count " << worker_count << ", backdrop filter "
+          << with_backdrop_filter;
+    }
+  }
+}
+
+TEST(GPUSurfaceSoftwareTilesTest, OnlyDrawsDirtyRect) {
+  const SkISize size = SkISize::Make(333, 222);
+  sk_sp<DisplayList> display_list = MakeScene(size);
+  SkBitmap expected = Rasterize(*display_list, size);
+
+  GPUSurfaceSoftwareTiles tiles(2, 64);
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(size.width(), size.height());
+  bitmap.eraseColor(SK_ColorMAGENTA);
+  const SkIRect dirty_rect = SkIRect::MakeLTRB(50, 40, 150, 120);
+  ASSERT_TRUE(tiles.Rasterize(*display_list, bitmap.pixmap(), dirty_rect));
+
+  for (int y = 0; y < size.height(); y++) {
+    for (int x = 0; x < size.width(); x++) {
+      SkColor expected_color = dirty_rect.contains(x, y)
+                                   ? expected.getColor(x, y)
+                                   : SK_ColorMAGENTA;
+      ASSERT_EQ(bitmap.getColor(x, y), expected_color) << x << ", " << y;
+    }
+  }
+}
+
+TEST(GPUSurfaceSoftwareTilesTest, FailsWithoutPixels) {
+  GPUSurfaceSoftwareTiles tiles(2);
+  sk_sp<DisplayList> display_list = MakeScene(SkISize::Make(10, 10));
+  EXPECT_FALSE(tiles.Rasterize(*display_list, SkPixmap()));
+}
+
+}  // namespace testing
+}  // namespace flutter
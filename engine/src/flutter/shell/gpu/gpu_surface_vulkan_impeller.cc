@@ -6,10 +6,10 @@
 
 #include "flow/surface_frame.h"
 #include "flutter/fml/make_copyable.h"
+#include "flutter/shell/common/shared_aiks_context.h"
 #include "impeller/display_list/dl_dispatcher.h"
 #include "impeller/renderer/backend/vulkan/surface_context_vk.h"
 #include "impeller/renderer/surface.h"
-#include "impeller/typographer/backends/skia/typographer_context_skia.h"
 
 namespace flutter {
 
@@ -19,14 +19,15 @@ GPUSurfaceVulkanImpeller::GPUSurfaceVulkanImpeller(
     return;
   }
 
-  auto aiks_context = std::make_shared<impeller::AiksContext>(
-      context, impeller::TypographerContextSkia::Make());
+  auto aiks_context = GetSharedAiksContext(context);
   if (!aiks_context->IsValid()) {
     return;
   }
 
   impeller_context_ = std::move(context);
   aiks_context_ = std::move(aiks_context);
+  transients_buffer_ = impeller::HostBuffer::Create(
+      impeller_context_->GetResourceAllocator());
   is_valid_ = true;
 }
 
@@ -65,10 +66,11 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceVulkanImpeller::AcquireFrame(
   impeller::RenderTarget render_target =
       surface->GetTargetRenderPassDescriptor();
 
-  SurfaceFrame::EncodeCallback encode_callback = [aiks_context =
-                                                      aiks_context_,  //
-                                                  render_target,
-                                                  cull_rect  //
+  SurfaceFrame::EncodeCallback encode_callback =
+      [aiks_context = aiks_context_,            //
+       transients_buffer = transients_buffer_,  //
+       render_target,                           //
+       cull_rect                                //
   ](SurfaceFrame& surface_frame, DlCanvas* canvas) mutable -> bool {
     if (!aiks_context) {
       return false;
@@ -81,11 +83,14 @@ std::unique_ptr<SurfaceFrame> GPUSurfaceVulkanImpeller::AcquireFrame(
     }
 
     SkIRect sk_cull_rect = SkIRect::MakeWH(cull_rect.width, cull_rect.height);
-    return impeller::RenderToOnscreen(aiks_context->GetContentContext(),  //
-                                      render_target,                      //
-                                      display_list,                       //
-                                      sk_cull_rect,                       //
-                                      /*reset_host_buffer=*/true          //
+    auto& content_context = aiks_context->GetContentContext();
+    ScopedTransientsBuffer scoped_transients_buffer(content_context,
+                                                    transients_buffer);
+    return impeller::RenderToOnscreen(content_context,            //
+                                      render_target,              //
+                                      display_list,               //
+                                      sk_cull_rect,               //
+                                      /*reset_host_buffer=*/true  //
     );
   };
 
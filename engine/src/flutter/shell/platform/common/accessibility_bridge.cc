@@ -5,8 +5,11 @@
 #include "accessibility_bridge.h"
 
 #include <functional>
+#include <unordered_set>
 #include <utility>
 
+#include "flutter/fml/time/time_point.h"
+#include "flutter/fml/trace_event.h"
 #include "flutter/third_party/accessibility/ax/ax_tree_manager_map.h"
 #include "flutter/third_party/accessibility/ax/ax_tree_update.h"
 #include "flutter/third_party/accessibility/base/logging.h"
@@ -19,6 +22,40 @@ constexpr int kHasScrollingAction =
     FlutterSemanticsAction::kFlutterSemanticsActionScrollUp |
     FlutterSemanticsAction::kFlutterSemanticsActionScrollDown;
 
+namespace {
+
+// Whether applying |new_data| to a node with |old_data| would change it.
+//
+// The offset container of a node is derived from its parent when an update
+// is applied, so it is not compared.
+bool NodeDataEquals(const ui::AXNodeData& old_data,
+                    const ui::AXNodeData& new_data) {
+  if (old_data.id != new_data.id || old_data.role != new_data.role ||
+      old_data.state != new_data.state ||
+      old_data.actions != new_data.actions ||
+      old_data.string_attributes != new_data.string_attributes ||
+      old_data.int_attributes != new_data.int_attributes ||
+      old_data.float_attributes != new_data.float_attributes ||
+      old_data.bool_attributes != new_data.bool_attributes ||
+      old_data.intlist_attributes != new_data.intlist_attributes ||
+      old_data.stringlist_attributes != new_data.stringlist_attributes ||
+      old_data.html_attributes != new_data.html_attributes ||
+      old_data.child_ids != new_data.child_ids ||
+      old_data.relative_bounds.bounds != new_data.relative_bounds.bounds) {
+    return false;
+  }
+  const gfx::Transform* old_transform =
+      old_data.relative_bounds.transform.get();
+  const gfx::Transform* new_transform =
+      new_data.relative_bounds.transform.get();
+  if (old_transform == nullptr || new_transform == nullptr) {
+    return old_transform == new_transform;
+  }
+  return *old_transform == *new_transform;
+}
+
+}  // namespace
+
 // AccessibilityBridge
 AccessibilityBridge::AccessibilityBridge()
     : tree_(std::make_unique<ui::AXTree>()) {
@@ -48,6 +85,12 @@ void AccessibilityBridge::AddFlutterSemanticsCustomActionUpdate(
 }
 
 void AccessibilityBridge::CommitUpdates() {
+  TRACE_EVENT0("flutter", "AccessibilityBridge::CommitUpdates");
+  const fml::TimePoint start_time = fml::TimePoint::Now();
+  last_commit_stats_ = {
+      .pending_node_count = pending_semantics_node_updates_.size(),
+  };
+
   // AXTree cannot move a node in a single update.
   // This must be split across two updates:
   //
@@ -58,6 +101,7 @@ void AccessibilityBridge::CommitUpdates() {
   std::optional<ui::AXTreeUpdate> remove_reparented =
       CreateRemoveReparentedNodesUpdate();
   if (remove_reparented.has_value()) {
+    last_commit_stats_.serialized_node_count += remove_reparented->nodes.size();
     tree_->Unserialize(remove_reparented.value());
 
     std::string error = tree_->error();
@@ -80,19 +124,23 @@ void AccessibilityBridge::CommitUpdates() {
   // lists in the reversed order, this guarantees parent updates always come
   // before child updates. If the root is in the update, it is guaranteed to
   // be the first node of the last list.
-  std::vector<std::vector<SemanticsNode>> results;
-  while (!pending_semantics_node_updates_.empty()) {
-    auto begin = pending_semantics_node_updates_.begin();
-    SemanticsNode target = begin->second;
-    std::vector<SemanticsNode> sub_tree_list;
-    GetSubTreeList(target, sub_tree_list);
-    results.push_back(sub_tree_list);
-    pending_semantics_node_updates_.erase(begin);
+  //
+  // The lists point into the pending updates, which are only cleared once the
+  // update has been converted.
+  std::vector<std::vector<const SemanticsNode*>> results;
+  std::unordered_set<int32_t> visited;
+  for (const auto& [id, node] : pending_semantics_node_updates_) {
+    if (visited.find(id) != visited.end()) {
+      continue;
+    }
+    std::vector<const SemanticsNode*> sub_tree_list;
+    GetSubTreeList(node, visited, sub_tree_list);
+    results.push_back(std::move(sub_tree_list));
   }
 
   for (size_t i = results.size(); i > 0; i--) {
-    for (const SemanticsNode& node : results[i - 1]) {
-      ConvertFlutterUpdate(node, update);
+    for (const SemanticsNode* node : results[i - 1]) {
+      ConvertFlutterUpdate(*node, update);
     }
   }
 
@@ -102,12 +150,14 @@ void AccessibilityBridge::CommitUpdates() {
   if (!results.empty() && GetRootAsAXNode()->id() == ui::AXNode::kInvalidAXID) {
     FML_DCHECK(!results.back().empty());
 
-    update.root_id = results.back().front().id;
+    update.root_id = results.back().front()->id;
   }
 
+  last_commit_stats_.serialized_node_count += update.nodes.size();
   tree_->Unserialize(update);
   pending_semantics_node_updates_.clear();
   pending_semantics_custom_action_updates_.clear();
+  last_commit_stats_.duration = fml::TimePoint::Now() - start_time;
 
   std::string error = tree_->error();
   if (!error.empty()) {
@@ -142,6 +192,11 @@ const ui::AXTreeData& AccessibilityBridge::GetAXTreeData() const {
   return tree_->data();
 }
 
+const AccessibilityBridge::CommitStats&
+AccessibilityBridge::GetLastCommitStats() const {
+  return last_commit_stats_;
+}
+
 const std::vector<ui::AXEventGenerator::TargetedEvent>
 AccessibilityBridge::GetPendingEvents() const {
   std::vector<ui::AXEventGenerator::TargetedEvent> result(
@@ -241,6 +296,7 @@ AccessibilityBridge::CreateRemoveReparentedNodesUpdate() {
         updates[parent_id] = tree_->GetFromId(parent_id)->data();
       }
 
+      last_commit_stats_.reparented_node_count++;
       ui::AXNodeData* parent = &updates[parent_id];
       auto iter = std::find(parent->child_ids.begin(), parent->child_ids.end(),
                             child_id);
@@ -259,23 +315,25 @@ AccessibilityBridge::CreateRemoveReparentedNodesUpdate() {
       .nodes = std::vector<ui::AXNodeData>(),
   };
 
-  for (std::pair<int32_t, ui::AXNodeData> data : updates) {
-    update.nodes.push_back(std::move(data.second));
+  for (auto& [id, data] : updates) {
+    update.nodes.push_back(std::move(data));
   }
 
   return update;
 }
 
 // Private method.
-void AccessibilityBridge::GetSubTreeList(const SemanticsNode& target,
-                                         std::vector<SemanticsNode>& result) {
-  result.push_back(target);
+void AccessibilityBridge::GetSubTreeList(
+    const SemanticsNode& target,
+    std::unordered_set<int32_t>& visited,
+    std::vector<const SemanticsNode*>& result) {
+  visited.insert(target.id);
+  result.push_back(&target);
   for (int32_t child : target.children_in_traversal_order) {
     auto iter = pending_semantics_node_updates_.find(child);
-    if (iter != pending_semantics_node_updates_.end()) {
-      SemanticsNode node = iter->second;
-      GetSubTreeList(node, result);
-      pending_semantics_node_updates_.erase(iter);
+    if (iter != pending_semantics_node_updates_.end() &&
+        visited.find(child) == visited.end()) {
+      GetSubTreeList(iter->second, visited, result);
     }
   }
 }
@@ -306,7 +364,16 @@ void AccessibilityBridge::ConvertFlutterUpdate(const SemanticsNode& node,
     node_data.child_ids.push_back(child);
   }
   SetTreeData(node, tree_update);
-  tree_update.nodes.push_back(node_data);
+
+  // Semantics updates often resend nodes whose accessibility data has not
+  // changed. Leave those out of the update so the tree does not have to diff
+  // them and notify its observers.
+  ui::AXNode* existing_node = tree_->GetFromId(node.id);
+  if (existing_node != nullptr &&
+      NodeDataEquals(existing_node->data(), node_data)) {
+    return;
+  }
+  tree_update.nodes.push_back(std::move(node_data));
 }
 
 void AccessibilityBridge::SetRoleFromFlutterUpdate(ui::AXNodeData& node_data,
@@ -6,8 +6,10 @@
 #define FLUTTER_SHELL_PLATFORM_COMMON_ACCESSIBILITY_BRIDGE_H_
 
 #include <unordered_map>
+#include <unordered_set>
 
 #include "flutter/fml/mapping.h"
+#include "flutter/fml/time/time_delta.h"
 #include "flutter/shell/platform/embedder/embedder.h"
 
 #include "flutter/third_party/accessibility/ax/ax_event_generator.h"
@@ -43,6 +45,20 @@ class AccessibilityBridge
       public ui::AXPlatformTreeManager,
       private ui::AXTreeObserver {
  public:
+  //------------------------------------------------------------------------------
+  /// @brief      The size and cost of the last call to CommitUpdates().
+  struct CommitStats {
+    /// The number of semantics nodes in the pending updates.
+    size_t pending_node_count = 0;
+    /// The number of nodes that were applied to the accessibility tree.
+    /// Pending nodes whose accessibility data did not change are not applied.
+    size_t serialized_node_count = 0;
+    /// The number of nodes that were moved to a new parent.
+    size_t reparented_node_count = 0;
+    /// The time taken to apply the updates to the accessibility tree.
+    fml::TimeDelta duration;
+  };
+
   //-----------------------------------------------------------------------------
   /// @brief      Creates a new instance of a accessibility bridge.
   AccessibilityBridge();
@@ -94,6 +110,11 @@ class AccessibilityBridge
   ///             has the keyboard focus or the text selection range.
   const ui::AXTreeData& GetAXTreeData() const;
 
+  //------------------------------------------------------------------------------
+  /// @brief      Get the size and duration of the last CommitUpdates(), e.g.
+  ///             to find semantics updates that stall the platform thread.
+  const CommitStats& GetLastCommitStats() const;
+
   //------------------------------------------------------------------------------
   /// @brief      Gets all pending accessibility events generated during
   ///             semantics updates. This is useful when deciding how to handle
@@ -202,6 +223,7 @@ class AccessibilityBridge
   std::unordered_map<int32_t, SemanticsCustomAction>
       pending_semantics_custom_action_updates_;
   AccessibilityNodeId last_focused_id_ = ui::AXNode::kInvalidAXID;
+  CommitStats last_commit_stats_;
 
   void InitAXTree(const ui::AXTreeUpdate& initial_state);
 
@@ -209,8 +231,11 @@ class AccessibilityBridge
   // pending_semantics_updates_. Returns std::nullopt if none are reparented.
   std::optional<ui::AXTreeUpdate> CreateRemoveReparentedNodesUpdate();
 
+  // Adds |target| and the pending updates of its descendants that have not
+  // been visited yet to |result|, in tree order.
   void GetSubTreeList(const SemanticsNode& target,
-                      std::vector<SemanticsNode>& result);
+                      std::unordered_set<int32_t>& visited,
+                      std::vector<const SemanticsNode*>& result);
   void ConvertFlutterUpdate(const SemanticsNode& node,
                             ui::AXTreeUpdate& tree_update);
   void SetRoleFromFlutterUpdate(ui::AXNodeData& node_data,
@@ -205,6 +205,54 @@ TEST(AccessibilityBridgeTest, CanFireChildrenChangedCorrectly) {
               Contains(ui::AXEventGenerator::Event::SUBTREE_CREATED));
 }
 
+TEST(AccessibilityBridgeTest, OnlyAppliesChangedNodes) {
+  std::shared_ptr<TestAccessibilityBridge> bridge =
+      std::make_shared<TestAccessibilityBridge>();
+
+  std::vector<int32_t> children{1, 2};
+  FlutterSemanticsNode2 root = CreateSemanticsNode(0, "root", &children);
+  FlutterSemanticsNode2 child1 = CreateSemanticsNode(1, "child 1");
+  FlutterSemanticsNode2 child2 = CreateSemanticsNode(2, "child 2");
+
+  bridge->AddFlutterSemanticsNodeUpdate(root);
+  bridge->AddFlutterSemanticsNodeUpdate(child1);
+  bridge->AddFlutterSemanticsNodeUpdate(child2);
+  bridge->CommitUpdates();
+  EXPECT_EQ(bridge->GetLastCommitStats().pending_node_count, size_t{3});
+  EXPECT_EQ(bridge->GetLastCommitStats().serialized_node_count, size_t{3});
+  bridge->accessibility_events.clear();
+
+  // Resend the whole tree with only the label of child 2 changed.
+  child2.label = "new child 2";
+  bridge->AddFlutterSemanticsNodeUpdate(root);
+  bridge->AddFlutterSemanticsNodeUpdate(child1);
+  bridge->AddFlutterSemanticsNodeUpdate(child2);
+  bridge->CommitUpdates();
+
+  EXPECT_EQ(bridge->GetLastCommitStats().pending_node_count, size_t{3});
+  EXPECT_EQ(bridge->GetLastCommitStats().serialized_node_count, size_t{1});
+  EXPECT_EQ(bridge->GetLastCommitStats().reparented_node_count, size_t{0});
+
+  auto child2_node = bridge->GetFlutterPlatformNodeDelegateFromID(2).lock();
+  EXPECT_EQ(child2_node->GetName(), "new child 2");
+  EXPECT_THAT(bridge->accessibility_events,
+              Contains(ui::AXEventGenerator::Event::NAME_CHANGED));
+
+  // Resending an unchanged tree leaves it as is.
+  bridge->accessibility_events.clear();
+  bridge->AddFlutterSemanticsNodeUpdate(root);
+  bridge->AddFlutterSemanticsNodeUpdate(child1);
+  bridge->AddFlutterSemanticsNodeUpdate(child2);
+  bridge->CommitUpdates();
+
+  EXPECT_EQ(bridge->GetLastCommitStats().serialized_node_count, size_t{0});
+  EXPECT_TRUE(bridge->accessibility_events.empty());
+  EXPECT_EQ(bridge->GetFlutterPlatformNodeDelegateFromID(0)
+                .lock()
+                ->GetChildCount(),
+            2);
+}
+
 TEST(AccessibilityBridgeTest, CanHandleSelectionChangeCorrectly) {
   std::shared_ptr<TestAccessibilityBridge> bridge =
       std::make_shared<TestAccessibilityBridge>();
@@ -352,6 +400,7 @@ TEST(AccessibilityBridgeTest, CanReparentNode) {
   EXPECT_EQ(child2_node->GetName(), "child 2");
 
   ASSERT_EQ(bridge->accessibility_events.size(), size_t{5});
+  EXPECT_EQ(bridge->GetLastCommitStats().reparented_node_count, size_t{1});
 
   // Child2 is moved from child1 to root.
   EXPECT_THAT(bridge->accessibility_events,
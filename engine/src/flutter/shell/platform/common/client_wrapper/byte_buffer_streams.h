@@ -86,12 +86,14 @@ class ByteBufferStreamWriter : public ByteStreamWriter {
   void WriteAlignment(uint8_t alignment) {
     uint8_t mod = bytes_->size() % alignment;
     if (mod) {
-      for (int i = 0; i < alignment - mod; ++i) {
-        WriteByte(0);
-      }
+      bytes_->resize(bytes_->size() + alignment - mod, 0);
     }
   }
 
+  // Reserves capacity for at least |size| bytes in total, to avoid growing
+  // the buffer repeatedly while writing.
+  void Reserve(size_t size) { bytes_->reserve(size); }
+
  private:
   // The buffer to write to.
   std::vector<uint8_t>* bytes_;
@@ -12,6 +12,7 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "byte_buffer_streams.h"
@@ -78,6 +79,84 @@ EncodedType EncodedTypeForValue(const EncodableValue& value) {
   return EncodedType::kNull;
 }
 
+// Returns the number of bytes used to encode |size| as a variable-length size.
+size_t EncodedSizeOfSize(size_t size) {
+  if (size < 254) {
+    return 1;
+  }
+  return size <= 0xffff ? 3 : 5;
+}
+
+// Returns the number of bytes needed to encode a fixed-type list of |count|
+// elements of |T|, including the worst case alignment padding.
+template <typename T>
+size_t EncodedSizeOfVector(size_t count) {
+  return EncodedSizeOfSize(count) + (sizeof(T) - 1) + count * sizeof(T);
+}
+
+// Returns an upper bound of the number of bytes the standard encoding of
+// |value| takes, used to reserve the output buffer before writing. Custom
+// values are not accounted for, so the result is only a hint when
+// serializers extend the codec.
+size_t EncodedSizeUpperBound(const EncodableValue& value) {
+  // The type discrimination byte.
+  size_t size = 1;
+  switch (value.index()) {
+    case 2:
+      size += 4;
+      break;
+    case 3:
+      size += 8;
+      break;
+    case 4:
+      size += 7 + 8;
+      break;
+    case 5: {
+      size_t length = std::get<std::string>(value).size();
+      size += EncodedSizeOfSize(length) + length;
+      break;
+    }
+    case 6:
+      size += EncodedSizeOfVector<uint8_t>(
+          std::get<std::vector<uint8_t>>(value).size());
+      break;
+    case 7:
+      size += EncodedSizeOfVector<int32_t>(
+          std::get<std::vector<int32_t>>(value).size());
+      break;
+    case 8:
+      size += EncodedSizeOfVector<int64_t>(
+          std::get<std::vector<int64_t>>(value).size());
+      break;
+    case 9:
+      size += EncodedSizeOfVector<double>(
+          std::get<std::vector<double>>(value).size());
+      break;
+    case 10: {
+      const auto& list = std::get<EncodableList>(value);
+      size += EncodedSizeOfSize(list.size());
+      for (const auto& item : list) {
+        size += EncodedSizeUpperBound(item);
+      }
+      break;
+    }
+    case 11: {
+      const auto& map = std::get<EncodableMap>(value);
+      size += EncodedSizeOfSize(map.size());
+      for (const auto& pair : map) {
+        size += EncodedSizeUpperBound(pair.first) +
+                EncodedSizeUpperBound(pair.second);
+      }
+      break;
+    }
+    case 13:
+      size += EncodedSizeOfVector<float>(
+          std::get<std::vector<float>>(value).size());
+      break;
+  }
+  return size;
+}
+
 }  // namespace
 
 StandardCodecSerializer::StandardCodecSerializer() = default;
@@ -188,7 +267,7 @@ EncodableValue StandardCodecSerializer::ReadValueOfType(
       std::string string_value;
       string_value.resize(size);
       stream->ReadBytes(reinterpret_cast<uint8_t*>(&string_value[0]), size);
-      return EncodableValue(string_value);
+      return EncodableValue(std::move(string_value));
     }
     case EncodedType::kUInt8List:
       return ReadVector<uint8_t>(stream);
@@ -205,7 +284,7 @@ EncodableValue StandardCodecSerializer::ReadValueOfType(
       for (size_t i = 0; i < length; ++i) {
         list_value.push_back(ReadValue(stream));
       }
-      return EncodableValue(list_value);
+      return EncodableValue(std::move(list_value));
     }
     case EncodedType::kMap: {
       size_t length = ReadSize(stream);
@@ -215,7 +294,7 @@ EncodableValue StandardCodecSerializer::ReadValueOfType(
         EncodableValue value = ReadValue(stream);
         map_value.emplace(std::move(key), std::move(value));
       }
-      return EncodableValue(map_value);
+      return EncodableValue(std::move(map_value));
     }
     case EncodedType::kFloat32List: {
       return ReadVector<float>(stream);
@@ -268,11 +347,11 @@ EncodableValue StandardCodecSerializer::ReadVector(
   }
   stream->ReadBytes(reinterpret_cast<uint8_t*>(vector.data()),
                     count * type_size);
-  return EncodableValue(vector);
+  return EncodableValue(std::move(vector));
 }
 
 template <typename T>
-void StandardCodecSerializer::WriteVector(const std::vector<T> vector,
+void StandardCodecSerializer::WriteVector(const std::vector<T>& vector,
                                           ByteStreamWriter* stream) const {
   size_t count = vector.size();
   WriteSize(count, stream);
@@ -330,6 +409,7 @@ StandardMessageCodec::EncodeMessageInternal(
     const EncodableValue& message) const {
   auto encoded = std::make_unique<std::vector<uint8_t>>();
   ByteBufferStreamWriter stream(encoded.get());
+  stream.Reserve(EncodedSizeUpperBound(message));
   serializer_->WriteValue(message, &stream);
   return encoded;
 }
@@ -384,7 +464,12 @@ StandardMethodCodec::EncodeMethodCallInternal(
     const MethodCall<EncodableValue>& method_call) const {
   auto encoded = std::make_unique<std::vector<uint8_t>>();
   ByteBufferStreamWriter stream(encoded.get());
-  serializer_->WriteValue(EncodableValue(method_call.method_name()), &stream);
+  EncodableValue method_name(method_call.method_name());
+  stream.Reserve(EncodedSizeUpperBound(method_name) +
+                 (method_call.arguments()
+                      ? EncodedSizeUpperBound(*method_call.arguments())
+                      : 1));
+  serializer_->WriteValue(method_name, &stream);
   if (method_call.arguments()) {
     serializer_->WriteValue(*method_call.arguments(), &stream);
   } else {
@@ -398,6 +483,7 @@ StandardMethodCodec::EncodeSuccessEnvelopeInternal(
     const EncodableValue* result) const {
   auto encoded = std::make_unique<std::vector<uint8_t>>();
   ByteBufferStreamWriter stream(encoded.get());
+  stream.Reserve(1 + (result ? EncodedSizeUpperBound(*result) : 1));
   stream.WriteByte(0);
   if (result) {
     serializer_->WriteValue(*result, &stream);
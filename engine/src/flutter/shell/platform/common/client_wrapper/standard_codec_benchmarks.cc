@@ -0,0 +1,88 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/shell/platform/common/client_wrapper/include/flutter/standard_message_codec.h"
+
+namespace flutter {
+
+namespace {
+
+// Creates a map with |entry_count| entries of mixed scalar, string, and nested
+// values, similar to the payloads of plugins that report structured data.
+EncodableValue CreateLargeMap(int64_t entry_count) {
+  EncodableMap map;
+  for (int64_t i = 0; i < entry_count; i++) {
+    EncodableMap entry = {
+        {EncodableValue("id"), EncodableValue(i)},
+        {EncodableValue("name"), EncodableValue("entry " + std::to_string(i))},
+        {EncodableValue("value"), EncodableValue(static_cast<double>(i) / 3)},
+        {EncodableValue("enabled"), EncodableValue(i % 2 == 0)},
+        {EncodableValue("tags"),
+         EncodableValue(EncodableList{EncodableValue("a"), EncodableValue(1)})},
+    };
+    map[EncodableValue("key" + std::to_string(i))] =
+        EncodableValue(std::move(entry));
+  }
+  return EncodableValue(std::move(map));
+}
+
+// Creates a list holding typed lists of |length| elements each.
+EncodableValue CreateTypedLists(int64_t length) {
+  return EncodableValue(EncodableList{
+      EncodableValue(std::vector<uint8_t>(length, 1)),
+      EncodableValue(std::vector<int32_t>(length, 2)),
+      EncodableValue(std::vector<int64_t>(length, 3)),
+      EncodableValue(std::vector<float>(length, 4.0f)),
+      EncodableValue(std::vector<double>(length, 5.0)),
+  });
+}
+
+void BenchmarkEncode(benchmark::State& state, const EncodableValue& value) {
+  const StandardMessageCodec& codec = StandardMessageCodec::GetInstance();
+  size_t encoded_size = 0;
+  while (state.KeepRunning()) {
+    auto encoded = codec.EncodeMessage(value);
+    encoded_size = encoded->size();
+    benchmark::DoNotOptimize(encoded);
+  }
+  state.SetBytesProcessed(state.iterations() * encoded_size);
+}
+
+void BenchmarkDecode(benchmark::State& state, const EncodableValue& value) {
+  const StandardMessageCodec& codec = StandardMessageCodec::GetInstance();
+  auto encoded = codec.EncodeMessage(value);
+  while (state.KeepRunning()) {
+    auto decoded = codec.DecodeMessage(*encoded);
+    benchmark::DoNotOptimize(decoded);
+  }
+  state.SetBytesProcessed(state.iterations() * encoded->size());
+}
+
+}  // namespace
+
+static void BM_StandardCodecEncodeLargeMap(benchmark::State& state) {
+  BenchmarkEncode(state, CreateLargeMap(state.range(0)));
+}
+BENCHMARK(BM_StandardCodecEncodeLargeMap)->Range(16, 16 << 10);
+
+static void BM_StandardCodecDecodeLargeMap(benchmark::State& state) {
+  BenchmarkDecode(state, CreateLargeMap(state.range(0)));
+}
+BENCHMARK(BM_StandardCodecDecodeLargeMap)->Range(16, 16 << 10);
+
+static void BM_StandardCodecEncodeTypedLists(benchmark::State& state) {
+  BenchmarkEncode(state, CreateTypedLists(state.range(0)));
+}
+BENCHMARK(BM_StandardCodecEncodeTypedLists)->Range(1 << 10, 1 << 20);
+
+static void BM_StandardCodecDecodeTypedLists(benchmark::State& state) {
+  BenchmarkDecode(state, CreateTypedLists(state.range(0)));
+}
+BENCHMARK(BM_StandardCodecDecodeTypedLists)->Range(1 << 10, 1 << 20);
+
+}  // namespace flutter
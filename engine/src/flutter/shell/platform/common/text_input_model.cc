@@ -31,7 +31,7 @@ TextInputModel::~TextInputModel() = default;
 bool TextInputModel::SetText(const std::string& text,
                              const TextRange& selection,
                              const TextRange& composing_range) {
-  text_ = fml::Utf8ToUtf16(text);
+  text_.SetText(fml::Utf8ToUtf16(text));
   if (!text_range().Contains(selection) ||
       !text_range().Contains(composing_range)) {
     return false;
@@ -294,15 +294,17 @@ bool TextInputModel::MoveCursorBack() {
   return false;
 }
 
-std::string TextInputModel::GetText() const {
-  return fml::Utf16ToUtf8(text_);
+const std::string& TextInputModel::GetText() const {
+  if (utf8_text_version_ != text_.version()) {
+    utf8_text_ = fml::Utf16ToUtf8(text_.ToString());
+    utf8_text_version_ = text_.version();
+  }
+  return utf8_text_;
 }
 
 int TextInputModel::GetCursorOffset() const {
   // Measure the length of the current text up to the selection extent.
-  // There is probably a much more efficient way of doing this.
-  auto leading_text = text_.substr(0, selection_.extent());
-  return fml::Utf16ToUtf8(leading_text).size();
+  return text_.Utf8Length(selection_.extent());
 }
 
 }  // namespace flutter
@@ -6,14 +6,19 @@
 #define FLUTTER_SHELL_PLATFORM_COMMON_TEXT_INPUT_MODEL_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 
+#include "flutter/shell/platform/common/text_piece_table.h"
 #include "flutter/shell/platform/common/text_range.h"
 
 namespace flutter {
 
 // Handles underlying text input state, using a simple ASCII model.
 //
+// The text is kept in a piece table, so edits don't copy the text and their
+// cost doesn't grow with the length of the text.
+//
 // Ignores special states like "insert mode" for now.
 class TextInputModel {
  public:
@@ -188,7 +193,11 @@ class TextInputModel {
   bool SelectToEnd();
 
   // Gets the current text as UTF-8.
-  std::string GetText() const;
+  //
+  // The text is only converted again when it is read after an edit, which
+  // also updates the string returned by earlier calls. Copy it to keep the
+  // text from before an edit.
+  const std::string& GetText() const;
 
   // Gets the cursor position as a byte offset in UTF-8 string returned from
   // GetText().
@@ -223,7 +232,11 @@ class TextInputModel {
     return composing_ ? composing_range_ : text_range();
   }
 
-  std::u16string text_;
+  TextPieceTable text_;
+  // The UTF-8 conversion of |text_| returned by GetText(), and the version of
+  // |text_| it was converted from.
+  mutable std::string utf8_text_;
+  mutable std::optional<uint64_t> utf8_text_version_;
   TextRange selection_ = TextRange(0);
   TextRange composing_range_ = TextRange(0);
   bool composing_ = false;
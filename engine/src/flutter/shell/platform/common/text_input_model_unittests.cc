@@ -1729,4 +1729,39 @@ TEST(TextInputModel, GetCursorOffsetReverseSelection) {
   EXPECT_EQ(model->GetCursorOffset(), 1);
 }
 
+TEST(TextInputModel, GetTextAfterEdits) {
+  auto model = std::make_unique<TextInputModel>();
+  model->SetText("ABCDE");
+  EXPECT_EQ(model->GetText(), "ABCDE");
+  EXPECT_TRUE(model->SetSelection(TextRange(5)));
+  model->AddText("F");
+  EXPECT_EQ(model->GetText(), "ABCDEF");
+  EXPECT_TRUE(model->Backspace());
+  EXPECT_EQ(model->GetText(), "ABCDE");
+  EXPECT_TRUE(model->SetSelection(TextRange(0)));
+  EXPECT_TRUE(model->Delete());
+  EXPECT_EQ(model->GetText(), "BCDE");
+  EXPECT_TRUE(model->DeleteSurrounding(0, 2));
+  EXPECT_EQ(model->GetText(), "DE");
+  model->BeginComposing();
+  model->UpdateComposingText(u"é");
+  EXPECT_EQ(model->GetText(), "éDE");
+  model->CommitComposing();
+  model->EndComposing();
+  EXPECT_TRUE(model->SetSelection(TextRange(0, 2)));
+  model->AddText("X");
+  EXPECT_EQ(model->GetText(), "XE");
+}
+
+TEST(TextInputModel, GetTextIsUpdatedAfterEdits) {
+  auto model = std::make_unique<TextInputModel>();
+  model->SetText("ABC");
+  const std::string& text = model->GetText();
+  EXPECT_EQ(&model->GetText(), &text);
+  EXPECT_TRUE(model->SetSelection(TextRange(3)));
+  model->AddText("D");
+  EXPECT_EQ(model->GetText(), "ABCD");
+  EXPECT_EQ(text, "ABCD");
+}
+
 }  // namespace flutter
@@ -0,0 +1,222 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/common/text_piece_table.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "flutter/fml/logging.h"
+
+namespace flutter {
+
+namespace {
+
+// The number of pieces above which the table is compacted into one piece.
+//
+// Compacting copies the whole text, so this trades the occasional copy against
+// the cost of moving piece descriptors on each edit.
+constexpr size_t kMaxPieceCount = 1024;
+
+// Returns the number of UTF-8 bytes |code_unit| contributes to the encoding of
+// well-formed UTF-16 text. Each half of a surrogate pair counts for half of the
+// four bytes of the encoded code point.
+size_t Utf8LengthOfCodeUnit(char16_t code_unit) {
+  if (code_unit < 0x80) {
+    return 1;
+  }
+  if (code_unit < 0x800) {
+    return 2;
+  }
+  if ((code_unit & 0xF800) == 0xD800) {
+    return 2;
+  }
+  return 3;
+}
+
+}  // namespace
+
+TextPieceTable::TextPieceTable() = default;
+
+TextPieceTable::~TextPieceTable() = default;
+
+void TextPieceTable::SetText(std::u16string text) {
+  version_++;
+  original_ = std::move(text);
+  added_.clear();
+  pieces_.clear();
+  length_ = original_.length();
+  if (length_ > 0) {
+    pieces_.push_back({Source::kOriginal, 0, length_});
+  }
+  cached_index_ = 0;
+  cached_start_ = 0;
+}
+
+char16_t TextPieceTable::at(size_t position) const {
+  size_t start;
+  const Piece& piece = pieces_[FindPiece(position, &start)];
+  return buffer(piece)[piece.start + position - start];
+}
+
+void TextPieceTable::insert(size_t position, const std::u16string& text) {
+  FML_DCHECK(position <= length_);
+  if (text.empty()) {
+    return;
+  }
+  version_++;
+  // Extend the piece ending at |position| if its text is at the end of the
+  // added buffer, which is the case when typing.
+  if (position > 0) {
+    size_t start;
+    Piece& piece = pieces_[FindPiece(position - 1, &start)];
+    if (piece.source == Source::kAdded &&
+        start + piece.length == position &&
+        piece.start + piece.length == added_.length()) {
+      added_.append(text);
+      piece.length += text.length();
+      length_ += text.length();
+      return;
+    }
+  }
+
+  size_t index = SplitAt(position);
+  pieces_.insert(pieces_.begin() + index,
+                 {Source::kAdded, added_.length(), text.length()});
+  added_.append(text);
+  length_ += text.length();
+  cached_index_ = index;
+  cached_start_ = position;
+
+  if (pieces_.size() > kMaxPieceCount) {
+    Compact();
+  }
+}
+
+void TextPieceTable::erase(size_t position, size_t length) {
+  FML_DCHECK(position + length <= length_);
+  if (length == 0) {
+    return;
+  }
+  version_++;
+  size_t first = SplitAt(position);
+  size_t last = SplitAt(position + length);
+
+  // Reclaim deleted text at the end of the added buffer, so that typing after
+  // a backspace keeps extending the same piece. No other piece refers to it.
+  for (size_t i = first; i < last; i++) {
+    const Piece& piece = pieces_[i];
+    if (piece.source == Source::kAdded &&
+        piece.start + piece.length == added_.length()) {
+      added_.resize(piece.start);
+    }
+  }
+  pieces_.erase(pieces_.begin() + first, pieces_.begin() + last);
+  length_ -= length;
+  cached_index_ = first;
+  cached_start_ = position;
+
+  // Rejoin the pieces around the deleted range if they are adjacent in their
+  // buffer, for instance after deleting text inserted into the middle of a
+  // piece.
+  if (first > 0 && first < pieces_.size()) {
+    Piece& previous = pieces_[first - 1];
+    const Piece& next = pieces_[first];
+    if (previous.source == next.source &&
+        previous.start + previous.length == next.start) {
+      cached_index_ = first - 1;
+      cached_start_ = position - previous.length;
+      previous.length += next.length;
+      pieces_.erase(pieces_.begin() + first);
+    }
+  }
+
+  if (pieces_.size() > kMaxPieceCount) {
+    Compact();
+  }
+}
+
+void TextPieceTable::replace(size_t position,
+                             size_t length,
+                             const std::u16string& text) {
+  erase(position, length);
+  insert(position, text);
+}
+
+std::u16string TextPieceTable::ToString() const {
+  std::u16string text;
+  text.reserve(length_);
+  for (const Piece& piece : pieces_) {
+    text.append(buffer(piece), piece.start, piece.length);
+  }
+  return text;
+}
+
+size_t TextPieceTable::Utf8Length(size_t length) const {
+  FML_DCHECK(length <= length_);
+  size_t utf8_length = 0;
+  for (const Piece& piece : pieces_) {
+    if (length == 0) {
+      break;
+    }
+    size_t count = std::min(length, piece.length);
+    const char16_t* data = buffer(piece).data() + piece.start;
+    for (size_t i = 0; i < count; i++) {
+      utf8_length += Utf8LengthOfCodeUnit(data[i]);
+    }
+    length -= count;
+  }
+  return utf8_length;
+}
+
+size_t TextPieceTable::FindPiece(size_t position, size_t* piece_start) const {
+  FML_DCHECK(position < length_);
+  size_t index = cached_index_;
+  size_t start = cached_start_;
+  if (index >= pieces_.size()) {
+    index = 0;
+    start = 0;
+  }
+  while (position < start) {
+    index--;
+    start -= pieces_[index].length;
+  }
+  while (position >= start + pieces_[index].length) {
+    start += pieces_[index].length;
+    index++;
+  }
+  cached_index_ = index;
+  cached_start_ = start;
+  *piece_start = start;
+  return index;
+}
+
+size_t TextPieceTable::SplitAt(size_t position) {
+  if (position == length_) {
+    return pieces_.size();
+  }
+  size_t start;
+  size_t index = FindPiece(position, &start);
+  if (position == start) {
+    return index;
+  }
+  Piece& piece = pieces_[index];
+  size_t head_length = position - start;
+  Piece tail = {piece.source, piece.start + head_length,
+                piece.length - head_length};
+  piece.length = head_length;
+  pieces_.insert(pieces_.begin() + index + 1, tail);
+  cached_index_ = index + 1;
+  cached_start_ = position;
+  return index + 1;
+}
+
+void TextPieceTable::Compact() {
+  // The text is the same, so it keeps its version.
+  uint64_t version = version_;
+  SetText(ToString());
+  version_ = version;
+}
+
+}  // namespace flutter
@@ -0,0 +1,107 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_COMMON_TEXT_PIECE_TABLE_H_
+#define FLUTTER_SHELL_PLATFORM_COMMON_TEXT_PIECE_TABLE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace flutter {
+
+// UTF-16 text storage that edits without moving the stored text.
+//
+// The text is described by a list of pieces, each referring to a span of
+// either the original text or an append-only buffer holding all inserted text.
+// Insertions and deletions only split, trim or add pieces, so their cost
+// depends on the number of pieces rather than on the length of the text.
+// Consecutive insertions at the end of the previous insertion, as produced by
+// typing, extend the existing piece instead of adding new ones.
+class TextPieceTable {
+ public:
+  TextPieceTable();
+  ~TextPieceTable();
+
+  // Replaces the entire contents with |text|.
+  void SetText(std::u16string text);
+
+  // The length of the text in UTF-16 code units.
+  size_t length() const { return length_; }
+
+  // Whether the text is empty.
+  bool empty() const { return length_ == 0; }
+
+  // A number that changes whenever the text changes, so that values derived
+  // from the text can tell whether they are out of date.
+  uint64_t version() const { return version_; }
+
+  // Returns the code unit at |position|, which must be less than |length()|.
+  char16_t at(size_t position) const;
+
+  // Inserts |text| before |position|.
+  void insert(size_t position, const std::u16string& text);
+
+  // Removes |length| code units starting at |position|.
+  void erase(size_t position, size_t length);
+
+  // Replaces |length| code units starting at |position| with |text|.
+  void replace(size_t position, size_t length, const std::u16string& text);
+
+  // Returns a copy of the entire text.
+  std::u16string ToString() const;
+
+  // Returns the number of bytes the first |length| code units of the text
+  // take up when encoded as UTF-8.
+  size_t Utf8Length(size_t length) const;
+
+  // The number of pieces describing the text. Exposed for testing.
+  size_t piece_count() const { return pieces_.size(); }
+
+ private:
+  enum class Source { kOriginal, kAdded };
+
+  struct Piece {
+    Source source;
+    size_t start;
+    size_t length;
+  };
+
+  // Returns the buffer a piece refers to.
+  const std::u16string& buffer(const Piece& piece) const {
+    return piece.source == Source::kOriginal ? original_ : added_;
+  }
+
+  // Returns the index of the piece containing |position|, which must be less
+  // than |length()|, and sets |piece_start| to the position of its first code
+  // unit.
+  size_t FindPiece(size_t position, size_t* piece_start) const;
+
+  // Splits the piece containing |position| so that a piece starts there.
+  //
+  // Returns the index of the piece starting at |position|, or the number of
+  // pieces if |position| is the end of the text.
+  size_t SplitAt(size_t position);
+
+  // Replaces all pieces with a single piece over a fresh copy of the text.
+  //
+  // Bounds the number of pieces, and the memory held by deleted text, after
+  // long editing sessions.
+  void Compact();
+
+  std::u16string original_;
+  std::u16string added_;
+  std::vector<Piece> pieces_;
+  size_t length_ = 0;
+  uint64_t version_ = 0;
+
+  // The last piece found by |FindPiece|. Edits are usually close to the
+  // previous one, so lookups start here.
+  mutable size_t cached_index_ = 0;
+  mutable size_t cached_start_ = 0;
+};
+
+}  // namespace flutter
+
+#endif  // FLUTTER_SHELL_PLATFORM_COMMON_TEXT_PIECE_TABLE_H_
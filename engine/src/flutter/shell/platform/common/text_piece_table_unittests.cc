@@ -0,0 +1,198 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/common/text_piece_table.h"
+
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace flutter {
+
+TEST(TextPieceTable, Empty) {
+  TextPieceTable table;
+  EXPECT_TRUE(table.empty());
+  EXPECT_EQ(table.length(), 0u);
+  EXPECT_EQ(table.ToString(), u"");
+  EXPECT_EQ(table.piece_count(), 0u);
+}
+
+TEST(TextPieceTable, SetText) {
+  TextPieceTable table;
+  table.SetText(u"ABCDE");
+  EXPECT_EQ(table.length(), 5u);
+  EXPECT_EQ(table.ToString(), u"ABCDE");
+  EXPECT_EQ(table.at(0), u'A');
+  EXPECT_EQ(table.at(4), u'E');
+  EXPECT_EQ(table.piece_count(), 1u);
+}
+
+TEST(TextPieceTable, SetTextDiscardsEdits) {
+  TextPieceTable table;
+  table.SetText(u"ABCDE");
+  table.insert(2, u"xyz");
+  table.SetText(u"FGHIJ");
+  EXPECT_EQ(table.ToString(), u"FGHIJ");
+  EXPECT_EQ(table.piece_count(), 1u);
+}
+
+TEST(TextPieceTable, Insert) {
+  TextPieceTable table;
+  table.SetText(u"ABCDE");
+  table.insert(0, u"<");
+  table.insert(6, u">");
+  table.insert(3, u"xy");
+  EXPECT_EQ(table.ToString(), u"<ABxyCDE>");
+  EXPECT_EQ(table.length(), 9u);
+  EXPECT_EQ(table.at(3), u'x');
+  EXPECT_EQ(table.at(5), u'C');
+}
+
+TEST(TextPieceTable, InsertEmpty) {
+  TextPieceTable table;
+  table.SetText(u"ABCDE");
+  table.insert(2, u"");
+  EXPECT_EQ(table.ToString(), u"ABCDE");
+  EXPECT_EQ(table.piece_count(), 1u);
+}
+
+TEST(TextPieceTable, TypingExtendsPiece) {
+  TextPieceTable table;
+  table.SetText(u"ABCDE");
+  for (size_t i = 0; i < 100; i++) {
+    table.insert(2 + i, u"x");
+  }
+  EXPECT_EQ(table.ToString(), u"AB" + std::u16string(100, u'x') + u"CDE");
+  EXPECT_EQ(table.piece_count(), 3u);
+}
+
+TEST(TextPieceTable, TypingAfterBackspaceExtendsPiece) {
+  TextPieceTable table;
+  table.SetText(u"ABCDE");
+  table.insert(2, u"xyz");
+  table.erase(4, 1);
+  table.insert(4, u"w");
+  EXPECT_EQ(table.ToString(), u"ABxywCDE");
+  EXPECT_EQ(table.piece_count(), 3u);
+}
+
+TEST(TextPieceTable, Erase) {
+  TextPieceTable table;
+  table.SetText(u"ABCDE");
+  table.erase(1, 3);
+  EXPECT_EQ(table.ToString(), u"AE");
+  table.erase(0, 1);
+  EXPECT_EQ(table.ToString(), u"E");
+  table.erase(0, 1);
+  EXPECT_EQ(table.ToString(), u"");
+  EXPECT_TRUE(table.empty());
+}
+
+TEST(TextPieceTable, EraseAcrossPieces) {
+  TextPieceTable table;
+  table.SetText(u"ABCDE");
+  table.insert(2, u"xyz");
+  table.erase(1, 6);
+  EXPECT_EQ(table.ToString(), u"AE");
+}
+
+TEST(TextPieceTable, EraseInsertionRejoinsPieces) {
+  TextPieceTable table;
+  table.SetText(u"ABCDE");
+  table.insert(2, u"xyz");
+  EXPECT_EQ(table.piece_count(), 3u);
+  table.erase(2, 3);
+  EXPECT_EQ(table.ToString(), u"ABCDE");
+  EXPECT_EQ(table.piece_count(), 1u);
+}
+
+TEST(TextPieceTable, Replace) {
+  TextPieceTable table;
+  table.SetText(u"ABCDE");
+  table.replace(1, 3, u"xy");
+  EXPECT_EQ(table.ToString(), u"AxyE");
+  table.replace(0, 0, u"<");
+  EXPECT_EQ(table.ToString(), u"<AxyE");
+  table.replace(0, 5, u"");
+  EXPECT_EQ(table.ToString(), u"");
+}
+
+TEST(TextPieceTable, Utf8Length) {
+  TextPieceTable table;
+  table.SetText(u"Aé€");
+  table.insert(3, u"\U0001F604B");
+  EXPECT_EQ(table.Utf8Length(0), 0u);
+  EXPECT_EQ(table.Utf8Length(1), 1u);
+  EXPECT_EQ(table.Utf8Length(2), 3u);
+  EXPECT_EQ(table.Utf8Length(3), 6u);
+  EXPECT_EQ(table.Utf8Length(5), 10u);
+  EXPECT_EQ(table.Utf8Length(6), 11u);
+}
+
+TEST(TextPieceTable, ManyEditsAreCompacted) {
+  TextPieceTable table;
+  std::u16string expected(4096, u'a');
+  table.SetText(expected);
+  for (size_t i = 0; i < 2048; i++) {
+    // Insert every other position so edits never extend a piece.
+    table.insert(i * 2, u"b");
+    expected.insert(i * 2, u"b");
+    EXPECT_LE(table.piece_count(), 1025u);
+  }
+  EXPECT_EQ(table.ToString(), expected);
+}
+
+TEST(TextPieceTable, MatchesStringForRandomEdits) {
+  std::mt19937 random(42);
+  TextPieceTable table;
+  std::u16string expected = u"The quick brown fox jumps over the lazy dog";
+  table.SetText(expected);
+  for (int i = 0; i < 10000; i++) {
+    size_t position = random() % (expected.length() + 1);
+    size_t length = random() % (expected.length() - position + 1) % 8;
+    std::u16string text(random() % 4, static_cast<char16_t>(u'A' + i % 26));
+    switch (random() % 3) {
+      case 0:
+        table.insert(position, text);
+        expected.insert(position, text);
+        break;
+      case 1:
+        table.erase(position, length);
+        expected.erase(position, length);
+        break;
+      default:
+        table.replace(position, length, text);
+        expected.replace(position, length, text);
+        break;
+    }
+    ASSERT_EQ(table.length(), expected.length());
+    if (!expected.empty()) {
+      size_t index = random() % expected.length();
+      ASSERT_EQ(table.at(index), expected[index]);
+    }
+  }
+  EXPECT_EQ(table.ToString(), expected);
+}
+
+TEST(TextPieceTable, VersionChangesOnlyWithText) {
+  TextPieceTable table;
+  table.SetText(u"ABC");
+  uint64_t version = table.version();
+
+  table.insert(1, u"");
+  table.erase(1, 0);
+  EXPECT_EQ(table.version(), version);
+
+  table.insert(1, u"X");
+  EXPECT_NE(table.version(), version);
+  version = table.version();
+  table.erase(1, 1);
+  EXPECT_NE(table.version(), version);
+  version = table.version();
+  table.SetText(u"ABC");
+  EXPECT_NE(table.version(), version);
+}
+
+}  // namespace flutter
@@ -6,6 +6,7 @@
 #define RAPIDJSON_HAS_STDSTRING 1
 
 #include <cstring>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <set>
@@ -43,13 +44,16 @@ extern const intptr_t kPlatformStrongDillSize;
 #include "flutter/assets/directory_asset_bundle.h"
 #include "flutter/common/graphics/persistent_cache.h"
 #include "flutter/common/task_runners.h"
+#include "flutter/flow/frame_phase_profiler.h"
 #include "flutter/fml/command_line.h"
 #include "flutter/fml/file.h"
 #include "flutter/fml/make_copyable.h"
+#include "flutter/fml/mapping.h"
 #include "flutter/fml/message_loop.h"
 #include "flutter/fml/paths.h"
 #include "flutter/fml/trace_event.h"
 #include "flutter/shell/common/rasterizer.h"
+#include "flutter/shell/common/startup_timeline.h"
 #include "flutter/shell/common/switches.h"
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/embedder/embedder_engine.h"
@@ -180,7 +184,9 @@ static bool IsSoftwareRendererConfigValid(const FlutterRendererConfig* config) {
   const FlutterSoftwareRendererConfig* software_config = &config->software;
 
   if (SAFE_ACCESS(software_config, surface_present_callback, nullptr) ==
-      nullptr) {
+          nullptr &&
+      SAFE_ACCESS(software_config, surface_present_with_info_callback,
+                  nullptr) == nullptr) {
     return false;
   }
 
@@ -708,15 +714,49 @@ InferSoftwarePlatformViewCreationCallback(
     return nullptr;
   }
 
-  auto software_present_backing_store =
-      [ptr = config->software.surface_present_callback, user_data](
-          const void* allocation, size_t row_bytes, size_t height) -> bool {
-    return ptr(user_data, allocation, row_bytes, height);
-  };
+  const FlutterSoftwareRendererConfig* software_config = &config->software;
+
+  std::function<bool(const void*, size_t, size_t, const SkIRect&)>
+      software_present_backing_store;
+  auto present_with_info = SAFE_ACCESS(
+      software_config, surface_present_with_info_callback, nullptr);
+  if (present_with_info) {
+    software_present_backing_store =
+        [present_with_info, user_data](const void* allocation,
+                                       size_t row_bytes, size_t height,
+                                       const SkIRect& damage) -> bool {
+      // Like for the OpenGL present info, the damage is a single rectangle,
+      // which is empty if the buffer didn't change.
+      FlutterRect damage_rect = SkIRectToFlutterRect(damage);
+      FlutterDamage frame_damage{
+          .struct_size = sizeof(FlutterDamage),
+          .num_rects = 1,
+          .damage = &damage_rect,
+      };
+
+      FlutterSoftwarePresentInfo present_info = {
+          .struct_size = sizeof(FlutterSoftwarePresentInfo),
+          .allocation = allocation,
+          .row_bytes = row_bytes,
+          .height = height,
+          .frame_damage = frame_damage,
+      };
+
+      return present_with_info(user_data, &present_info);
+    };
+  } else {
+    software_present_backing_store =
+        [ptr = config->software.surface_present_callback, user_data](
+            const void* allocation, size_t row_bytes, size_t height,
+            const SkIRect& damage) -> bool {
+      return ptr(user_data, allocation, row_bytes, height);
+    };
+  }
 
   flutter::EmbedderSurfaceSoftware::SoftwareDispatchTable
       software_dispatch_table = {
           software_present_backing_store,  // required
+          SAFE_ACCESS(software_config, raster_worker_count, 0),  // optional
       };
 
   return fml::MakeCopyable(
@@ -2031,6 +2071,28 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
   if (SAFE_ACCESS(args, log_tag, nullptr) != nullptr) {
     settings.log_tag = SAFE_ACCESS(args, log_tag, nullptr);
   }
+  if (SAFE_ACCESS(args, frame_rasterized_callback, nullptr) != nullptr) {
+    FlutterFrameRasterizedCallback callback =
+        SAFE_ACCESS(args, frame_rasterized_callback, nullptr);
+    settings.frame_rasterized_callback =
+        [callback, user_data](const flutter::FrameTiming& frame_timing) {
+          auto nanos = [&frame_timing](flutter::FrameTiming::Phase phase) {
+            return frame_timing.Get(phase).ToEpochDelta().ToNanoseconds();
+          };
+          FlutterFrameTiming timing = {};
+          timing.struct_size = sizeof(FlutterFrameTiming);
+          timing.frame_number = frame_timing.GetFrameNumber();
+          timing.vsync_start_nanos = nanos(flutter::FrameTiming::kVsyncStart);
+          timing.build_start_nanos = nanos(flutter::FrameTiming::kBuildStart);
+          timing.build_finish_nanos =
+              nanos(flutter::FrameTiming::kBuildFinish);
+          timing.raster_start_nanos =
+              nanos(flutter::FrameTiming::kRasterStart);
+          timing.raster_finish_nanos =
+              nanos(flutter::FrameTiming::kRasterFinish);
+          callback(&timing, user_data);
+        };
+  }
 
   bool has_update_semantics_2_callback =
       SAFE_ACCESS(args, update_semantics_callback2, nullptr) != nullptr;
@@ -2258,9 +2320,26 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
     }
     custom_task_runners->thread_priority_setter(priority);
   };
-  auto thread_host =
-      flutter::EmbedderThreadHost::CreateEmbedderOrEngineManagedThreadHost(
-          custom_task_runners, thread_config_callback);
+  auto spawner = reinterpret_cast<flutter::EmbedderEngine*>(
+      SAFE_ACCESS(args, spawner, nullptr));
+  std::shared_ptr<flutter::EmbedderThreadHost> thread_host;
+  if (spawner != nullptr) {
+    if (!spawner->IsValid()) {
+      return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                                "The engine to spawn from was not running.");
+    }
+    if (custom_task_runners != nullptr) {
+      return LOG_EMBEDDER_ERROR(
+          kInvalidArguments,
+          "Spawned engines run on the task runners of their spawner, so they "
+          "cannot specify custom task runners.");
+    }
+    thread_host = spawner->GetThreadHost();
+  } else {
+    thread_host =
+        flutter::EmbedderThreadHost::CreateEmbedderOrEngineManagedThreadHost(
+            custom_task_runners, thread_config_callback);
+  }
 
   if (!thread_host || !thread_host->IsValid()) {
     return LOG_EMBEDDER_ERROR(kInvalidArguments,
@@ -2275,16 +2354,12 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
                               "Task runner configuration was invalid.");
   }
 
-  auto run_configuration =
-      flutter::RunConfiguration::InferFromSettings(settings);
-
+  std::string dart_entrypoint;
   if (SAFE_ACCESS(args, custom_dart_entrypoint, nullptr) != nullptr) {
-    auto dart_entrypoint = std::string{args->custom_dart_entrypoint};
-    if (!dart_entrypoint.empty()) {
-      run_configuration.SetEntrypoint(std::move(dart_entrypoint));
-    }
+    dart_entrypoint = std::string{args->custom_dart_entrypoint};
   }
 
+  std::vector<std::string> dart_entrypoint_args;
   if (SAFE_ACCESS(args, dart_entrypoint_argc, 0) > 0) {
     if (SAFE_ACCESS(args, dart_entrypoint_argv, nullptr) == nullptr) {
       return LOG_EMBEDDER_ERROR(kInvalidArguments,
@@ -2292,17 +2367,50 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
                                 "as dart_entrypoint_argc "
                                 "was set, but dart_entrypoint_argv was null.");
     }
-    std::vector<std::string> arguments(args->dart_entrypoint_argc);
+    dart_entrypoint_args.resize(args->dart_entrypoint_argc);
     for (int i = 0; i < args->dart_entrypoint_argc; ++i) {
-      arguments[i] = std::string{args->dart_entrypoint_argv[i]};
+      dart_entrypoint_args[i] = std::string{args->dart_entrypoint_argv[i]};
     }
-    run_configuration.SetEntrypointArgs(std::move(arguments));
   }
 
-  if (!run_configuration.IsValid()) {
-    return LOG_EMBEDDER_ERROR(
-        kInvalidArguments,
-        "Could not infer the Flutter project to run from given arguments.");
+  auto startup_timeline = std::make_shared<flutter::StartupTimeline>();
+
+  // Inferring the run configuration creates the asset manager, which opens
+  // the asset bundle of the project.
+  auto infer_run_configuration = [settings, startup_timeline,
+                                  dart_entrypoint = std::move(dart_entrypoint),
+                                  dart_entrypoint_args =
+                                      std::move(dart_entrypoint_args)]() {
+    TRACE_EVENT0("flutter", "InferRunConfiguration");
+    flutter::StartupTimeline::ScopedPhase startup_phase(
+        *startup_timeline, flutter::StartupPhase::kAssetManagerSetup);
+    auto run_configuration =
+        flutter::RunConfiguration::InferFromSettings(settings);
+    if (!dart_entrypoint.empty()) {
+      run_configuration.SetEntrypoint(dart_entrypoint);
+    }
+    if (!dart_entrypoint_args.empty()) {
+      run_configuration.SetEntrypointArgs(dart_entrypoint_args);
+    }
+    return run_configuration;
+  };
+
+  std::future<flutter::RunConfiguration> run_configuration;
+  if (settings.enable_parallel_startup) {
+    // Set up the asset manager while the shell is launched. The root isolate
+    // waits for it, so an invalid project is reported when it is launched.
+    run_configuration =
+        std::async(std::launch::async, std::move(infer_run_configuration));
+  } else {
+    auto inferred_run_configuration = infer_run_configuration();
+    if (!inferred_run_configuration.IsValid()) {
+      return LOG_EMBEDDER_ERROR(
+          kInvalidArguments,
+          "Could not infer the Flutter project to run from given arguments.");
+    }
+    std::promise<flutter::RunConfiguration> run_configuration_promise;
+    run_configuration = run_configuration_promise.get_future();
+    run_configuration_promise.set_value(std::move(inferred_run_configuration));
   }
 
   // Create the engine but don't launch the shell or run the root isolate.
@@ -2311,6 +2419,8 @@ FlutterEngineResult FlutterEngineInitialize(size_t version,
       std::move(task_runners),              //
       std::move(settings),                  //
       std::move(run_configuration),         //
+      std::move(startup_timeline),          //
+      spawner,                              //
       on_create_platform_view,              //
       on_create_rasterizer,                 //
       std::move(external_texture_resolver)  //
@@ -2837,8 +2947,25 @@ FlutterEngineResult FlutterEngineSendPlatformMessage(
     response = response_handle->message->response();
   }
 
+  VoidCallback release_callback =
+      SAFE_ACCESS(flutter_message, message_release_callback, nullptr);
+
   std::unique_ptr<flutter::PlatformMessage> message;
-  if (message_size == 0) {
+  if (release_callback != nullptr) {
+    // Take ownership of the buffer instead of copying it. The mapping invokes
+    // the release callback once the message data is no longer referenced.
+    void* release_user_data =
+        SAFE_ACCESS(flutter_message, message_release_user_data, nullptr);
+    message = std::make_unique<flutter::PlatformMessage>(
+        flutter_message->channel,
+        std::make_unique<fml::NonOwnedMapping>(
+            message_data, message_size,
+            [release_callback, release_user_data](const uint8_t* data,
+                                                  size_t size) {
+              release_callback(release_user_data);
+            }),
+        response);
+  } else if (message_size == 0) {
     message = std::make_unique<flutter::PlatformMessage>(
         flutter_message->channel, response);
   } else {
@@ -3503,6 +3630,71 @@ FlutterEngineResult FlutterEngineSetNextFrameCallback(
   return kSuccess;
 }
 
+FlutterEngineResult FlutterEngineGetFramePhaseSummary(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterFramePhase phase,
+    FlutterFramePhaseSummary* summary_out) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+
+  if (static_cast<size_t>(phase) >= kFlutterFramePhaseCount) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                              "Invalid FlutterFramePhase specified.");
+  }
+
+  if (summary_out == nullptr || !STRUCT_HAS_MEMBER(summary_out, max_nanos)) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                              "Invalid FlutterFramePhaseSummary specified.");
+  }
+
+  auto embedder_engine = reinterpret_cast<flutter::EmbedderEngine*>(engine);
+  if (!embedder_engine->IsValid()) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Engine is not running.");
+  }
+
+  flutter::FramePhaseProfiler::Summary summary =
+      embedder_engine->GetShell().GetFramePhaseProfiler()->Summarize(
+          static_cast<flutter::FramePhase>(phase));
+  summary_out->sample_count = summary.sample_count;
+  summary_out->p50_nanos = summary.p50.ToNanoseconds();
+  summary_out->p90_nanos = summary.p90.ToNanoseconds();
+  summary_out->p99_nanos = summary.p99.ToNanoseconds();
+  summary_out->max_nanos = summary.max.ToNanoseconds();
+
+  return kSuccess;
+}
+
+FlutterEngineResult FlutterEngineGetStartupPhaseTiming(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterStartupPhase phase,
+    FlutterStartupPhaseTiming* timing_out) {
+  if (engine == nullptr) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments, "Invalid engine handle.");
+  }
+
+  if (static_cast<size_t>(phase) >= kFlutterStartupPhaseCount) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                              "Invalid FlutterStartupPhase specified.");
+  }
+
+  if (timing_out == nullptr || !STRUCT_HAS_MEMBER(timing_out, end_nanos)) {
+    return LOG_EMBEDDER_ERROR(kInvalidArguments,
+                              "Invalid FlutterStartupPhaseTiming specified.");
+  }
+
+  std::optional<flutter::StartupTimeline::Interval> interval =
+      reinterpret_cast<flutter::EmbedderEngine*>(engine)->GetStartupPhase(
+          static_cast<flutter::StartupPhase>(phase));
+  timing_out->recorded = interval.has_value();
+  timing_out->start_nanos =
+      interval ? interval->start.ToEpochDelta().ToNanoseconds() : 0;
+  timing_out->end_nanos =
+      interval ? interval->end.ToEpochDelta().ToNanoseconds() : 0;
+
+  return kSuccess;
+}
+
 FlutterEngineResult FlutterEngineGetProcAddresses(
     FlutterEngineProcTable* table) {
   if (!table) {
@@ -3557,6 +3749,8 @@ FlutterEngineResult FlutterEngineGetProcAddresses(
   SET_PROC(SetNextFrameCallback, FlutterEngineSetNextFrameCallback);
   SET_PROC(AddView, FlutterEngineAddView);
   SET_PROC(RemoveView, FlutterEngineRemoveView);
+  SET_PROC(GetFramePhaseSummary, FlutterEngineGetFramePhaseSummary);
+  SET_PROC(GetStartupPhaseTiming, FlutterEngineGetStartupPhaseTiming);
 #undef SET_PROC
 
   return kSuccess;
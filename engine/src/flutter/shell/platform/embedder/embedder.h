@@ -877,6 +877,31 @@ typedef struct {
 
 } FlutterVulkanRendererConfig;
 
+/// This information is passed to the embedder when a software surface is
+/// presented.
+///
+/// See: \ref FlutterSoftwareRendererConfig.surface_present_with_info_callback.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterSoftwarePresentInfo).
+  size_t struct_size;
+  /// The buffer to present. The pixel format of the buffer is the native
+  /// 32-bit RGBA format. The buffer is owned by the Flutter engine and must be
+  /// copied in the callback if needed.
+  const void* allocation;
+  /// The number of bytes in a row of the buffer.
+  size_t row_bytes;
+  /// The number of rows in the buffer.
+  size_t height;
+  /// The areas of the buffer that changed since the previous present. The
+  /// pixels outside of these areas are the same as in the previously presented
+  /// buffer. The whole buffer is damaged the first time it is presented.
+  FlutterDamage frame_damage;
+} FlutterSoftwarePresentInfo;
+
+typedef bool (*SoftwareSurfacePresentWithInfoCallback)(
+    void* /* user data */,
+    const FlutterSoftwarePresentInfo* /* present info */);
+
 typedef struct {
   /// The size of this struct. Must be sizeof(FlutterSoftwareRendererConfig).
   size_t struct_size;
@@ -885,6 +910,26 @@ typedef struct {
   /// format. The buffer is owned by the Flutter engine and must be copied in
   /// this callback if needed.
   SoftwareSurfacePresentCallback surface_present_callback;
+  /// The number of threads that rasterize the frame in parallel. If this is
+  /// greater than 1, the frame is split into tiles that are drawn on a pool of
+  /// worker threads, which speeds up large frames on machines without a GPU.
+  /// Otherwise, the whole frame is drawn on the raster thread. Counts above
+  /// the number of hardware threads are clamped to it.
+  ///
+  /// Not used if a FlutterCompositor is supplied in FlutterProjectArgs.
+  size_t raster_worker_count;
+  /// The callback presented to the embedder to present a buffer along with the
+  /// areas of it that changed since the previous present. If specified, this
+  /// callback is used instead of surface_present_callback, which then becomes
+  /// optional.
+  ///
+  /// The engine keeps rendering into the same buffer while its size doesn't
+  /// change, and only renders the areas of the screen that changed in between
+  /// frames. Embedders that send frames over the network or copy them can use
+  /// the damage to only process those areas.
+  ///
+  /// Not used if a FlutterCompositor is supplied in FlutterProjectArgs.
+  SoftwareSurfacePresentWithInfoCallback surface_present_with_info_callback;
 } FlutterSoftwareRendererConfig;
 
 typedef struct {
@@ -1236,6 +1281,19 @@ typedef struct {
   /// `FlutterEngineSendPlatformMessageResponse` will cause a memory leak. It is
   /// not safe to send multiple responses on a single response object.
   const FlutterPlatformMessageResponseHandle* response_handle;
+  /// An optional callback that releases the `message` buffer. When specified
+  /// in a message sent to the engine via `FlutterEngineSendPlatformMessage`,
+  /// the engine takes ownership of the buffer instead of copying it. Large
+  /// buffers are handed to the Dart application as an unmodifiable `ByteData`
+  /// backed by the buffer. Responses are always copied. The embedder must not
+  /// modify or free the buffer until the callback is invoked. Unless
+  /// `FlutterEngineSendPlatformMessage` returns `kInvalidArguments`, the
+  /// callback is invoked exactly once, on an arbitrary thread, when the engine
+  /// no longer needs the buffer. It is never set on messages sent by the
+  /// engine to the embedder.
+  VoidCallback message_release_callback;
+  /// The user data passed to `message_release_callback`.
+  void* message_release_user_data;
 } FlutterPlatformMessage;
 
 typedef void (*FlutterPlatformMessageCallback)(
@@ -2076,6 +2134,76 @@ typedef enum {
   kFlutterEngineDisplaysUpdateTypeCount,
 } FlutterEngineDisplaysUpdateType;
 
+/// The steps of producing frames whose durations are recorded by the engine.
+/// See `FlutterEngineGetFramePhaseSummary`.
+typedef enum {
+  /// Acquiring the surface frame to render into.
+  kFlutterFramePhaseAcquireFrame,
+  /// Prerolling the layer tree.
+  kFlutterFramePhasePreroll,
+  /// Rendering layers and display lists into the raster cache.
+  kFlutterFramePhaseRasterCache,
+  /// Painting the layer tree. With Impeller, this includes converting display
+  /// lists into Impeller commands.
+  kFlutterFramePhasePaint,
+  /// Submitting the frame, which includes encoding the command buffers and
+  /// presenting the surface.
+  kFlutterFramePhaseSubmit,
+  /// Uploading decoded images to the GPU.
+  kFlutterFramePhaseImageUpload,
+  kFlutterFramePhaseCount,
+} FlutterFramePhase;
+
+/// Percentiles of the recent durations of a `FlutterFramePhase`, in
+/// nanoseconds.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterFramePhaseSummary).
+  size_t struct_size;
+  /// The number of recent samples the percentiles were computed from. The
+  /// durations are zero if there are none.
+  size_t sample_count;
+  uint64_t p50_nanos;
+  uint64_t p90_nanos;
+  uint64_t p99_nanos;
+  uint64_t max_nanos;
+} FlutterFramePhaseSummary;
+
+/// The steps of starting an engine whose start and end times are recorded by
+/// the engine. Some of them overlap, as they run on different threads. See
+/// `FlutterEngineGetStartupPhaseTiming`.
+typedef enum {
+  /// Creating or attaching to the Dart VM.
+  kFlutterStartupPhaseVMInitialization,
+  /// Creating the asset manager of the project. With
+  /// `--enable-parallel-startup` this overlaps with the following phases.
+  kFlutterStartupPhaseAssetManagerSetup,
+  /// Creating the platform view on the platform thread.
+  kFlutterStartupPhasePlatformViewSetup,
+  /// Creating the rasterizer on the raster thread.
+  kFlutterStartupPhaseRasterizerSetup,
+  /// Creating the IO manager and its resource context on the IO thread.
+  kFlutterStartupPhaseIOManagerSetup,
+  /// Creating the engine on the UI thread.
+  kFlutterStartupPhaseEngineSetup,
+  /// Setting up the default font manager. With `--enable-parallel-startup`
+  /// this runs on a worker thread.
+  kFlutterStartupPhaseFontManagerSetup,
+  /// Launching the root isolate and running its entrypoint.
+  kFlutterStartupPhaseRootIsolateLaunch,
+  kFlutterStartupPhaseCount,
+} FlutterStartupPhase;
+
+/// When a `FlutterStartupPhase` ran, in nanoseconds of the clock of
+/// `FlutterEngineGetCurrentTime`.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterStartupPhaseTiming).
+  size_t struct_size;
+  /// Whether the phase has finished. The times are zero if it hasn't.
+  bool recorded;
+  uint64_t start_nanos;
+  uint64_t end_nanos;
+} FlutterStartupPhaseTiming;
+
 typedef int64_t FlutterEngineDartPort;
 
 typedef enum {
@@ -2200,6 +2328,27 @@ typedef void (*FlutterLogMessageCallback)(const char* /* tag */,
                                           const char* /* message */,
                                           void* /* user_data */);
 
+/// When the steps of producing a frame ran, in nanoseconds on the clock of
+/// `FlutterEngineGetCurrentTime`.
+typedef struct {
+  /// The size of this struct. Must be sizeof(FlutterFrameTiming).
+  size_t struct_size;
+  /// The number of the frame, as counted by the engine.
+  uint64_t frame_number;
+  uint64_t vsync_start_nanos;
+  uint64_t build_start_nanos;
+  uint64_t build_finish_nanos;
+  uint64_t raster_start_nanos;
+  uint64_t raster_finish_nanos;
+} FlutterFrameTiming;
+
+// Callback for the timing of a frame that was rasterized. `timing` is only
+// valid for the duration of the call. `user_data` is a user data baton passed
+// in `FlutterEngineRun`.
+typedef void (*FlutterFrameRasterizedCallback)(
+    const FlutterFrameTiming* /* timing */,
+    void* /* user_data */);
+
 /// An opaque object that describes the AOT data that can be used to launch a
 /// FlutterEngine instance in AOT mode.
 typedef struct _FlutterEngineAOTData* FlutterEngineAOTData;
@@ -2503,6 +2652,34 @@ typedef struct {
   /// being registered on the framework side. The callback is invoked from
   /// a task posted to the platform thread.
   FlutterChannelUpdateCallback channel_update_callback;
+
+  /// A running engine to spawn this engine from. This is optional.
+  ///
+  /// A spawned engine runs in the same Dart isolate group as its spawner and
+  /// shares its threads, IO manager, resource context, font collection and
+  /// image decoders, so it starts faster and takes much less memory than an
+  /// engine that is run on its own. Embedders that show many views from
+  /// separate engines can keep a pool of engines spawned ahead of time and
+  /// hand them out as views are shown.
+  ///
+  /// The renderer config, the entrypoint, its arguments and the callbacks of
+  /// the platform view, like `platform_message_callback`, are taken from these
+  /// arguments. The other settings, like the assets path, the snapshots and
+  /// the isolate and log callbacks, are inherited from the spawner.
+  ///
+  /// The spawner must be alive until `FlutterEngineRun` or
+  /// `FlutterEngineRunInitialized` returns, which must be called on the
+  /// platform thread of the spawner. `custom_task_runners` must be null.
+  FLUTTER_API_SYMBOL(FlutterEngine) spawner;
+
+  /// A callback that is invoked with the timing of each frame after it has
+  /// been rasterized. This is optional.
+  ///
+  /// The callback is invoked on the raster thread, so it must not block.
+  /// Together with `FlutterEngineGetFramePhaseSummary`, it lets embedders
+  /// monitor frame times without tracing. Engines spawned from this engine
+  /// inherit the callback.
+  FlutterFrameRasterizedCallback frame_rasterized_callback;
 } FlutterProjectArgs;
 
 #ifndef FLUTTER_ENGINE_NO_PROTOTYPES
@@ -3255,6 +3432,49 @@ FlutterEngineResult FlutterEngineSetNextFrameCallback(
     VoidCallback callback,
     void* user_data);
 
+//------------------------------------------------------------------------------
+/// @brief      Summarizes the durations of a frame phase recorded by the
+///             engine. This profiler is always enabled and does not require
+///             tracing. Each engine has its own profiler, which keeps the most
+///             recent samples of each thread that worked on the frames of the
+///             engine.
+///
+///             Can be called from any thread.
+///
+/// @param[in]  engine       A running engine instance.
+/// @param[in]  phase        The phase to summarize.
+/// @param[out] summary_out  The summary of the phase. Its `struct_size` must
+///                          be set by the caller.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineGetFramePhaseSummary(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterFramePhase phase,
+    FlutterFramePhaseSummary* summary_out);
+
+//------------------------------------------------------------------------------
+/// @brief      Gets when a phase of starting the engine ran. The phases are
+///             recorded while `FlutterEngineRun` or
+///             `FlutterEngineRunInitialized` starts the engine, and the last
+///             ones may finish after these calls return.
+///
+///             Can be called from any thread once the engine is running.
+///
+/// @param[in]  engine      An engine instance.
+/// @param[in]  phase       The phase to get the timing of.
+/// @param[out] timing_out  The timing of the phase. Its `struct_size` must be
+///                         set by the caller.
+///
+/// @return     The result of the call.
+///
+FLUTTER_EXPORT
+FlutterEngineResult FlutterEngineGetStartupPhaseTiming(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterStartupPhase phase,
+    FlutterStartupPhaseTiming* timing_out);
+
 #endif  // !FLUTTER_ENGINE_NO_PROTOTYPES
 
 // Typedefs for the function pointers in FlutterEngineProcTable.
@@ -3383,6 +3603,14 @@ typedef FlutterEngineResult (*FlutterEngineAddViewFnPtr)(
 typedef FlutterEngineResult (*FlutterEngineRemoveViewFnPtr)(
     FLUTTER_API_SYMBOL(FlutterEngine) engine,
     const FlutterRemoveViewInfo* info);
+typedef FlutterEngineResult (*FlutterEngineGetFramePhaseSummaryFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterFramePhase phase,
+    FlutterFramePhaseSummary* summary_out);
+typedef FlutterEngineResult (*FlutterEngineGetStartupPhaseTimingFnPtr)(
+    FLUTTER_API_SYMBOL(FlutterEngine) engine,
+    FlutterStartupPhase phase,
+    FlutterStartupPhaseTiming* timing_out);
 
 /// Function-pointer-based versions of the APIs above.
 typedef struct {
@@ -3431,6 +3659,8 @@ typedef struct {
   FlutterEngineSetNextFrameCallbackFnPtr SetNextFrameCallback;
   FlutterEngineAddViewFnPtr AddView;
   FlutterEngineRemoveViewFnPtr RemoveView;
+  FlutterEngineGetFramePhaseSummaryFnPtr GetFramePhaseSummary;
+  FlutterEngineGetStartupPhaseTimingFnPtr GetStartupPhaseTiming;
 } FlutterEngineProcTable;
 
 //------------------------------------------------------------------------------
@@ -22,16 +22,20 @@ struct ShellArgs {
 };
 
 EmbedderEngine::EmbedderEngine(
-    std::unique_ptr<EmbedderThreadHost> thread_host,
+    std::shared_ptr<EmbedderThreadHost> thread_host,
     const flutter::TaskRunners& task_runners,
     const flutter::Settings& settings,
-    RunConfiguration run_configuration,
+    std::future<RunConfiguration> run_configuration,
+    std::shared_ptr<StartupTimeline> startup_timeline,
+    EmbedderEngine* spawner,
     const Shell::CreateCallback<PlatformView>& on_create_platform_view,
     const Shell::CreateCallback<Rasterizer>& on_create_rasterizer,
     std::unique_ptr<EmbedderExternalTextureResolver> external_texture_resolver)
     : thread_host_(std::move(thread_host)),
       task_runners_(task_runners),
       run_configuration_(std::move(run_configuration)),
+      startup_timeline_(std::move(startup_timeline)),
+      spawner_(spawner),
       shell_args_(std::make_unique<ShellArgs>(settings,
                                               on_create_platform_view,
                                               on_create_rasterizer)),
@@ -49,9 +53,23 @@ bool EmbedderEngine::LaunchShell() {
     FML_DLOG(ERROR) << "Shell already initialized";
   }
 
-  shell_ = Shell::Create(
-      flutter::PlatformData(), task_runners_, shell_args_->settings,
-      shell_args_->on_create_platform_view, shell_args_->on_create_rasterizer);
+  if (spawner_) {
+    // A spawned shell launches its root isolate as soon as it is created.
+    is_spawned_ = true;
+    RunConfiguration run_configuration = run_configuration_.get();
+    if (spawner_->IsValid() && run_configuration.IsValid()) {
+      shell_ = spawner_->GetShell().Spawn(std::move(run_configuration),
+                                          /*initial_route=*/"",
+                                          shell_args_->on_create_platform_view,
+                                          shell_args_->on_create_rasterizer);
+    }
+    spawner_ = nullptr;
+  } else {
+    shell_ = Shell::Create(flutter::PlatformData(), task_runners_,
+                           shell_args_->settings,
+                           shell_args_->on_create_platform_view,
+                           shell_args_->on_create_rasterizer);
+  }
 
   // Reset the args no matter what. They will never be used to initialize a
   // shell again.
@@ -66,10 +84,19 @@ bool EmbedderEngine::CollectShell() {
 }
 
 bool EmbedderEngine::RunRootIsolate() {
-  if (!IsValid() || !run_configuration_.IsValid()) {
+  if (is_spawned_) {
+    return IsValid();
+  }
+  if (!IsValid() || !run_configuration_.valid()) {
     return false;
   }
-  shell_->RunEngine(std::move(run_configuration_));
+  RunConfiguration run_configuration = run_configuration_.get();
+  if (!run_configuration.IsValid()) {
+    FML_LOG(ERROR)
+        << "Could not infer the Flutter project to run from given arguments.";
+    return false;
+  }
+  shell_->RunEngine(std::move(run_configuration));
   return true;
 }
 
@@ -81,6 +108,11 @@ const TaskRunners& EmbedderEngine::GetTaskRunners() const {
   return task_runners_;
 }
 
+const std::shared_ptr<EmbedderThreadHost>& EmbedderEngine::GetThreadHost()
+    const {
+  return thread_host_;
+}
+
 bool EmbedderEngine::NotifyCreated() {
   if (!IsValid()) {
     return false;
@@ -294,4 +326,14 @@ Shell& EmbedderEngine::GetShell() {
   return *shell_.get();
 }
 
+std::optional<StartupTimeline::Interval> EmbedderEngine::GetStartupPhase(
+    StartupPhase phase) const {
+  std::optional<StartupTimeline::Interval> interval =
+      startup_timeline_->GetPhase(phase);
+  if (!interval.has_value() && shell_) {
+    interval = shell_->GetStartupTimeline()->GetPhase(phase);
+  }
+  return interval;
+}
+
 }  // namespace flutter
@@ -5,11 +5,14 @@
 #ifndef FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_ENGINE_H_
 #define FLUTTER_SHELL_PLATFORM_EMBEDDER_EMBEDDER_ENGINE_H_
 
+#include <future>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 
 #include "flutter/fml/macros.h"
 #include "flutter/shell/common/shell.h"
+#include "flutter/shell/common/startup_timeline.h"
 #include "flutter/shell/common/thread_host.h"
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/embedder/embedder_external_texture_resolver.h"
@@ -23,10 +26,12 @@ struct ShellArgs;
 class EmbedderEngine {
  public:
   EmbedderEngine(
-      std::unique_ptr<EmbedderThreadHost> thread_host,
+      std::shared_ptr<EmbedderThreadHost> thread_host,
       const TaskRunners& task_runners,
       const Settings& settings,
-      RunConfiguration run_configuration,
+      std::future<RunConfiguration> run_configuration,
+      std::shared_ptr<StartupTimeline> startup_timeline,
+      EmbedderEngine* spawner,
       const Shell::CreateCallback<PlatformView>& on_create_platform_view,
       const Shell::CreateCallback<Rasterizer>& on_create_rasterizer,
       std::unique_ptr<EmbedderExternalTextureResolver>
@@ -40,6 +45,8 @@ class EmbedderEngine {
 
   const TaskRunners& GetTaskRunners() const;
 
+  const std::shared_ptr<EmbedderThreadHost>& GetThreadHost() const;
+
   bool NotifyCreated();
 
   bool NotifyDestroyed();
@@ -87,10 +94,22 @@ class EmbedderEngine {
 
   Shell& GetShell();
 
+  // Returns when |phase| of starting this engine ran, whether it ran before
+  // the shell was launched or as part of launching it.
+  std::optional<StartupTimeline::Interval> GetStartupPhase(
+      StartupPhase phase) const;
+
  private:
-  const std::unique_ptr<EmbedderThreadHost> thread_host_;
+  // Shared with the engines spawned from this one.
+  const std::shared_ptr<EmbedderThreadHost> thread_host_;
   TaskRunners task_runners_;
-  RunConfiguration run_configuration_;
+  // Becomes ready once the asset manager has been set up, which may still be
+  // happening on another thread while the shell is launched.
+  std::future<RunConfiguration> run_configuration_;
+  std::shared_ptr<StartupTimeline> startup_timeline_;
+  // The engine this engine is spawned from, until the shell is launched.
+  EmbedderEngine* spawner_;
+  bool is_spawned_ = false;
   std::unique_ptr<ShellArgs> shell_args_;
   std::unique_ptr<Shell> shell_;
   std::unique_ptr<EmbedderExternalTextureResolver> external_texture_resolver_;
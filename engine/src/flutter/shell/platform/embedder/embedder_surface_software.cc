@@ -39,7 +39,8 @@ std::unique_ptr<Surface> EmbedderSurfaceSoftware::CreateGPUSurface() {
     return nullptr;
   }
   const bool render_to_surface = !external_view_embedder_;
-  auto surface = std::make_unique<GPUSurfaceSoftware>(this, render_to_surface);
+  auto surface = std::make_unique<GPUSurfaceSoftware>(
+      this, render_to_surface, software_dispatch_table_.raster_worker_count);
 
   if (!surface->IsValid()) {
     return nullptr;
@@ -84,6 +85,15 @@ sk_sp<SkSurface> EmbedderSurfaceSoftware::AcquireBackingStore(
 // |GPUSurfaceSoftwareDelegate|
 bool EmbedderSurfaceSoftware::PresentBackingStore(
     sk_sp<SkSurface> backing_store) {
+  const SkIRect damage =
+      SkIRect::MakeWH(backing_store->width(), backing_store->height());
+  return PresentBackingStoreWithDamage(std::move(backing_store), damage);
+}
+
+// |GPUSurfaceSoftwareDelegate|
+bool EmbedderSurfaceSoftware::PresentBackingStoreWithDamage(
+    sk_sp<SkSurface> backing_store,
+    const SkIRect& damage) {
   if (!IsValid()) {
     FML_LOG(ERROR) << "Tried to present an invalid software surface.";
     return false;
@@ -108,8 +118,16 @@ bool EmbedderSurfaceSoftware::PresentBackingStore(
   return software_dispatch_table_.software_present_backing_store(
       pixmap.addr(),      //
       pixmap.rowBytes(),  //
-      pixmap.height()     //
+      pixmap.height(),    //
+      damage              //
   );
 }
 
+// |GPUSurfaceSoftwareDelegate|
+bool EmbedderSurfaceSoftware::SupportsPartialRepaint() const {
+  // The backing store is only replaced when the size of the frame changes,
+  // and the embedder can't write to it.
+  return true;
+}
+
 }  // namespace flutter
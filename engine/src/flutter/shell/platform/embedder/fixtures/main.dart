@@ -400,6 +400,22 @@ void platform_messages_response() {
   signalNativeTest();
 }
 
+@pragma('vm:entry-point')
+// ignore: non_constant_identifier_names
+void platform_messages_unmodifiable_response() {
+  PlatformDispatcher.instance.onPlatformMessage =
+      (String name, ByteData? data, PlatformMessageResponseCallback? callback) {
+    try {
+      data!.setUint8(0, 0);
+      signalNativeMessage('modifiable');
+    } on UnsupportedError {
+      signalNativeMessage('unmodifiable');
+    }
+    callback!(data);
+  };
+  signalNativeTest();
+}
+
 @pragma('vm:entry-point')
 // ignore: non_constant_identifier_names
 void platform_messages_no_response() {
@@ -4,6 +4,8 @@
 
 #define FML_USED_ON_EMBEDDER
 
+#include <atomic>
+#include <cstring>
 #include <string>
 #include <utility>
 #include <vector>
@@ -76,6 +78,48 @@ TEST_F(EmbedderTest, CanLaunchAndShutdownWithValidProjectArgs) {
   engine.reset();
 }
 
+TEST_F(EmbedderTest, RecordsStartupPhasesWithParallelStartup) {
+  auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
+  static fml::AutoResetWaitableEvent latch;
+  Dart_NativeFunction entrypoint = [](Dart_NativeArguments args) {
+    latch.Signal();
+  };
+  context.AddNativeCallback("SayHiFromCustomEntrypoint", entrypoint);
+  EmbedderConfigBuilder builder(context);
+  builder.SetSoftwareRendererConfig();
+  builder.SetDartEntrypoint("customEntrypoint");
+  builder.AddCommandLineArgument("--enable-parallel-startup");
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+  latch.Wait();
+
+  // All phases but launching the root isolate finish before the entrypoint
+  // runs.
+  for (FlutterStartupPhase phase : {
+           kFlutterStartupPhaseVMInitialization,
+           kFlutterStartupPhaseAssetManagerSetup,
+           kFlutterStartupPhasePlatformViewSetup,
+           kFlutterStartupPhaseRasterizerSetup,
+           kFlutterStartupPhaseIOManagerSetup,
+           kFlutterStartupPhaseEngineSetup,
+           kFlutterStartupPhaseFontManagerSetup,
+       }) {
+    FlutterStartupPhaseTiming timing = {};
+    timing.struct_size = sizeof(timing);
+    ASSERT_EQ(FlutterEngineGetStartupPhaseTiming(engine.get(), phase, &timing),
+              kSuccess);
+    EXPECT_TRUE(timing.recorded) << "phase " << phase;
+    EXPECT_LE(timing.start_nanos, timing.end_nanos) << "phase " << phase;
+    EXPECT_LE(timing.end_nanos, FlutterEngineGetCurrentTime());
+  }
+
+  FlutterStartupPhaseTiming timing = {};
+  timing.struct_size = sizeof(timing);
+  EXPECT_EQ(FlutterEngineGetStartupPhaseTiming(
+                engine.get(), kFlutterStartupPhaseCount, &timing),
+            kInvalidArguments);
+}
+
 // TODO(41999): Disabled because flaky.
 TEST_F(EmbedderTest, DISABLED_CanLaunchAndShutdownMultipleTimes) {
   EmbedderConfigBuilder builder(
@@ -103,6 +147,76 @@ TEST_F(EmbedderTest, CanInvokeCustomEntrypoint) {
   ASSERT_TRUE(engine.is_valid());
 }
 
+TEST_F(EmbedderTest, CanSpawnEngineFromRunningEngine) {
+  auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
+  static fml::AutoResetWaitableEvent latch;
+  Dart_NativeFunction entrypoint = [](Dart_NativeArguments args) {
+    latch.Signal();
+  };
+  context.AddNativeCallback("SayHiFromCustomEntrypoint", entrypoint);
+
+  EmbedderConfigBuilder builder(context);
+  builder.SetSoftwareRendererConfig();
+  builder.SetDartEntrypoint("customEntrypoint");
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+  latch.Wait();
+
+  EmbedderConfigBuilder spawned_builder(context);
+  spawned_builder.SetSoftwareRendererConfig();
+  spawned_builder.SetDartEntrypoint("draw_solid_red");
+  spawned_builder.GetProjectArgs().spawner = engine.get();
+  auto spawned_engine = spawned_builder.LaunchEngine();
+  ASSERT_TRUE(spawned_engine.is_valid());
+
+  flutter::Shell& shell = ToEmbedderEngine(engine.get())->GetShell();
+  flutter::Shell& spawned_shell =
+      ToEmbedderEngine(spawned_engine.get())->GetShell();
+  EXPECT_EQ(shell.GetDartVM(), spawned_shell.GetDartVM());
+  EXPECT_EQ(shell.GetTaskRunners().GetUITaskRunner(),
+            spawned_shell.GetTaskRunners().GetUITaskRunner());
+  EXPECT_EQ(shell.GetTaskRunners().GetRasterTaskRunner(),
+            spawned_shell.GetTaskRunners().GetRasterTaskRunner());
+
+  // The spawned engine keeps rendering frames without its spawner.
+  engine.reset();
+  fml::AutoResetWaitableEvent frame_latch;
+  ASSERT_EQ(FlutterEngineSetNextFrameCallback(
+                spawned_engine.get(),
+                [](void* user_data) {
+                  static_cast<fml::AutoResetWaitableEvent*>(user_data)
+                      ->Signal();
+                },
+                &frame_latch),
+            kSuccess);
+  FlutterWindowMetricsEvent event = {};
+  event.struct_size = sizeof(event);
+  event.width = 800;
+  event.height = 600;
+  event.pixel_ratio = 1.0;
+  ASSERT_EQ(FlutterEngineSendWindowMetricsEvent(spawned_engine.get(), &event),
+            kSuccess);
+  frame_latch.Wait();
+}
+
+TEST_F(EmbedderTest, SpawnedEngineCannotSpecifyCustomTaskRunners) {
+  auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
+  EmbedderConfigBuilder builder(context);
+  builder.SetSoftwareRendererConfig();
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+
+  EmbedderTestTaskRunner runner(CreateNewThread("spawned_platform_thread"),
+                                [](FlutterTask) {});
+  const auto runner_description = runner.GetFlutterTaskRunnerDescription();
+  EmbedderConfigBuilder spawned_builder(context);
+  spawned_builder.SetSoftwareRendererConfig();
+  spawned_builder.SetPlatformTaskRunner(&runner_description);
+  spawned_builder.GetProjectArgs().spawner = engine.get();
+  auto spawned_engine = spawned_builder.LaunchEngine();
+  EXPECT_FALSE(spawned_engine.is_valid());
+}
+
 TEST_F(EmbedderTest, CanInvokeCustomEntrypointMacro) {
   auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
 
@@ -417,6 +531,147 @@ TEST_F(EmbedderTest, PlatformMessagesCanReceiveResponse) {
   captures.latch.Wait();
 }
 
+//------------------------------------------------------------------------------
+/// Tests that a large platform message handed over with a release callback
+/// reaches Dart without being copied, cannot be modified by Dart, and is
+/// released once Dart no longer references it.
+///
+TEST_F(EmbedderTest, PlatformMessagesWithReleaseCallbacksAreNotCopied) {
+  struct Captures {
+    std::vector<uint8_t> buffer = std::vector<uint8_t>(64 * 1024, 0x2A);
+    fml::AutoResetWaitableEvent response_latch;
+    std::atomic<int> release_count = 0;
+  };
+  Captures captures;
+
+  auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
+  EmbedderConfigBuilder builder(context);
+  builder.SetSoftwareRendererConfig();
+  builder.SetDartEntrypoint("platform_messages_unmodifiable_response");
+
+  fml::AutoResetWaitableEvent ready;
+  context.AddNativeCallback(
+      "SignalNativeTest",
+      CREATE_NATIVE_ENTRY(
+          [&ready](Dart_NativeArguments args) { ready.Signal(); }));
+  fml::AutoResetWaitableEvent modified_checked;
+  context.AddNativeCallback(
+      "SignalNativeMessage",
+      CREATE_NATIVE_ENTRY(([&modified_checked](Dart_NativeArguments args) {
+        auto received_message = tonic::DartConverter<std::string>::FromDart(
+            Dart_GetNativeArgument(args, 0));
+        EXPECT_EQ(received_message, "unmodifiable");
+        modified_checked.Signal();
+      })));
+
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+
+  FlutterPlatformMessageResponseHandle* response_handle = nullptr;
+  auto response_callback = [](const uint8_t* data, size_t size,
+                              void* user_data) {
+    auto captures = reinterpret_cast<Captures*>(user_data);
+    ASSERT_EQ(size, captures->buffer.size());
+    EXPECT_EQ(std::memcmp(data, captures->buffer.data(), size), 0);
+    captures->response_latch.Signal();
+  };
+  ASSERT_EQ(FlutterPlatformMessageCreateResponseHandle(
+                engine.get(), response_callback, &captures, &response_handle),
+            kSuccess);
+
+  FlutterPlatformMessage message = {};
+  message.struct_size = sizeof(FlutterPlatformMessage);
+  message.channel = "test_channel";
+  message.message = captures.buffer.data();
+  message.message_size = captures.buffer.size();
+  message.response_handle = response_handle;
+  message.message_release_callback = [](void* user_data) {
+    reinterpret_cast<Captures*>(user_data)->release_count++;
+  };
+  message.message_release_user_data = &captures;
+
+  ready.Wait();
+  ASSERT_EQ(FlutterEngineSendPlatformMessage(engine.get(), &message),
+            kSuccess);
+  ASSERT_EQ(
+      FlutterPlatformMessageReleaseResponseHandle(engine.get(), response_handle),
+      kSuccess);
+  modified_checked.Wait();
+  captures.response_latch.Wait();
+
+  // The buffer is released once the Dart object referencing it is finalized,
+  // which happens at the latest when the isolate shuts down.
+  engine.reset();
+  ASSERT_EQ(captures.release_count, 1);
+}
+
+//------------------------------------------------------------------------------
+/// Tests that a large platform message that the engine copied reaches Dart as
+/// a ByteData that Dart may write to, like a small one.
+///
+TEST_F(EmbedderTest, LargeCopiedPlatformMessagesAreModifiable) {
+  struct Captures {
+    std::vector<uint8_t> buffer = std::vector<uint8_t>(64 * 1024, 0x2A);
+    fml::AutoResetWaitableEvent response_latch;
+  };
+  Captures captures;
+
+  auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
+  EmbedderConfigBuilder builder(context);
+  builder.SetSoftwareRendererConfig();
+  builder.SetDartEntrypoint("platform_messages_unmodifiable_response");
+
+  fml::AutoResetWaitableEvent ready;
+  context.AddNativeCallback(
+      "SignalNativeTest",
+      CREATE_NATIVE_ENTRY(
+          [&ready](Dart_NativeArguments args) { ready.Signal(); }));
+  fml::AutoResetWaitableEvent modified_checked;
+  context.AddNativeCallback(
+      "SignalNativeMessage",
+      CREATE_NATIVE_ENTRY(([&modified_checked](Dart_NativeArguments args) {
+        auto received_message = tonic::DartConverter<std::string>::FromDart(
+            Dart_GetNativeArgument(args, 0));
+        EXPECT_EQ(received_message, "modifiable");
+        modified_checked.Signal();
+      })));
+
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+
+  FlutterPlatformMessageResponseHandle* response_handle = nullptr;
+  auto response_callback = [](const uint8_t* data, size_t size,
+                              void* user_data) {
+    auto captures = reinterpret_cast<Captures*>(user_data);
+    ASSERT_EQ(size, captures->buffer.size());
+    // Dart cleared the first byte of its ByteData before echoing it.
+    EXPECT_EQ(data[0], 0);
+    EXPECT_EQ(std::memcmp(data + 1, captures->buffer.data() + 1, size - 1), 0);
+    captures->response_latch.Signal();
+  };
+  ASSERT_EQ(FlutterPlatformMessageCreateResponseHandle(
+                engine.get(), response_callback, &captures, &response_handle),
+            kSuccess);
+
+  FlutterPlatformMessage message = {};
+  message.struct_size = sizeof(FlutterPlatformMessage);
+  message.channel = "test_channel";
+  message.message = captures.buffer.data();
+  message.message_size = captures.buffer.size();
+  message.response_handle = response_handle;
+
+  ready.Wait();
+  ASSERT_EQ(FlutterEngineSendPlatformMessage(engine.get(), &message),
+            kSuccess);
+  ASSERT_EQ(
+      FlutterPlatformMessageReleaseResponseHandle(engine.get(), response_handle),
+      kSuccess);
+  modified_checked.Wait();
+  captures.response_latch.Wait();
+  // The engine copied the message, so the embedder's buffer is untouched.
+  EXPECT_EQ(captures.buffer[0], 0x2A);
+}
+
 //------------------------------------------------------------------------------
 /// Tests that a platform message can be sent with no response handle. Instead
 /// of the platform message integrity checked via a response handle, a native
@@ -641,6 +896,56 @@ TEST_F(EmbedderTest, VMAndIsolateSnapshotSizesAreRedundantInAOTMode) {
   ASSERT_TRUE(engine.is_valid());
 }
 
+TEST_F(EmbedderTest, SoftwarePresentInfoReceivesFrameDamage) {
+  auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
+
+  EmbedderConfigBuilder builder(context);
+  builder.SetSoftwareRendererConfig(SkISize::Make(800, 600));
+  builder.SetDartEntrypoint("render_gradient_retained");
+
+  static fml::AutoResetWaitableEvent latch;
+  static FlutterRect frame_damage;
+  builder.GetRendererConfig().software.surface_present_with_info_callback =
+      [](void* user_data, const FlutterSoftwarePresentInfo* present_info) {
+        EXPECT_EQ(present_info->row_bytes, 800u * 4);
+        EXPECT_EQ(present_info->height, 600u);
+        EXPECT_EQ(present_info->frame_damage.num_rects, 1u);
+        frame_damage = present_info->frame_damage.damage[0];
+        latch.Signal();
+        return true;
+      };
+
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+
+  // Send a window metrics events so frames may be scheduled.
+  FlutterWindowMetricsEvent event = {};
+  event.struct_size = sizeof(event);
+  event.width = 800;
+  event.height = 600;
+  event.pixel_ratio = 1.0;
+  ASSERT_EQ(FlutterEngineSendWindowMetricsEvent(engine.get(), &event),
+            kSuccess);
+  latch.Wait();
+
+  // The first frame is rendered into a new buffer, so all of it is damaged.
+  EXPECT_EQ(frame_damage.left, 0);
+  EXPECT_EQ(frame_damage.top, 0);
+  EXPECT_EQ(frame_damage.right, 800);
+  EXPECT_EQ(frame_damage.bottom, 600);
+
+  // The second frame is the same as the first one and is rendered into the
+  // same buffer, so nothing is damaged.
+  ASSERT_EQ(FlutterEngineSendWindowMetricsEvent(engine.get(), &event),
+            kSuccess);
+  latch.Wait();
+
+  EXPECT_EQ(frame_damage.left, 0);
+  EXPECT_EQ(frame_damage.top, 0);
+  EXPECT_EQ(frame_damage.right, 0);
+  EXPECT_EQ(frame_damage.bottom, 0);
+}
+
 TEST_F(EmbedderTest, CanRenderImplicitView) {
   auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
 
@@ -3429,6 +3734,54 @@ TEST_F(EmbedderTest, CanSetNextFrameCallback) {
   callback_latch.Wait();
 }
 
+TEST_F(EmbedderTest, ReportsFrameTimingsAndPhasesOfTheEngine) {
+  auto& context = GetEmbedderContext(EmbedderTestContextType::kSoftwareContext);
+  EmbedderConfigBuilder builder(context);
+  builder.SetSoftwareRendererConfig();
+  builder.SetDartEntrypoint("draw_solid_red");
+
+  static fml::AutoResetWaitableEvent frame_latch;
+  static FlutterFrameTiming frame_timing = {};
+  builder.GetProjectArgs().frame_rasterized_callback =
+      [](const FlutterFrameTiming* timing, void* user_data) {
+        frame_timing = *timing;
+        frame_latch.Signal();
+      };
+
+  auto engine = builder.LaunchEngine();
+  ASSERT_TRUE(engine.is_valid());
+
+  FlutterFramePhaseSummary summary = {};
+  summary.struct_size = sizeof(summary);
+  ASSERT_EQ(FlutterEngineGetFramePhaseSummary(
+                engine.get(), kFlutterFramePhasePaint, &summary),
+            kSuccess);
+  EXPECT_EQ(summary.sample_count, 0u);
+
+  FlutterWindowMetricsEvent event = {};
+  event.struct_size = sizeof(event);
+  event.width = 800;
+  event.height = 600;
+  event.pixel_ratio = 1.0;
+  ASSERT_EQ(FlutterEngineSendWindowMetricsEvent(engine.get(), &event),
+            kSuccess);
+  frame_latch.Wait();
+
+  EXPECT_EQ(frame_timing.struct_size, sizeof(FlutterFrameTiming));
+  EXPECT_LE(frame_timing.build_start_nanos, frame_timing.build_finish_nanos);
+  EXPECT_LE(frame_timing.build_finish_nanos, frame_timing.raster_start_nanos);
+  EXPECT_LE(frame_timing.raster_start_nanos,
+            frame_timing.raster_finish_nanos);
+  EXPECT_LE(frame_timing.raster_finish_nanos, FlutterEngineGetCurrentTime());
+
+  // The frame was painted before its timing was reported.
+  ASSERT_EQ(FlutterEngineGetFramePhaseSummary(
+                engine.get(), kFlutterFramePhasePaint, &summary),
+            kSuccess);
+  EXPECT_GT(summary.sample_count, 0u);
+  EXPECT_LE(summary.p50_nanos, summary.max_nanos);
+}
+
 #if defined(FML_OS_MACOSX)
 
 static void MockThreadConfigSetter(const fml::Thread::ThreadConfig& config) {
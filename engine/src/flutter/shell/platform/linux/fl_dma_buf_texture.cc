@@ -0,0 +1,469 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/linux/public/flutter_linux/fl_dma_buf_texture.h"
+
+#include <epoxy/egl.h>
+#include <epoxy/gl.h>
+#include <gmodule.h>
+#include <linux/dma-buf.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "flutter/shell/platform/linux/fl_dma_buf_texture_private.h"
+
+// DRM formats and modifiers, as defined in drm_fourcc.h.
+static constexpr uint32_t kDrmFormatAbgr8888 = 0x34324241;  // 'AB24'
+static constexpr uint32_t kDrmFormatXbgr8888 = 0x34324258;  // 'XB24'
+static constexpr uint64_t kDrmFormatModLinear = 0;
+static constexpr uint64_t kDrmFormatModInvalid = 0x00ffffffffffffff;
+
+static constexpr size_t kMaxPlanes = 4;
+
+// Number of bytes per pixel of the formats that can be copied.
+static constexpr uint32_t kBytesPerPixel = 4;
+
+typedef struct {
+  uint32_t width;
+  uint32_t height;
+  uint32_t fourcc;
+  uint64_t modifier;
+  FlDmaBufPlane planes[kMaxPlanes];
+  size_t n_planes;
+  FlDmaBufReleaseCallback release_callback;
+  gpointer user_data;
+} FlDmaBufFrame;
+
+struct _FlDmaBufTexture {
+  GObject parent_instance;
+
+  int64_t id;
+
+  // Frame set with fl_dma_buf_texture_set_frame() and not imported yet.
+  // Protected by mutex.
+  GMutex mutex;
+  gboolean has_pending_frame;
+  FlDmaBufFrame pending_frame;
+
+  // Pool of the engine drawing this texture, and whether frames can be
+  // imported as EGL images. Set on first populate.
+  FlTexturePool* pool;
+  gboolean use_egl_images;
+
+  // Frame being shown, and the texture and EGL image it was imported into.
+  // Only accessed on the thread populating the texture.
+  gboolean has_current_frame;
+  FlDmaBufFrame current_frame;
+  GLuint texture_name;
+  EGLDisplay display;
+  EGLImageKHR image;
+};
+
+G_DEFINE_QUARK(fl_dma_buf_texture_error_quark, fl_dma_buf_texture_error)
+
+static void fl_dma_buf_texture_iface_init(FlTextureInterface* iface);
+
+G_DEFINE_TYPE_WITH_CODE(FlDmaBufTexture,
+                        fl_dma_buf_texture,
+                        G_TYPE_OBJECT,
+                        G_IMPLEMENT_INTERFACE(fl_texture_get_type(),
+                                              fl_dma_buf_texture_iface_init))
+
+// Implements FlTexture::set_id
+static void fl_dma_buf_texture_set_id(FlTexture* texture, int64_t id) {
+  FL_DMA_BUF_TEXTURE(texture)->id = id;
+}
+
+// Implements FlTexture::get_id
+static int64_t fl_dma_buf_texture_get_id(FlTexture* texture) {
+  return FL_DMA_BUF_TEXTURE(texture)->id;
+}
+
+static void fl_dma_buf_texture_iface_init(FlTextureInterface* iface) {
+  iface->set_id = fl_dma_buf_texture_set_id;
+  iface->get_id = fl_dma_buf_texture_get_id;
+}
+
+// Returns a frame to its producer.
+static void release_frame(const FlDmaBufFrame* frame, int fence_fd) {
+  if (frame->release_callback != nullptr) {
+    frame->release_callback(fence_fd, frame->user_data);
+  } else if (fence_fd >= 0) {
+    close(fence_fd);
+  }
+}
+
+// Returns a sync file that signals when the commands issued so far have been
+// executed. Falls back to waiting for them if native fences are unsupported.
+static int create_release_fence(EGLDisplay display) {
+  if (epoxy_has_egl_extension(display, "EGL_ANDROID_native_fence_sync")) {
+    EGLSyncKHR sync =
+        eglCreateSyncKHR(display, EGL_SYNC_NATIVE_FENCE_ANDROID, nullptr);
+    if (sync != EGL_NO_SYNC_KHR) {
+      // The fence only gets a file descriptor once it has been flushed.
+      glFlush();
+      int fence_fd = eglDupNativeFenceFDANDROID(display, sync);
+      eglDestroySyncKHR(display, sync);
+      if (fence_fd != EGL_NO_NATIVE_FENCE_FD_ANDROID) {
+        return fence_fd;
+      }
+    }
+  }
+
+  glFinish();
+  return -1;
+}
+
+// Releases the frame being shown once the commands reading it are done.
+static void retire_current_frame(FlDmaBufTexture* self) {
+  if (!self->has_current_frame) {
+    return;
+  }
+
+  int fence_fd = -1;
+  if (self->image != EGL_NO_IMAGE_KHR) {
+    fence_fd = create_release_fence(self->display);
+    eglDestroyImageKHR(self->display, self->image);
+    self->image = EGL_NO_IMAGE_KHR;
+
+    // The texture keeps the frame's buffer alive for as long as it is bound
+    // to the image, so give it empty storage before it goes back to the pool.
+    glBindTexture(GL_TEXTURE_2D, self->texture_name);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 0, 0, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, nullptr);
+  }
+  fl_texture_pool_release(self->pool, self->texture_name,
+                          self->current_frame.width,
+                          self->current_frame.height,
+                          self->current_frame.fourcc);
+  self->texture_name = 0;
+  self->has_current_frame = FALSE;
+  release_frame(&self->current_frame, fence_fd);
+}
+
+// Imports @frame as an EGL image without copying it.
+static gboolean import_frame(FlDmaBufTexture* self,
+                             const FlDmaBufFrame* frame,
+                             GError** error) {
+  static const EGLint kPlaneFd[] = {
+      EGL_DMA_BUF_PLANE0_FD_EXT, EGL_DMA_BUF_PLANE1_FD_EXT,
+      EGL_DMA_BUF_PLANE2_FD_EXT, EGL_DMA_BUF_PLANE3_FD_EXT};
+  static const EGLint kPlaneOffset[] = {
+      EGL_DMA_BUF_PLANE0_OFFSET_EXT, EGL_DMA_BUF_PLANE1_OFFSET_EXT,
+      EGL_DMA_BUF_PLANE2_OFFSET_EXT, EGL_DMA_BUF_PLANE3_OFFSET_EXT};
+  static const EGLint kPlanePitch[] = {
+      EGL_DMA_BUF_PLANE0_PITCH_EXT, EGL_DMA_BUF_PLANE1_PITCH_EXT,
+      EGL_DMA_BUF_PLANE2_PITCH_EXT, EGL_DMA_BUF_PLANE3_PITCH_EXT};
+  static const EGLint kPlaneModifierLo[] = {
+      EGL_DMA_BUF_PLANE0_MODIFIER_LO_EXT, EGL_DMA_BUF_PLANE1_MODIFIER_LO_EXT,
+      EGL_DMA_BUF_PLANE2_MODIFIER_LO_EXT, EGL_DMA_BUF_PLANE3_MODIFIER_LO_EXT};
+  static const EGLint kPlaneModifierHi[] = {
+      EGL_DMA_BUF_PLANE0_MODIFIER_HI_EXT, EGL_DMA_BUF_PLANE1_MODIFIER_HI_EXT,
+      EGL_DMA_BUF_PLANE2_MODIFIER_HI_EXT, EGL_DMA_BUF_PLANE3_MODIFIER_HI_EXT};
+
+  EGLDisplay display = eglGetCurrentDisplay();
+  gboolean use_modifier =
+      frame->modifier != kDrmFormatModInvalid &&
+      epoxy_has_egl_extension(display,
+                              "EGL_EXT_image_dma_buf_import_modifiers");
+
+  // Six attributes for the frame, ten per plane and the terminator.
+  EGLint attributes[7 + 10 * kMaxPlanes];
+  size_t n = 0;
+  attributes[n++] = EGL_WIDTH;
+  attributes[n++] = frame->width;
+  attributes[n++] = EGL_HEIGHT;
+  attributes[n++] = frame->height;
+  attributes[n++] = EGL_LINUX_DRM_FOURCC_EXT;
+  attributes[n++] = frame->fourcc;
+  for (size_t i = 0; i < frame->n_planes; i++) {
+    attributes[n++] = kPlaneFd[i];
+    attributes[n++] = frame->planes[i].fd;
+    attributes[n++] = kPlaneOffset[i];
+    attributes[n++] = frame->planes[i].offset;
+    attributes[n++] = kPlanePitch[i];
+    attributes[n++] = frame->planes[i].stride;
+    if (use_modifier) {
+      attributes[n++] = kPlaneModifierLo[i];
+      attributes[n++] = static_cast<EGLint>(frame->modifier & 0xffffffff);
+      attributes[n++] = kPlaneModifierHi[i];
+      attributes[n++] = static_cast<EGLint>(frame->modifier >> 32);
+    }
+  }
+  attributes[n++] = EGL_NONE;
+
+  EGLImageKHR image = eglCreateImageKHR(display, EGL_NO_CONTEXT,
+                                        EGL_LINUX_DMA_BUF_EXT, nullptr,
+                                        attributes);
+  if (image == EGL_NO_IMAGE_KHR) {
+    g_set_error(error, FL_DMA_BUF_TEXTURE_ERROR,
+                FL_DMA_BUF_TEXTURE_ERROR_FAILED,
+                "Failed to import DMA-BUF frame: EGL error 0x%x",
+                eglGetError());
+    return FALSE;
+  }
+
+  gboolean created;
+  GLuint texture_name = fl_texture_pool_acquire(
+      self->pool, frame->width, frame->height, frame->fourcc, &created);
+  glEGLImageTargetTexture2DOES(GL_TEXTURE_2D, image);
+
+  retire_current_frame(self);
+  self->current_frame = *frame;
+  self->has_current_frame = TRUE;
+  self->texture_name = texture_name;
+  self->display = display;
+  self->image = image;
+  return TRUE;
+}
+
+// Returns TRUE if the current context can swizzle the channels of textures.
+static gboolean supports_texture_swizzle() {
+  if (epoxy_is_desktop_gl()) {
+    return epoxy_gl_version() >= 33 ||
+           epoxy_has_gl_extension("GL_ARB_texture_swizzle") ||
+           epoxy_has_gl_extension("GL_EXT_texture_swizzle");
+  }
+  return epoxy_gl_version() >= 30;
+}
+
+// Copies @frame into a texture, for displays that can't import DMA-BUFs. The
+// frame is released as soon as it has been copied.
+static gboolean copy_frame(FlDmaBufTexture* self,
+                           const FlDmaBufFrame* frame,
+                           GError** error) {
+  const FlDmaBufPlane* plane = &frame->planes[0];
+  if (frame->n_planes != 1 ||
+      (frame->fourcc != kDrmFormatAbgr8888 &&
+       frame->fourcc != kDrmFormatXbgr8888) ||
+      (frame->modifier != kDrmFormatModLinear &&
+       frame->modifier != kDrmFormatModInvalid) ||
+      plane->stride < frame->width * kBytesPerPixel) {
+    g_set_error(error, FL_DMA_BUF_TEXTURE_ERROR,
+                FL_DMA_BUF_TEXTURE_ERROR_FAILED,
+                "DMA-BUF import is not supported, and frames in format 0x%x "
+                "with %zu planes can't be copied",
+                frame->fourcc, frame->n_planes);
+    return FALSE;
+  }
+
+  size_t size = plane->offset + static_cast<size_t>(plane->stride) *
+                                    (frame->height - 1) +
+                frame->width * kBytesPerPixel;
+  void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, plane->fd, 0);
+  if (data == MAP_FAILED) {
+    g_set_error(error, FL_DMA_BUF_TEXTURE_ERROR,
+                FL_DMA_BUF_TEXTURE_ERROR_FAILED,
+                "Failed to map DMA-BUF frame: %s", g_strerror(errno));
+    return FALSE;
+  }
+
+  // Makes the CPU view coherent with the producer. Fails harmlessly for
+  // buffers that are not DMA-BUFs.
+  struct dma_buf_sync sync = {DMA_BUF_SYNC_START | DMA_BUF_SYNC_READ};
+  ioctl(plane->fd, DMA_BUF_IOCTL_SYNC, &sync);
+
+  // The unused byte of XBGR pixels would be sampled as alpha, so it is either
+  // swizzled to one or overwritten in a copy of the pixels.
+  gboolean is_opaque = frame->fourcc == kDrmFormatXbgr8888;
+  gboolean use_swizzle = is_opaque && supports_texture_swizzle();
+
+  gboolean created;
+  GLuint texture_name = fl_texture_pool_acquire(
+      self->pool, frame->width, frame->height, frame->fourcc, &created);
+  if (created) {
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, frame->width, frame->height, 0,
+                 GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    if (use_swizzle) {
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_ONE);
+    }
+  }
+  const uint8_t* pixels = static_cast<const uint8_t*>(data) + plane->offset;
+  size_t row_size = frame->width * kBytesPerPixel;
+  size_t stride = plane->stride;
+  g_autofree uint8_t* opaque_pixels = nullptr;
+  if (is_opaque && !use_swizzle) {
+    opaque_pixels = static_cast<uint8_t*>(g_malloc(row_size * frame->height));
+    for (uint32_t row = 0; row < frame->height; row++) {
+      uint8_t* opaque_row = opaque_pixels + row * row_size;
+      memcpy(opaque_row, pixels + row * stride, row_size);
+      for (size_t i = 3; i < row_size; i += kBytesPerPixel) {
+        opaque_row[i] = 0xff;
+      }
+    }
+    pixels = opaque_pixels;
+    stride = row_size;
+  }
+  if (stride == row_size) {
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, frame->width, frame->height,
+                    GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+  } else {
+    // Without GL_UNPACK_ROW_LENGTH, padded rows are uploaded one by one.
+    for (uint32_t row = 0; row < frame->height; row++) {
+      glTexSubImage2D(GL_TEXTURE_2D, 0, 0, row, frame->width, 1, GL_RGBA,
+                      GL_UNSIGNED_BYTE, pixels + row * stride);
+    }
+  }
+
+  sync.flags = DMA_BUF_SYNC_END | DMA_BUF_SYNC_READ;
+  ioctl(plane->fd, DMA_BUF_IOCTL_SYNC, &sync);
+  munmap(data, size);
+
+  // The pixels have been copied, so the producer can have the buffer back.
+  FlDmaBufFrame copied_frame = *frame;
+  copied_frame.release_callback = nullptr;
+  release_frame(frame, -1);
+
+  retire_current_frame(self);
+  self->current_frame = copied_frame;
+  self->has_current_frame = TRUE;
+  self->texture_name = texture_name;
+  return TRUE;
+}
+
+static void fl_dma_buf_texture_dispose(GObject* object) {
+  FlDmaBufTexture* self = FL_DMA_BUF_TEXTURE(object);
+
+  if (self->has_current_frame) {
+    if (self->image != EGL_NO_IMAGE_KHR) {
+      eglDestroyImageKHR(self->display, self->image);
+      self->image = EGL_NO_IMAGE_KHR;
+    }
+    glDeleteTextures(1, &self->texture_name);
+    self->texture_name = 0;
+    self->has_current_frame = FALSE;
+    release_frame(&self->current_frame, -1);
+  }
+
+  g_mutex_lock(&self->mutex);
+  if (self->has_pending_frame) {
+    self->has_pending_frame = FALSE;
+    release_frame(&self->pending_frame, -1);
+  }
+  g_mutex_unlock(&self->mutex);
+
+  g_clear_object(&self->pool);
+
+  G_OBJECT_CLASS(fl_dma_buf_texture_parent_class)->dispose(object);
+}
+
+static void fl_dma_buf_texture_finalize(GObject* object) {
+  FlDmaBufTexture* self = FL_DMA_BUF_TEXTURE(object);
+
+  g_mutex_clear(&self->mutex);
+
+  G_OBJECT_CLASS(fl_dma_buf_texture_parent_class)->finalize(object);
+}
+
+static void fl_dma_buf_texture_class_init(FlDmaBufTextureClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = fl_dma_buf_texture_dispose;
+  G_OBJECT_CLASS(klass)->finalize = fl_dma_buf_texture_finalize;
+}
+
+static void fl_dma_buf_texture_init(FlDmaBufTexture* self) {
+  g_mutex_init(&self->mutex);
+  self->display = EGL_NO_DISPLAY;
+  self->image = EGL_NO_IMAGE_KHR;
+}
+
+G_MODULE_EXPORT FlDmaBufTexture* fl_dma_buf_texture_new() {
+  return FL_DMA_BUF_TEXTURE(
+      g_object_new(fl_dma_buf_texture_get_type(), nullptr));
+}
+
+G_MODULE_EXPORT void fl_dma_buf_texture_set_frame(
+    FlDmaBufTexture* self,
+    uint32_t width,
+    uint32_t height,
+    uint32_t fourcc,
+    uint64_t modifier,
+    const FlDmaBufPlane* planes,
+    size_t n_planes,
+    FlDmaBufReleaseCallback release_callback,
+    gpointer user_data) {
+  g_return_if_fail(FL_IS_DMA_BUF_TEXTURE(self));
+  g_return_if_fail(width > 0 && height > 0);
+  g_return_if_fail(planes != nullptr);
+  g_return_if_fail(n_planes >= 1 && n_planes <= kMaxPlanes);
+
+  FlDmaBufFrame frame = {};
+  frame.width = width;
+  frame.height = height;
+  frame.fourcc = fourcc;
+  frame.modifier = modifier;
+  for (size_t i = 0; i < n_planes; i++) {
+    frame.planes[i] = planes[i];
+  }
+  frame.n_planes = n_planes;
+  frame.release_callback = release_callback;
+  frame.user_data = user_data;
+
+  FlDmaBufFrame replaced_frame;
+  gboolean replaced;
+  g_mutex_lock(&self->mutex);
+  replaced = self->has_pending_frame;
+  replaced_frame = self->pending_frame;
+  self->pending_frame = frame;
+  self->has_pending_frame = TRUE;
+  g_mutex_unlock(&self->mutex);
+
+  // The replaced frame was never imported, so it can be reused immediately.
+  if (replaced) {
+    release_frame(&replaced_frame, -1);
+  }
+}
+
+gboolean fl_dma_buf_texture_populate(FlDmaBufTexture* self,
+                                     FlTexturePool* pool,
+                                     uint32_t width,
+                                     uint32_t height,
+                                     FlutterOpenGLTexture* opengl_texture,
+                                     GError** error) {
+  g_return_val_if_fail(FL_IS_DMA_BUF_TEXTURE(self), FALSE);
+
+  if (self->pool == nullptr) {
+    self->pool = FL_TEXTURE_POOL(g_object_ref(pool));
+    self->use_egl_images =
+        epoxy_has_egl_extension(eglGetCurrentDisplay(),
+                                "EGL_EXT_image_dma_buf_import") &&
+        epoxy_has_gl_extension("GL_OES_EGL_image");
+  }
+
+  FlDmaBufFrame frame;
+  gboolean has_frame;
+  g_mutex_lock(&self->mutex);
+  has_frame = self->has_pending_frame;
+  frame = self->pending_frame;
+  self->has_pending_frame = FALSE;
+  g_mutex_unlock(&self->mutex);
+
+  if (has_frame) {
+    gboolean result = self->use_egl_images ? import_frame(self, &frame, error)
+                                           : copy_frame(self, &frame, error);
+    if (!result) {
+      release_frame(&frame, -1);
+      return FALSE;
+    }
+  }
+
+  if (!self->has_current_frame) {
+    g_set_error(error, FL_DMA_BUF_TEXTURE_ERROR,
+                FL_DMA_BUF_TEXTURE_ERROR_FAILED, "No frame has been set");
+    return FALSE;
+  }
+
+  opengl_texture->target = GL_TEXTURE_2D;
+  opengl_texture->name = self->texture_name;
+  opengl_texture->format = GL_RGBA8;
+  opengl_texture->destruction_callback = nullptr;
+  opengl_texture->user_data = nullptr;
+  opengl_texture->width = self->current_frame.width;
+  opengl_texture->height = self->current_frame.height;
+
+  return TRUE;
+}
@@ -0,0 +1,53 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_LINUX_FL_DMA_BUF_TEXTURE_PRIVATE_H_
+#define FLUTTER_SHELL_PLATFORM_LINUX_FL_DMA_BUF_TEXTURE_PRIVATE_H_
+
+#include "flutter/shell/platform/embedder/embedder.h"
+#include "flutter/shell/platform/linux/fl_texture_pool.h"
+#include "flutter/shell/platform/linux/public/flutter_linux/fl_dma_buf_texture.h"
+
+G_BEGIN_DECLS
+
+/**
+ * FlDmaBufTextureError:
+ * Errors for #FlDmaBufTexture objects to set on failures.
+ */
+
+#define FL_DMA_BUF_TEXTURE_ERROR fl_dma_buf_texture_error_quark()
+
+typedef enum {
+  // NOLINTBEGIN(readability-identifier-naming)
+  FL_DMA_BUF_TEXTURE_ERROR_FAILED,
+  // NOLINTEND(readability-identifier-naming)
+} FlDmaBufTextureError;
+
+GQuark fl_dma_buf_texture_error_quark(void) G_GNUC_CONST;
+
+/**
+ * fl_dma_buf_texture_populate:
+ * @texture: an #FlDmaBufTexture.
+ * @pool: the #FlTexturePool to take textures for frames from.
+ * @width: width of the texture.
+ * @height: height of the texture.
+ * @opengl_texture: (out): return an #FlutterOpenGLTexture.
+ * @error: (allow-none): #GError location to store the error occurring, or
+ * %NULL to ignore.
+ *
+ * Imports the most recently set frame, if it has not been imported yet, and
+ * populates @opengl_texture with it. The frame shown before is released.
+ *
+ * Returns: %TRUE on success.
+ */
+gboolean fl_dma_buf_texture_populate(FlDmaBufTexture* texture,
+                                     FlTexturePool* pool,
+                                     uint32_t width,
+                                     uint32_t height,
+                                     FlutterOpenGLTexture* opengl_texture,
+                                     GError** error);
+
+G_END_DECLS
+
+#endif  // FLUTTER_SHELL_PLATFORM_LINUX_FL_DMA_BUF_TEXTURE_PRIVATE_H_
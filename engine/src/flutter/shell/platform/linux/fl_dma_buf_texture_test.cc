@@ -0,0 +1,439 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/linux/public/flutter_linux/fl_dma_buf_texture.h"
+#include "flutter/shell/platform/linux/fl_dma_buf_texture_private.h"
+#include "flutter/shell/platform/linux/fl_texture_pool.h"
+#include "flutter/shell/platform/linux/testing/mock_epoxy.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <vector>
+
+// DRM_FORMAT_ABGR8888, which is RGBA in memory.
+static constexpr uint32_t kFormatRgba = 0x34324241;
+// DRM_FORMAT_XBGR8888, which is RGBX in memory.
+static constexpr uint32_t kFormatRgbx = 0x34324258;
+static constexpr uint64_t kModifierLinear = 0;
+
+// RGBA
+static const uint8_t kPixels[] = {0x0a, 0x1a, 0x2a, 0x3a, 0x4a, 0x5a,
+                                  0x6a, 0x7a, 0x8a, 0x9a, 0xaa, 0xba,
+                                  0xca, 0xda, 0xea, 0xfa};
+
+// A memory file standing in for a DMA-BUF, containing 2x2 pixels whose rows
+// are @stride bytes apart.
+class FakeDmaBuf {
+ public:
+  explicit FakeDmaBuf(uint32_t stride) : stride_(stride) {
+    fd_ = memfd_create("fake-dma-buf", MFD_CLOEXEC);
+    std::vector<uint8_t> data(stride * 2, 0xff);
+    memcpy(data.data(), kPixels, 8);
+    memcpy(data.data() + stride, kPixels + 8, 8);
+    EXPECT_EQ(write(fd_, data.data(), data.size()),
+              static_cast<ssize_t>(data.size()));
+  }
+
+  ~FakeDmaBuf() { close(fd_); }
+
+  int fd() const { return fd_; }
+
+  FlDmaBufPlane plane() const { return {fd_, 0, stride_}; }
+
+ private:
+  int fd_;
+  uint32_t stride_;
+};
+
+// Counts the releases of frames and closes their fences.
+static void release_cb(int fence_fd, gpointer user_data) {
+  if (fence_fd >= 0) {
+    close(fence_fd);
+  }
+  (*static_cast<int*>(user_data))++;
+}
+
+// Records the fence a frame is released with.
+static void release_with_fence_cb(int fence_fd, gpointer user_data) {
+  *static_cast<int*>(user_data) = fence_fd;
+}
+
+// Makes the display import DMA-BUFs as EGL images.
+static void enable_dma_buf_import(flutter::testing::MockEpoxy& epoxy) {
+  ON_CALL(epoxy, epoxy_has_egl_extension(::testing::_,
+                                         ::testing::StrEq(
+                                             "EGL_EXT_image_dma_buf_import")))
+      .WillByDefault(::testing::Return(true));
+  ON_CALL(epoxy,
+          epoxy_has_gl_extension(::testing::StrEq("GL_OES_EGL_image")))
+      .WillByDefault(::testing::Return(true));
+}
+
+// Returns the value of @name in an EGL attribute list, or -1 if it is missing.
+static EGLint get_attribute(const EGLint* attributes, EGLint name) {
+  for (size_t i = 0; attributes[i] != EGL_NONE; i += 2) {
+    if (attributes[i] == name) {
+      return attributes[i + 1];
+    }
+  }
+  return -1;
+}
+
+// Test that frames are copied when the display can't import DMA-BUFs.
+TEST(FlDmaBufTextureTest, CopiesFrame) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+  g_autoptr(FlDmaBufTexture) texture = fl_dma_buf_texture_new();
+
+  FakeDmaBuf buffer(8);
+  FlDmaBufPlane plane = buffer.plane();
+  int release_count = 0;
+  fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgba, kModifierLinear,
+                               &plane, 1, release_cb, &release_count);
+
+  EXPECT_CALL(epoxy, glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 2, 2, GL_RGBA,
+                                     GL_UNSIGNED_BYTE, ::testing::_))
+      .WillOnce([](GLenum target, GLint level, GLint x, GLint y, GLsizei width,
+                   GLsizei height, GLenum format, GLenum type,
+                   const void* pixels) {
+        EXPECT_EQ(memcmp(pixels, kPixels, sizeof(kPixels)), 0);
+      });
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_TRUE(fl_dma_buf_texture_populate(texture, pool, 4, 4, &opengl_texture,
+                                          &error));
+  EXPECT_EQ(error, nullptr);
+  EXPECT_EQ(opengl_texture.target, static_cast<uint32_t>(GL_TEXTURE_2D));
+  EXPECT_NE(opengl_texture.name, 0u);
+  EXPECT_EQ(opengl_texture.width, 2u);
+  EXPECT_EQ(opengl_texture.height, 2u);
+
+  // A copied frame is released right away.
+  EXPECT_EQ(release_count, 1);
+}
+
+// Test that padded rows are copied without the padding.
+TEST(FlDmaBufTextureTest, CopiesFrameWithPadding) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+  g_autoptr(FlDmaBufTexture) texture = fl_dma_buf_texture_new();
+
+  FakeDmaBuf buffer(16);
+  FlDmaBufPlane plane = buffer.plane();
+  fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgba, kModifierLinear,
+                               &plane, 1, nullptr, nullptr);
+
+  EXPECT_CALL(epoxy, glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 2, 1, GL_RGBA,
+                                     GL_UNSIGNED_BYTE, ::testing::_))
+      .WillOnce([](GLenum target, GLint level, GLint x, GLint y, GLsizei width,
+                   GLsizei height, GLenum format, GLenum type,
+                   const void* pixels) {
+        EXPECT_EQ(memcmp(pixels, kPixels, 8), 0);
+      });
+  EXPECT_CALL(epoxy, glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 1, 2, 1, GL_RGBA,
+                                     GL_UNSIGNED_BYTE, ::testing::_))
+      .WillOnce([](GLenum target, GLint level, GLint x, GLint y, GLsizei width,
+                   GLsizei height, GLenum format, GLenum type,
+                   const void* pixels) {
+        EXPECT_EQ(memcmp(pixels, kPixels + 8, 8), 0);
+      });
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_TRUE(fl_dma_buf_texture_populate(texture, pool, 4, 4, &opengl_texture,
+                                          &error));
+  EXPECT_EQ(error, nullptr);
+}
+
+// Test that the texture of a frame is reused for the next frames.
+TEST(FlDmaBufTextureTest, ReusesTextures) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+  g_autoptr(FlDmaBufTexture) texture = fl_dma_buf_texture_new();
+
+  FakeDmaBuf buffer(8);
+  FlDmaBufPlane plane = buffer.plane();
+  FlutterOpenGLTexture opengl_texture = {0};
+  std::vector<uint32_t> names;
+  for (int i = 0; i < 3; i++) {
+    fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgba, kModifierLinear,
+                                 &plane, 1, nullptr, nullptr);
+    EXPECT_TRUE(fl_dma_buf_texture_populate(texture, pool, 4, 4,
+                                            &opengl_texture, nullptr));
+    names.push_back(opengl_texture.name);
+  }
+
+  // Two textures alternate, so a frame is never written into the texture of
+  // the frame being shown.
+  EXPECT_NE(names[0], names[1]);
+  EXPECT_EQ(names[0], names[2]);
+}
+
+// Test that the current frame is shown again if no new frame has been set.
+TEST(FlDmaBufTextureTest, ShowsCurrentFrameAgain) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+  g_autoptr(FlDmaBufTexture) texture = fl_dma_buf_texture_new();
+
+  FakeDmaBuf buffer(8);
+  FlDmaBufPlane plane = buffer.plane();
+  fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgba, kModifierLinear,
+                               &plane, 1, nullptr, nullptr);
+  FlutterOpenGLTexture opengl_texture = {0};
+  EXPECT_TRUE(fl_dma_buf_texture_populate(texture, pool, 4, 4, &opengl_texture,
+                                          nullptr));
+  uint32_t name = opengl_texture.name;
+
+  EXPECT_CALL(epoxy, glTexSubImage2D).Times(0);
+  EXPECT_TRUE(fl_dma_buf_texture_populate(texture, pool, 4, 4, &opengl_texture,
+                                          nullptr));
+  EXPECT_EQ(opengl_texture.name, name);
+}
+
+// Test that a frame replaced before being shown is released.
+TEST(FlDmaBufTextureTest, ReleasesReplacedFrame) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  g_autoptr(FlDmaBufTexture) texture = fl_dma_buf_texture_new();
+
+  FakeDmaBuf buffer(8);
+  FlDmaBufPlane plane = buffer.plane();
+  int release_count = 0;
+  fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgba, kModifierLinear,
+                               &plane, 1, release_cb, &release_count);
+  EXPECT_EQ(release_count, 0);
+  fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgba, kModifierLinear,
+                               &plane, 1, release_cb, &release_count);
+  EXPECT_EQ(release_count, 1);
+
+  // The pending frame is released with the texture.
+  g_clear_object(&texture);
+  EXPECT_EQ(release_count, 2);
+}
+
+// Test that populating fails without a frame.
+TEST(FlDmaBufTextureTest, PopulateWithoutFrame) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+  g_autoptr(FlDmaBufTexture) texture = fl_dma_buf_texture_new();
+
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_FALSE(fl_dma_buf_texture_populate(texture, pool, 4, 4,
+                                           &opengl_texture, &error));
+  EXPECT_TRUE(g_error_matches(error, FL_DMA_BUF_TEXTURE_ERROR,
+                              FL_DMA_BUF_TEXTURE_ERROR_FAILED));
+}
+
+// Test that frames that can't be copied are rejected and released.
+TEST(FlDmaBufTextureTest, RejectsUncopyableFrame) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+  g_autoptr(FlDmaBufTexture) texture = fl_dma_buf_texture_new();
+
+  FakeDmaBuf buffer(8);
+  FlDmaBufPlane planes[] = {buffer.plane(), buffer.plane()};
+  int release_count = 0;
+  // DRM_FORMAT_NV12
+  fl_dma_buf_texture_set_frame(texture, 2, 2, 0x3231564e, kModifierLinear,
+                               planes, 2, release_cb, &release_count);
+
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_FALSE(fl_dma_buf_texture_populate(texture, pool, 4, 4,
+                                           &opengl_texture, &error));
+  EXPECT_NE(error, nullptr);
+  EXPECT_EQ(release_count, 1);
+}
+
+// Test that the unused byte of XBGR frames is copied as opaque alpha if
+// textures can't be swizzled.
+TEST(FlDmaBufTextureTest, CopiesXbgrFrameWithOpaqueAlpha) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+  g_autoptr(FlDmaBufTexture) texture = fl_dma_buf_texture_new();
+
+  FakeDmaBuf buffer(16);
+  FlDmaBufPlane plane = buffer.plane();
+  fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgbx, kModifierLinear,
+                               &plane, 1, nullptr, nullptr);
+
+  EXPECT_CALL(epoxy, glTexParameteri).Times(::testing::AnyNumber());
+  EXPECT_CALL(epoxy, glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A,
+                                     ::testing::_))
+      .Times(0);
+  EXPECT_CALL(epoxy, glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 2, 2, GL_RGBA,
+                                     GL_UNSIGNED_BYTE, ::testing::_))
+      .WillOnce([](GLenum target, GLint level, GLint x, GLint y, GLsizei width,
+                   GLsizei height, GLenum format, GLenum type,
+                   const void* pixels) {
+        const uint8_t* data = static_cast<const uint8_t*>(pixels);
+        for (size_t i = 0; i < sizeof(kPixels); i++) {
+          EXPECT_EQ(data[i], i % 4 == 3 ? 0xff : kPixels[i]) << i;
+        }
+      });
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_TRUE(fl_dma_buf_texture_populate(texture, pool, 4, 4, &opengl_texture,
+                                          &error));
+  EXPECT_EQ(error, nullptr);
+}
+
+// Test that the alpha of XBGR frames is swizzled to one if supported.
+TEST(FlDmaBufTextureTest, SwizzlesAlphaOfXbgrFrame) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  ON_CALL(epoxy, epoxy_gl_version).WillByDefault(::testing::Return(30));
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+  g_autoptr(FlDmaBufTexture) texture = fl_dma_buf_texture_new();
+
+  FakeDmaBuf buffer(8);
+  FlDmaBufPlane plane = buffer.plane();
+  fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgbx, kModifierLinear,
+                               &plane, 1, nullptr, nullptr);
+
+  EXPECT_CALL(epoxy, glTexParameteri).Times(::testing::AnyNumber());
+  EXPECT_CALL(epoxy,
+              glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_ONE));
+  EXPECT_CALL(epoxy, glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 2, 2, GL_RGBA,
+                                     GL_UNSIGNED_BYTE, ::testing::_))
+      .WillOnce([](GLenum target, GLint level, GLint x, GLint y, GLsizei width,
+                   GLsizei height, GLenum format, GLenum type,
+                   const void* pixels) {
+        EXPECT_EQ(memcmp(pixels, kPixels, sizeof(kPixels)), 0);
+      });
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_TRUE(fl_dma_buf_texture_populate(texture, pool, 4, 4, &opengl_texture,
+                                          &error));
+  EXPECT_EQ(error, nullptr);
+}
+
+// Test that frames are imported as EGL images when supported, and released
+// once the next frame is shown.
+TEST(FlDmaBufTextureTest, ImportsFrame) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  enable_dma_buf_import(epoxy);
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+  g_autoptr(FlDmaBufTexture) texture = fl_dma_buf_texture_new();
+
+  FakeDmaBuf buffer(16);
+  FlDmaBufPlane plane = buffer.plane();
+  int release_count = 0;
+  fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgba, kModifierLinear,
+                               &plane, 1, release_cb, &release_count);
+
+  EGLImageKHR image = reinterpret_cast<EGLImageKHR>(0x1);
+  EXPECT_CALL(epoxy, eglCreateImageKHR(::testing::_, EGL_NO_CONTEXT,
+                                       EGL_LINUX_DMA_BUF_EXT, nullptr,
+                                       ::testing::_))
+      .WillOnce([&buffer, image](EGLDisplay dpy, EGLContext ctx,
+                                 EGLenum target, EGLClientBuffer client_buffer,
+                                 const EGLint* attributes) {
+        EXPECT_EQ(get_attribute(attributes, EGL_WIDTH), 2);
+        EXPECT_EQ(get_attribute(attributes, EGL_HEIGHT), 2);
+        EXPECT_EQ(get_attribute(attributes, EGL_LINUX_DRM_FOURCC_EXT),
+                  static_cast<EGLint>(kFormatRgba));
+        EXPECT_EQ(get_attribute(attributes, EGL_DMA_BUF_PLANE0_FD_EXT),
+                  buffer.fd());
+        EXPECT_EQ(get_attribute(attributes, EGL_DMA_BUF_PLANE0_PITCH_EXT), 16);
+        return image;
+      });
+  EXPECT_CALL(epoxy, glEGLImageTargetTexture2DOES(GL_TEXTURE_2D, image));
+  EXPECT_CALL(epoxy, glTexSubImage2D).Times(0);
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_TRUE(fl_dma_buf_texture_populate(texture, pool, 4, 4, &opengl_texture,
+                                          &error));
+  EXPECT_EQ(error, nullptr);
+  EXPECT_EQ(opengl_texture.width, 2u);
+  EXPECT_EQ(opengl_texture.height, 2u);
+
+  // An imported frame is read until the next frame is shown.
+  EXPECT_EQ(release_count, 0);
+
+  // Without native fences, the commands reading the frame are waited for.
+  EXPECT_CALL(epoxy, eglCreateImageKHR)
+      .WillOnce(::testing::Return(reinterpret_cast<EGLImageKHR>(0x2)));
+  EXPECT_CALL(epoxy, glFinish);
+  EXPECT_CALL(epoxy, eglDestroyImageKHR(::testing::_, image));
+  fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgba, kModifierLinear,
+                               &plane, 1, nullptr, nullptr);
+  EXPECT_TRUE(fl_dma_buf_texture_populate(texture, pool, 4, 4, &opengl_texture,
+                                          &error));
+  EXPECT_EQ(release_count, 1);
+  ::testing::Mock::VerifyAndClearExpectations(&epoxy);
+}
+
+// Test that imported frames are released with a fence if native fences are
+// supported.
+TEST(FlDmaBufTextureTest, ReleasesImportedFrameWithFence) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  enable_dma_buf_import(epoxy);
+  ON_CALL(epoxy, epoxy_has_egl_extension(
+                     ::testing::_,
+                     ::testing::StrEq("EGL_ANDROID_native_fence_sync")))
+      .WillByDefault(::testing::Return(true));
+  ON_CALL(epoxy, eglCreateImageKHR)
+      .WillByDefault(::testing::Return(reinterpret_cast<EGLImageKHR>(0x1)));
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+  g_autoptr(FlDmaBufTexture) texture = fl_dma_buf_texture_new();
+
+  FakeDmaBuf buffer(8);
+  FlDmaBufPlane plane = buffer.plane();
+  int fence_fd = -1;
+  fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgba, kModifierLinear,
+                               &plane, 1, release_with_fence_cb, &fence_fd);
+  FlutterOpenGLTexture opengl_texture = {0};
+  EXPECT_TRUE(fl_dma_buf_texture_populate(texture, pool, 4, 4, &opengl_texture,
+                                          nullptr));
+
+  int native_fence_fd = dup(buffer.fd());
+  EXPECT_CALL(epoxy, eglCreateSyncKHR(::testing::_,
+                                      EGL_SYNC_NATIVE_FENCE_ANDROID, nullptr))
+      .WillOnce(::testing::Return(reinterpret_cast<EGLSyncKHR>(0x1)));
+  EXPECT_CALL(epoxy, eglDupNativeFenceFDANDROID)
+      .WillOnce(::testing::Return(native_fence_fd));
+  EXPECT_CALL(epoxy, glFinish).Times(0);
+  fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgba, kModifierLinear,
+                               &plane, 1, nullptr, nullptr);
+  EXPECT_TRUE(fl_dma_buf_texture_populate(texture, pool, 4, 4, &opengl_texture,
+                                          nullptr));
+  EXPECT_EQ(fence_fd, native_fence_fd);
+  close(native_fence_fd);
+}
+
+// Test that the textures of imported frames are detached from their EGL images
+// and reused.
+TEST(FlDmaBufTextureTest, ReusesTexturesOfImportedFrames) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  enable_dma_buf_import(epoxy);
+  ON_CALL(epoxy, eglCreateImageKHR)
+      .WillByDefault(::testing::Return(reinterpret_cast<EGLImageKHR>(0x1)));
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+  g_autoptr(FlDmaBufTexture) texture = fl_dma_buf_texture_new();
+
+  // Each frame but the last is destroyed and detached from its texture.
+  EXPECT_CALL(epoxy, eglDestroyImageKHR).Times(2);
+  EXPECT_CALL(epoxy, glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 0, 0, 0, GL_RGBA,
+                                  GL_UNSIGNED_BYTE, nullptr))
+      .Times(2);
+
+  FakeDmaBuf buffer(8);
+  FlDmaBufPlane plane = buffer.plane();
+  FlutterOpenGLTexture opengl_texture = {0};
+  std::vector<uint32_t> names;
+  for (int i = 0; i < 3; i++) {
+    fl_dma_buf_texture_set_frame(texture, 2, 2, kFormatRgba, kModifierLinear,
+                                 &plane, 1, nullptr, nullptr);
+    EXPECT_TRUE(fl_dma_buf_texture_populate(texture, pool, 4, 4,
+                                            &opengl_texture, nullptr));
+    names.push_back(opengl_texture.name);
+  }
+
+  EXPECT_NE(names[0], names[1]);
+  EXPECT_EQ(names[0], names[2]);
+  ::testing::Mock::VerifyAndClearExpectations(&epoxy);
+}
@@ -15,6 +15,7 @@
 #include "flutter/shell/platform/embedder/embedder.h"
 #include "flutter/shell/platform/linux/fl_binary_messenger_private.h"
 #include "flutter/shell/platform/linux/fl_dart_project_private.h"
+#include "flutter/shell/platform/linux/fl_dma_buf_texture_private.h"
 #include "flutter/shell/platform/linux/fl_engine_private.h"
 #include "flutter/shell/platform/linux/fl_pixel_buffer_texture_private.h"
 #include "flutter/shell/platform/linux/fl_plugin_registrar_private.h"
@@ -23,6 +24,7 @@
 #include "flutter/shell/platform/linux/fl_renderer_headless.h"
 #include "flutter/shell/platform/linux/fl_settings_handler.h"
 #include "flutter/shell/platform/linux/fl_texture_gl_private.h"
+#include "flutter/shell/platform/linux/fl_texture_pool.h"
 #include "flutter/shell/platform/linux/fl_texture_registrar_private.h"
 #include "flutter/shell/platform/linux/public/flutter_linux/fl_plugin_registry.h"
 
@@ -46,6 +48,10 @@ struct _FlEngine {
   FlSettingsHandler* settings_handler;
   FlTextureRegistrar* texture_registrar;
   FlTaskRunner* task_runner;
+
+  // Textures reused by external textures. Only used on the raster thread.
+  FlTexturePool* texture_pool;
+
   FlutterEngineAOTData aot_data;
   FLUTTER_API_SYMBOL(FlutterEngine) engine;
   FlutterEngineProcTable embedder_api;
@@ -297,6 +303,10 @@ static bool fl_engine_gl_external_texture_frame_callback(
     result =
         fl_pixel_buffer_texture_populate(FL_PIXEL_BUFFER_TEXTURE(texture),
                                          width, height, opengl_texture, &error);
+  } else if (FL_IS_DMA_BUF_TEXTURE(texture)) {
+    result = fl_dma_buf_texture_populate(FL_DMA_BUF_TEXTURE(texture),
+                                         self->texture_pool, width, height,
+                                         opengl_texture, &error);
   } else {
     g_warning("Unsupported texture type %" G_GINT64_FORMAT, texture_id);
     return false;
@@ -427,6 +437,7 @@ static void fl_engine_dispose(GObject* object) {
   g_clear_object(&self->project);
   g_clear_object(&self->renderer);
   g_clear_object(&self->texture_registrar);
+  g_clear_object(&self->texture_pool);
   g_clear_object(&self->binary_messenger);
   g_clear_object(&self->settings_handler);
   g_clear_object(&self->task_runner);
@@ -475,6 +486,7 @@ static void fl_engine_init(FlEngine* self) {
   self->next_view_id = 1;
 
   self->texture_registrar = fl_texture_registrar_new(self);
+  self->texture_pool = fl_texture_pool_new();
 }
 
 FlEngine* fl_engine_new_with_renderer(FlDartProject* project,
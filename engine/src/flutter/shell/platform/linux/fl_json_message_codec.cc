@@ -8,6 +8,7 @@
 
 #include <cstring>
 
+#include "flutter/shell/platform/linux/fl_value_private.h"
 #include "rapidjson/reader.h"
 #include "rapidjson/writer.h"
 
@@ -123,18 +124,24 @@ static gboolean write_value(rapidjson::Writer<rapidjson::StringBuffer>& writer,
 // Handler to parse JSON using rapidjson in SAX mode.
 struct FlValueHandler {
   GPtrArray* stack;
+  // The keys of each map on the stack, so that keys can be appended without
+  // searching the map for duplicates.
+  GPtrArray* key_sets;
   FlValue* key;
   GError* error;
 
   FlValueHandler() {
     stack = g_ptr_array_new_with_free_func(
         reinterpret_cast<GDestroyNotify>(fl_value_unref));
+    key_sets = g_ptr_array_new_with_free_func(
+        reinterpret_cast<GDestroyNotify>(g_hash_table_unref));
     key = nullptr;
     error = nullptr;
   }
 
   ~FlValueHandler() {
     g_ptr_array_unref(stack);
+    g_ptr_array_unref(key_sets);
     if (key != nullptr) {
       fl_value_unref(key);
     }
@@ -155,7 +162,31 @@ struct FlValueHandler {
   void push(FlValue* value) { g_ptr_array_add(stack, fl_value_ref(value)); }
 
   // Pops the stack.
-  void pop() { g_ptr_array_remove_index(stack, stack->len - 1); }
+  void pop() {
+    FlValue* head = get_head();
+    if (head != nullptr && fl_value_get_type(head) == FL_VALUE_TYPE_MAP) {
+      g_ptr_array_remove_index(key_sets, key_sets->len - 1);
+    }
+    g_ptr_array_remove_index(stack, stack->len - 1);
+  }
+
+  // Adds |value| to |map| under the pending key.
+  void add_to_map(FlValue* map, FlValue* value) {
+    GHashTable* key_set = static_cast<GHashTable*>(
+        g_ptr_array_index(key_sets, key_sets->len - 1));
+    // The strings are owned by the keys in the map, which outlive the set.
+    gpointer key_string = const_cast<gchar*>(fl_value_get_string(key));
+    if (g_hash_table_contains(key_set, key_string)) {
+      // Duplicate keys are rare, so replace the existing entry the slow way.
+      // Update the set first as the old key is destroyed when replaced.
+      g_hash_table_add(key_set, key_string);
+      fl_value_set_take(map, key, fl_value_ref(value));
+    } else {
+      g_hash_table_add(key_set, key_string);
+      fl_value_map_append_take(map, key, fl_value_ref(value));
+    }
+    key = nullptr;
+  }
 
   // Adds a new value to the stack.
   bool add(FlValue* value) {
@@ -166,16 +197,17 @@ struct FlValueHandler {
     } else if (fl_value_get_type(head) == FL_VALUE_TYPE_LIST) {
       fl_value_append(head, owned_value);
     } else if (fl_value_get_type(head) == FL_VALUE_TYPE_MAP) {
-      fl_value_set_take(head, key, fl_value_ref(owned_value));
-      key = nullptr;
+      add_to_map(head, owned_value);
     } else {
       g_set_error(&error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED,
                   "Can't add value to non container");
       return false;
     }
 
-    if (fl_value_get_type(owned_value) == FL_VALUE_TYPE_LIST ||
-        fl_value_get_type(owned_value) == FL_VALUE_TYPE_MAP) {
+    if (fl_value_get_type(owned_value) == FL_VALUE_TYPE_MAP) {
+      g_ptr_array_add(key_sets, g_hash_table_new(g_str_hash, g_str_equal));
+      push(value);
+    } else if (fl_value_get_type(owned_value) == FL_VALUE_TYPE_LIST) {
       push(value);
     }
 
@@ -243,15 +275,22 @@ struct FlValueHandler {
 static GBytes* fl_json_message_codec_encode_message(FlMessageCodec* codec,
                                                     FlValue* message,
                                                     GError** error) {
-  rapidjson::StringBuffer buffer;
-  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  // The returned bytes take over the buffer so that large messages are not
+  // copied after being written.
+  auto* buffer = new rapidjson::StringBuffer();
+  rapidjson::Writer<rapidjson::StringBuffer> writer(*buffer);
 
   if (!write_value(writer, message, error)) {
+    delete buffer;
     return nullptr;
   }
 
-  const gchar* text = buffer.GetString();
-  return g_bytes_new(text, strlen(text));
+  return g_bytes_new_with_free_func(
+      buffer->GetString(), buffer->GetSize(),
+      [](gpointer buffer) {
+        delete static_cast<rapidjson::StringBuffer*>(buffer);
+      },
+      buffer);
 }
 
 // Implements FlMessageCodec:decode_message.
@@ -722,6 +722,33 @@ TEST(FlJsonMessageCodecTest, DecodeMapEmpty) {
   EXPECT_EQ(fl_value_get_length(value), static_cast<size_t>(0));
 }
 
+TEST(FlJsonMessageCodecTest, DecodeMapNested) {
+  g_autoptr(FlValue) value =
+      decode_message("{\"a\":{\"b\":1,\"c\":[{\"b\":2}]},\"b\":3}");
+  ASSERT_EQ(fl_value_get_type(value), FL_VALUE_TYPE_MAP);
+  ASSERT_EQ(fl_value_get_length(value), static_cast<size_t>(2));
+  FlValue* a = fl_value_lookup_string(value, "a");
+  ASSERT_NE(a, nullptr);
+  EXPECT_EQ(fl_value_get_int(fl_value_lookup_string(a, "b")), 1);
+  FlValue* c = fl_value_lookup_string(a, "c");
+  ASSERT_NE(c, nullptr);
+  EXPECT_EQ(fl_value_get_int(fl_value_lookup_string(
+                fl_value_get_list_value(c, 0), "b")),
+            2);
+  EXPECT_EQ(fl_value_get_int(fl_value_lookup_string(value, "b")), 3);
+}
+
+TEST(FlJsonMessageCodecTest, DecodeMapDuplicateKeys) {
+  g_autoptr(FlValue) value =
+      decode_message("{\"zero\":0,\"one\":1,\"zero\":2,\"zero\":3}");
+  ASSERT_EQ(fl_value_get_type(value), FL_VALUE_TYPE_MAP);
+  ASSERT_EQ(fl_value_get_length(value), static_cast<size_t>(2));
+  EXPECT_STREQ(fl_value_get_string(fl_value_get_map_key(value, 0)), "zero");
+  EXPECT_EQ(fl_value_get_int(fl_value_get_map_value(value, 0)), 3);
+  EXPECT_STREQ(fl_value_get_string(fl_value_get_map_key(value, 1)), "one");
+  EXPECT_EQ(fl_value_get_int(fl_value_get_map_value(value, 1)), 1);
+}
+
 TEST(FlJsonMessageCodecTest, DecodeMapUnterminatedEmpty) {
   decode_error_message("{", FL_JSON_MESSAGE_CODEC_ERROR,
                        FL_JSON_MESSAGE_CODEC_ERROR_INVALID_JSON);
@@ -7,11 +7,42 @@
 #include <epoxy/gl.h>
 #include <gmodule.h>
 
+#include <cstring>
+
 #include "flutter/shell/platform/linux/fl_pixel_buffer_texture_private.h"
 
+// Number of pixel buffer objects used to stream pixels to the texture. While
+// the driver transfers from one, the next frame is written into another.
+static constexpr size_t kPixelBufferCount = 2;
+
+// Number of bytes per RGBA pixel.
+static constexpr size_t kBytesPerPixel = 4;
+
 typedef struct {
   int64_t id;
   GLuint texture_id;
+
+  // Size of the texture storage.
+  uint32_t texture_width;
+  uint32_t texture_height;
+
+  // TRUE if pixels are streamed through pixel buffer objects into immutable
+  // texture storage. Detected when the texture is first created.
+  gboolean use_pixel_buffers;
+
+  // Ring of pixel buffer objects and the size of their storage.
+  GLuint pixel_buffers[kPixelBufferCount];
+  size_t pixel_buffer_sizes[kPixelBufferCount];
+  size_t next_pixel_buffer;
+
+  // Region marked with fl_pixel_buffer_texture_mark_region_dirty() since the
+  // last frame, as left/top/right/bottom edges. Protected by dirty_mutex.
+  GMutex dirty_mutex;
+  gboolean has_dirty_region;
+  uint32_t dirty_left;
+  uint32_t dirty_top;
+  uint32_t dirty_right;
+  uint32_t dirty_bottom;
 } FlPixelBufferTexturePrivate;
 
 static void fl_pixel_buffer_texture_iface_init(FlTextureInterface* iface);
@@ -57,10 +88,28 @@ static void fl_pixel_buffer_texture_dispose(GObject* object) {
     glDeleteTextures(1, &priv->texture_id);
     priv->texture_id = 0;
   }
+  if (priv->pixel_buffers[0]) {
+    glDeleteBuffers(kPixelBufferCount, priv->pixel_buffers);
+    for (size_t i = 0; i < kPixelBufferCount; i++) {
+      priv->pixel_buffers[i] = 0;
+      priv->pixel_buffer_sizes[i] = 0;
+    }
+  }
 
   G_OBJECT_CLASS(fl_pixel_buffer_texture_parent_class)->dispose(object);
 }
 
+static void fl_pixel_buffer_texture_finalize(GObject* object) {
+  FlPixelBufferTexture* self = FL_PIXEL_BUFFER_TEXTURE(object);
+  FlPixelBufferTexturePrivate* priv =
+      reinterpret_cast<FlPixelBufferTexturePrivate*>(
+          fl_pixel_buffer_texture_get_instance_private(self));
+
+  g_mutex_clear(&priv->dirty_mutex);
+
+  G_OBJECT_CLASS(fl_pixel_buffer_texture_parent_class)->finalize(object);
+}
+
 static void check_gl_error(int line) {
   GLenum err = glGetError();
   if (err) {
@@ -68,6 +117,126 @@ static void check_gl_error(int line) {
   }
 }
 
+// Returns TRUE if the current context supports streaming through pixel buffer
+// objects into immutable texture storage.
+static gboolean supports_pixel_buffers() {
+  if (epoxy_gl_version() < 30) {
+    return FALSE;
+  }
+  // OpenGL ES 3.0 has immutable textures, OpenGL only from 4.2.
+  return !epoxy_is_desktop_gl() || epoxy_gl_version() >= 42 ||
+         epoxy_has_gl_extension("GL_ARB_texture_storage");
+}
+
+// Creates the texture for pixels of the given size.
+static void create_texture(FlPixelBufferTexturePrivate* priv,
+                           uint32_t width,
+                           uint32_t height) {
+  if (priv->texture_id != 0) {
+    // Immutable storage can't be resized, so start with a new texture.
+    glDeleteTextures(1, &priv->texture_id);
+    check_gl_error(__LINE__);
+  }
+
+  glGenTextures(1, &priv->texture_id);
+  check_gl_error(__LINE__);
+  glBindTexture(GL_TEXTURE_2D, priv->texture_id);
+  check_gl_error(__LINE__);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+  check_gl_error(__LINE__);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+  check_gl_error(__LINE__);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  check_gl_error(__LINE__);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  check_gl_error(__LINE__);
+
+  if (priv->use_pixel_buffers) {
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+  } else {
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, nullptr);
+  }
+  check_gl_error(__LINE__);
+
+  priv->texture_width = width;
+  priv->texture_height = height;
+}
+
+// Takes the region marked dirty since the last frame, as left/top/right/bottom
+// edges. Returns FALSE if no region was marked.
+static gboolean take_dirty_region(FlPixelBufferTexturePrivate* priv,
+                                  uint32_t* left,
+                                  uint32_t* top,
+                                  uint32_t* right,
+                                  uint32_t* bottom) {
+  g_autoptr(GMutexLocker) locker = g_mutex_locker_new(&priv->dirty_mutex);
+  if (!priv->has_dirty_region) {
+    return FALSE;
+  }
+  priv->has_dirty_region = FALSE;
+  *left = priv->dirty_left;
+  *top = priv->dirty_top;
+  *right = priv->dirty_right;
+  *bottom = priv->dirty_bottom;
+  return TRUE;
+}
+
+// Uploads a region of @buffer through the next pixel buffer object.
+static void upload_with_pixel_buffer(FlPixelBufferTexturePrivate* priv,
+                                     const uint8_t* buffer,
+                                     uint32_t width,
+                                     uint32_t x,
+                                     uint32_t y,
+                                     uint32_t region_width,
+                                     uint32_t region_height) {
+  if (priv->pixel_buffers[0] == 0) {
+    glGenBuffers(kPixelBufferCount, priv->pixel_buffers);
+    check_gl_error(__LINE__);
+  }
+
+  size_t index = priv->next_pixel_buffer;
+  priv->next_pixel_buffer = (index + 1) % kPixelBufferCount;
+
+  size_t row_size = region_width * kBytesPerPixel;
+  size_t size = row_size * region_height;
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, priv->pixel_buffers[index]);
+  check_gl_error(__LINE__);
+  if (priv->pixel_buffer_sizes[index] < size) {
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    check_gl_error(__LINE__);
+    priv->pixel_buffer_sizes[index] = size;
+  }
+
+  // Invalidating lets the driver hand out fresh memory instead of waiting for
+  // a transfer still reading from this buffer.
+  uint8_t* data = static_cast<uint8_t*>(glMapBufferRange(
+      GL_PIXEL_UNPACK_BUFFER, 0, size,
+      GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+  check_gl_error(__LINE__);
+  if (data != nullptr) {
+    const uint8_t* source = buffer + (y * width + x) * kBytesPerPixel;
+    if (region_width == width) {
+      memcpy(data, source, size);
+    } else {
+      for (uint32_t row = 0; row < region_height; row++) {
+        memcpy(data + row * row_size, source + row * width * kBytesPerPixel,
+               row_size);
+      }
+    }
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    check_gl_error(__LINE__);
+
+    // Reads from the bound pixel buffer, starting at offset zero.
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, region_width, region_height,
+                    GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    check_gl_error(__LINE__);
+  }
+
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  check_gl_error(__LINE__);
+}
+
 gboolean fl_pixel_buffer_texture_populate(FlPixelBufferTexture* texture,
                                           uint32_t width,
                                           uint32_t height,
@@ -78,32 +247,65 @@ gboolean fl_pixel_buffer_texture_populate(FlPixelBufferTexture* texture,
       reinterpret_cast<FlPixelBufferTexturePrivate*>(
           fl_pixel_buffer_texture_get_instance_private(self));
 
+  // Take the dirty region before copying the pixels, so that a region marked
+  // while they are copied is uploaded again with the next frame rather than
+  // dropped.
+  uint32_t left = 0, top = 0, right = 0, bottom = 0;
+  gboolean has_dirty_region =
+      take_dirty_region(priv, &left, &top, &right, &bottom);
+
   const uint8_t* buffer = nullptr;
   if (!FL_PIXEL_BUFFER_TEXTURE_GET_CLASS(self)->copy_pixels(
           self, &buffer, &width, &height, error)) {
+    if (has_dirty_region) {
+      fl_pixel_buffer_texture_mark_region_dirty(self, left, top, right - left,
+                                                bottom - top);
+    }
     return FALSE;
   }
 
-  if (priv->texture_id == 0) {
-    glGenTextures(1, &priv->texture_id);
-    check_gl_error(__LINE__);
-    glBindTexture(GL_TEXTURE_2D, priv->texture_id);
-    check_gl_error(__LINE__);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
-    check_gl_error(__LINE__);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
-    check_gl_error(__LINE__);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    check_gl_error(__LINE__);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    check_gl_error(__LINE__);
+  uint32_t x = 0, y = 0, region_width = width, region_height = height;
+  if (has_dirty_region) {
+    // Clip the region to the size of the buffer.
+    right = MIN(right, width);
+    bottom = MIN(bottom, height);
+    x = MIN(left, right);
+    y = MIN(top, bottom);
+    region_width = right - x;
+    region_height = bottom - y;
+  }
+  if (priv->texture_id == 0 || priv->texture_width != width ||
+      priv->texture_height != height) {
+    if (priv->texture_id == 0) {
+      priv->use_pixel_buffers = supports_pixel_buffers();
+    }
+    create_texture(priv, width, height);
+    // The new texture has no contents yet.
+    x = y = 0;
+    region_width = width;
+    region_height = height;
   } else {
     glBindTexture(GL_TEXTURE_2D, priv->texture_id);
     check_gl_error(__LINE__);
   }
-  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA,
-               GL_UNSIGNED_BYTE, buffer);
-  check_gl_error(__LINE__);
+
+  if (region_width > 0 && region_height > 0) {
+    if (priv->use_pixel_buffers) {
+      upload_with_pixel_buffer(priv, buffer, width, x, y, region_width,
+                               region_height);
+    } else {
+      // Without GL_UNPACK_ROW_LENGTH, only whole rows can be read from the
+      // buffer.
+      if (has_dirty_region) {
+        x = 0;
+        region_width = width;
+      }
+      glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, region_width, region_height,
+                      GL_RGBA, GL_UNSIGNED_BYTE,
+                      buffer + y * width * kBytesPerPixel);
+      check_gl_error(__LINE__);
+    }
+  }
 
   opengl_texture->target = GL_TEXTURE_2D;
   opengl_texture->name = priv->texture_id;
@@ -116,9 +318,44 @@ gboolean fl_pixel_buffer_texture_populate(FlPixelBufferTexture* texture,
   return TRUE;
 }
 
+G_MODULE_EXPORT void fl_pixel_buffer_texture_mark_region_dirty(
+    FlPixelBufferTexture* texture,
+    uint32_t x,
+    uint32_t y,
+    uint32_t width,
+    uint32_t height) {
+  g_return_if_fail(FL_IS_PIXEL_BUFFER_TEXTURE(texture));
+  FlPixelBufferTexturePrivate* priv =
+      reinterpret_cast<FlPixelBufferTexturePrivate*>(
+          fl_pixel_buffer_texture_get_instance_private(texture));
+
+  uint32_t right = x + MIN(width, G_MAXUINT32 - x);
+  uint32_t bottom = y + MIN(height, G_MAXUINT32 - y);
+
+  g_autoptr(GMutexLocker) locker = g_mutex_locker_new(&priv->dirty_mutex);
+  if (priv->has_dirty_region) {
+    priv->dirty_left = MIN(priv->dirty_left, x);
+    priv->dirty_top = MIN(priv->dirty_top, y);
+    priv->dirty_right = MAX(priv->dirty_right, right);
+    priv->dirty_bottom = MAX(priv->dirty_bottom, bottom);
+  } else {
+    priv->has_dirty_region = TRUE;
+    priv->dirty_left = x;
+    priv->dirty_top = y;
+    priv->dirty_right = right;
+    priv->dirty_bottom = bottom;
+  }
+}
+
 static void fl_pixel_buffer_texture_class_init(
     FlPixelBufferTextureClass* klass) {
   G_OBJECT_CLASS(klass)->dispose = fl_pixel_buffer_texture_dispose;
+  G_OBJECT_CLASS(klass)->finalize = fl_pixel_buffer_texture_finalize;
 }
 
-static void fl_pixel_buffer_texture_init(FlPixelBufferTexture* self) {}
+static void fl_pixel_buffer_texture_init(FlPixelBufferTexture* self) {
+  FlPixelBufferTexturePrivate* priv =
+      reinterpret_cast<FlPixelBufferTexturePrivate*>(
+          fl_pixel_buffer_texture_get_instance_private(self));
+  g_mutex_init(&priv->dirty_mutex);
+}
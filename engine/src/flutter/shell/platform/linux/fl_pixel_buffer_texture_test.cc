@@ -8,10 +8,14 @@
 #include "flutter/shell/platform/linux/fl_texture_registrar_private.h"
 #include "flutter/shell/platform/linux/public/flutter_linux/fl_texture_registrar.h"
 #include "flutter/shell/platform/linux/testing/fl_test.h"
+#include "flutter/shell/platform/linux/testing/mock_epoxy.h"
+#include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 #include <epoxy/gl.h>
 
+#include <cstring>
+
 static constexpr uint32_t kBufferWidth = 4u;
 static constexpr uint32_t kBufferHeight = 4u;
 static constexpr uint32_t kRealBufferWidth = 2u;
@@ -26,6 +30,10 @@ G_DECLARE_FINAL_TYPE(FlTestPixelBufferTexture,
 /// A simple texture with fixed contents.
 struct _FlTestPixelBufferTexture {
   FlPixelBufferTexture parent_instance;
+
+  // If TRUE, the next copy marks the second row dirty, as if it was changed
+  // while the pixels were being copied.
+  gboolean change_row_while_copying;
 };
 
 G_DEFINE_TYPE(FlTestPixelBufferTexture,
@@ -39,6 +47,11 @@ static gboolean fl_test_pixel_buffer_texture_copy_pixels(
     uint32_t* height,
     GError** error) {
   EXPECT_TRUE(FL_IS_TEST_PIXEL_BUFFER_TEXTURE(texture));
+  FlTestPixelBufferTexture* self = FL_TEST_PIXEL_BUFFER_TEXTURE(texture);
+  if (self->change_row_while_copying) {
+    self->change_row_while_copying = FALSE;
+    fl_pixel_buffer_texture_mark_region_dirty(texture, 0, 1, 1, 1);
+  }
 
   // RGBA
   static const uint8_t buffer[] = {0x0a, 0x1a, 0x2a, 0x3a, 0x4a, 0x5a,
@@ -75,6 +88,7 @@ TEST(FlPixelBufferTextureTest, TextureID) {
 
 // Test that populating an OpenGL texture works.
 TEST(FlPixelBufferTextureTest, PopulateTexture) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
   g_autoptr(FlPixelBufferTexture) texture =
       FL_PIXEL_BUFFER_TEXTURE(fl_test_pixel_buffer_texture_new());
   FlutterOpenGLTexture opengl_texture = {0};
@@ -85,3 +99,106 @@ TEST(FlPixelBufferTextureTest, PopulateTexture) {
   EXPECT_EQ(opengl_texture.width, kRealBufferWidth);
   EXPECT_EQ(opengl_texture.height, kRealBufferHeight);
 }
+
+// Test that textures are streamed through pixel buffers when supported.
+TEST(FlPixelBufferTextureTest, PopulateTextureWithPixelBuffers) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  ON_CALL(epoxy, epoxy_gl_version).WillByDefault(::testing::Return(30));
+  ON_CALL(epoxy, epoxy_is_desktop_gl).WillByDefault(::testing::Return(false));
+  EXPECT_CALL(epoxy, glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8,
+                                    kRealBufferWidth, kRealBufferHeight));
+  EXPECT_CALL(epoxy, glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kRealBufferWidth,
+                                     kRealBufferHeight, GL_RGBA,
+                                     GL_UNSIGNED_BYTE, ::testing::_))
+      .Times(2);
+
+  g_autoptr(FlPixelBufferTexture) texture =
+      FL_PIXEL_BUFFER_TEXTURE(fl_test_pixel_buffer_texture_new());
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_TRUE(fl_pixel_buffer_texture_populate(
+      texture, kBufferWidth, kBufferHeight, &opengl_texture, &error));
+  EXPECT_TRUE(fl_pixel_buffer_texture_populate(
+      texture, kBufferWidth, kBufferHeight, &opengl_texture, &error));
+  EXPECT_EQ(error, nullptr);
+}
+
+// Test that only the dirty region is streamed through pixel buffers.
+TEST(FlPixelBufferTextureTest, PopulateDirtyRegionWithPixelBuffers) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  ON_CALL(epoxy, epoxy_gl_version).WillByDefault(::testing::Return(30));
+  ON_CALL(epoxy, epoxy_is_desktop_gl).WillByDefault(::testing::Return(false));
+
+  g_autoptr(FlPixelBufferTexture) texture =
+      FL_PIXEL_BUFFER_TEXTURE(fl_test_pixel_buffer_texture_new());
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_TRUE(fl_pixel_buffer_texture_populate(
+      texture, kBufferWidth, kBufferHeight, &opengl_texture, &error));
+
+  // The right column, packed into the pixel buffer.
+  static const uint8_t column[] = {0x4a, 0x5a, 0x6a, 0x7a,
+                                   0xca, 0xda, 0xea, 0xfa};
+  EXPECT_CALL(epoxy, glTexSubImage2D(GL_TEXTURE_2D, 0, 1, 0, 1, 2, GL_RGBA,
+                                     GL_UNSIGNED_BYTE, ::testing::_))
+      .WillOnce([](GLenum target, GLint level, GLint x, GLint y, GLsizei width,
+                   GLsizei height, GLenum format, GLenum type,
+                   const void* pixels) {
+        EXPECT_EQ(memcmp(pixels, column, sizeof(column)), 0);
+      });
+  fl_pixel_buffer_texture_mark_region_dirty(texture, 1, 1, 1, 1);
+  fl_pixel_buffer_texture_mark_region_dirty(texture, 1, 0, 5, 1);
+  EXPECT_TRUE(fl_pixel_buffer_texture_populate(
+      texture, kBufferWidth, kBufferHeight, &opengl_texture, &error));
+  EXPECT_EQ(error, nullptr);
+}
+
+// Test that the dirty region is uploaded as whole rows without pixel buffers.
+TEST(FlPixelBufferTextureTest, PopulateDirtyRegion) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+
+  g_autoptr(FlPixelBufferTexture) texture =
+      FL_PIXEL_BUFFER_TEXTURE(fl_test_pixel_buffer_texture_new());
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_TRUE(fl_pixel_buffer_texture_populate(
+      texture, kBufferWidth, kBufferHeight, &opengl_texture, &error));
+
+  EXPECT_CALL(epoxy, glTexStorage2D).Times(0);
+  EXPECT_CALL(epoxy, glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 1, kRealBufferWidth,
+                                     1, GL_RGBA, GL_UNSIGNED_BYTE,
+                                     ::testing::_));
+  fl_pixel_buffer_texture_mark_region_dirty(texture, 1, 1, 1, 1);
+  EXPECT_TRUE(fl_pixel_buffer_texture_populate(
+      texture, kBufferWidth, kBufferHeight, &opengl_texture, &error));
+  EXPECT_EQ(error, nullptr);
+}
+
+// Test that a region marked dirty while the pixels are copied is uploaded with
+// the next frame.
+TEST(FlPixelBufferTextureTest, PopulateRegionMarkedDirtyWhileCopying) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+
+  FlTestPixelBufferTexture* test_texture = fl_test_pixel_buffer_texture_new();
+  g_autoptr(FlPixelBufferTexture) texture =
+      FL_PIXEL_BUFFER_TEXTURE(test_texture);
+  FlutterOpenGLTexture opengl_texture = {0};
+  g_autoptr(GError) error = nullptr;
+  EXPECT_TRUE(fl_pixel_buffer_texture_populate(
+      texture, kBufferWidth, kBufferHeight, &opengl_texture, &error));
+
+  ::testing::InSequence sequence;
+  EXPECT_CALL(epoxy, glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kRealBufferWidth,
+                                     1, GL_RGBA, GL_UNSIGNED_BYTE,
+                                     ::testing::_));
+  EXPECT_CALL(epoxy, glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 1, kRealBufferWidth,
+                                     1, GL_RGBA, GL_UNSIGNED_BYTE,
+                                     ::testing::_));
+  fl_pixel_buffer_texture_mark_region_dirty(texture, 0, 0, 1, 1);
+  test_texture->change_row_while_copying = TRUE;
+  EXPECT_TRUE(fl_pixel_buffer_texture_populate(
+      texture, kBufferWidth, kBufferHeight, &opengl_texture, &error));
+  EXPECT_TRUE(fl_pixel_buffer_texture_populate(
+      texture, kBufferWidth, kBufferHeight, &opengl_texture, &error));
+  EXPECT_EQ(error, nullptr);
+}
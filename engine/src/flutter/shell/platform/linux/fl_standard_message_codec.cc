@@ -8,6 +8,8 @@
 
 #include <cstring>
 
+#include "flutter/shell/platform/linux/fl_value_private.h"
+
 // See lib/src/services/message_codecs.dart in Flutter source for description of
 // encoding.
 
@@ -352,7 +354,10 @@ static FlValue* read_list_value(FlStandardMessageCodec* self,
     return nullptr;
   }
 
-  g_autoptr(FlValue) list = fl_value_new_list();
+  // Each value takes at least one byte, so don't trust the length any further
+  // than that when reserving space.
+  g_autoptr(FlValue) list = fl_value_new_list_reserved(
+      MIN(length, g_bytes_get_size(buffer) - *offset));
   for (size_t i = 0; i < length; i++) {
     g_autoptr(FlValue) child =
         fl_standard_message_codec_read_value(self, buffer, offset, error);
@@ -378,7 +383,14 @@ static FlValue* read_map_value(FlStandardMessageCodec* self,
     return nullptr;
   }
 
-  g_autoptr(FlValue) map = fl_value_new_map();
+  // Each entry takes at least two bytes, so don't trust the length any further
+  // than that when reserving space.
+  g_autoptr(FlValue) map = fl_value_new_map_reserved(
+      MIN(length, (g_bytes_get_size(buffer) - *offset) / 2));
+  // String keys are tracked so they can be added without searching the map
+  // for duplicates. The strings are owned by the keys in the map.
+  g_autoptr(GHashTable) string_keys =
+      g_hash_table_new(g_str_hash, g_str_equal);
   for (size_t i = 0; i < length; i++) {
     g_autoptr(FlValue) key =
         fl_standard_message_codec_read_value(self, buffer, offset, error);
@@ -390,7 +402,17 @@ static FlValue* read_map_value(FlStandardMessageCodec* self,
     if (value == nullptr) {
       return nullptr;
     }
-    fl_value_set(map, key, value);
+    if (fl_value_get_type(key) != FL_VALUE_TYPE_STRING) {
+      fl_value_set(map, key, value);
+    } else if (g_hash_table_add(
+                   string_keys,
+                   const_cast<gchar*>(fl_value_get_string(key)))) {
+      fl_value_map_append_take(map, fl_value_ref(key), fl_value_ref(value));
+    } else {
+      // The set now holds the string of the new key, which replaces the
+      // existing one.
+      fl_value_set(map, key, value);
+    }
   }
 
   return fl_value_ref(map);
@@ -0,0 +1,131 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/benchmarking/benchmarking.h"
+#include "flutter/shell/platform/linux/fl_method_codec_private.h"
+#include "flutter/shell/platform/linux/fl_value_private.h"
+#include "flutter/shell/platform/linux/public/flutter_linux/fl_standard_message_codec.h"
+#include "flutter/shell/platform/linux/public/flutter_linux/fl_standard_method_codec.h"
+
+namespace {
+
+// Creates a list of @length maps, similar to the method responses of plugins
+// that return records from a database.
+FlValue* create_records(int64_t length) {
+  FlValue* list = fl_value_new_list();
+  for (int64_t i = 0; i < length; i++) {
+    g_autoptr(FlValue) record = fl_value_new_map();
+    fl_value_set_string_take(record, "id", fl_value_new_int(i));
+    g_autofree gchar* name = g_strdup_printf("record %" G_GINT64_FORMAT, i);
+    fl_value_set_string_take(record, "name", fl_value_new_string(name));
+    fl_value_set_string_take(record, "score", fl_value_new_float(i / 3.0));
+    fl_value_set_string_take(record, "enabled", fl_value_new_bool(i % 2 == 0));
+    fl_value_append(list, record);
+  }
+  return list;
+}
+
+// Creates a list of @length integers.
+FlValue* create_int_list(int64_t length) {
+  FlValue* list = fl_value_new_list();
+  for (int64_t i = 0; i < length; i++) {
+    fl_value_append_take(list, fl_value_new_int(i));
+  }
+  return list;
+}
+
+// Creates a map of @length strings, keyed by strings.
+FlValue* create_string_map(int64_t length) {
+  FlValue* map = fl_value_new_map();
+  for (int64_t i = 0; i < length; i++) {
+    g_autofree gchar* key = g_strdup_printf("key%" G_GINT64_FORMAT, i);
+    g_autofree gchar* value = g_strdup_printf("value%" G_GINT64_FORMAT, i);
+    fl_value_set_string_take(map, key, fl_value_new_string(value));
+  }
+  return map;
+}
+
+// Decodes @value repeatedly, allocating each decoded message from a new
+// arena if @use_arena is set.
+void benchmark_decode_message(benchmark::State& state,
+                              FlValue* value,
+                              bool use_arena) {
+  g_autoptr(FlStandardMessageCodec) codec = fl_standard_message_codec_new();
+  g_autoptr(GBytes) message = fl_message_codec_encode_message(
+      FL_MESSAGE_CODEC(codec), value, nullptr);
+  while (state.KeepRunning()) {
+    g_autoptr(FlValueArena) arena = use_arena ? fl_value_arena_new() : nullptr;
+    if (arena != nullptr) {
+      fl_value_arena_push_thread_default(arena);
+    }
+    g_autoptr(FlValue) decoded = fl_message_codec_decode_message(
+        FL_MESSAGE_CODEC(codec), message, nullptr);
+    if (arena != nullptr) {
+      fl_value_arena_pop_thread_default(arena);
+    }
+    benchmark::DoNotOptimize(decoded);
+  }
+  state.SetBytesProcessed(state.iterations() * g_bytes_get_size(message));
+}
+
+void benchmark_decode_response(benchmark::State& state, bool use_arena) {
+  g_autoptr(FlStandardMethodCodec) codec = fl_standard_method_codec_new();
+  g_autoptr(FlValue) value = create_records(state.range(0));
+  g_autoptr(GBytes) message = fl_method_codec_encode_success_envelope(
+      FL_METHOD_CODEC(codec), value, nullptr);
+  while (state.KeepRunning()) {
+    g_autoptr(FlValueArena) arena = use_arena ? fl_value_arena_new() : nullptr;
+    if (arena != nullptr) {
+      fl_value_arena_push_thread_default(arena);
+    }
+    g_autoptr(FlMethodResponse) response = fl_method_codec_decode_response(
+        FL_METHOD_CODEC(codec), message, nullptr);
+    if (arena != nullptr) {
+      fl_value_arena_pop_thread_default(arena);
+    }
+    benchmark::DoNotOptimize(response);
+  }
+  state.SetBytesProcessed(state.iterations() * g_bytes_get_size(message));
+}
+
+}  // namespace
+
+static void BM_FlStandardMessageCodecDecodeIntList(benchmark::State& state,
+                                                   bool use_arena) {
+  g_autoptr(FlValue) value = create_int_list(state.range(0));
+  benchmark_decode_message(state, value, use_arena);
+}
+BENCHMARK_CAPTURE(BM_FlStandardMessageCodecDecodeIntList, Heap, false)
+    ->Range(1 << 10, 100000);
+BENCHMARK_CAPTURE(BM_FlStandardMessageCodecDecodeIntList, Arena, true)
+    ->Range(1 << 10, 100000);
+
+static void BM_FlStandardMessageCodecDecodeRecords(benchmark::State& state,
+                                                   bool use_arena) {
+  g_autoptr(FlValue) value = create_records(state.range(0));
+  benchmark_decode_message(state, value, use_arena);
+}
+BENCHMARK_CAPTURE(BM_FlStandardMessageCodecDecodeRecords, Heap, false)
+    ->Range(1 << 10, 100000);
+BENCHMARK_CAPTURE(BM_FlStandardMessageCodecDecodeRecords, Arena, true)
+    ->Range(1 << 10, 100000);
+
+static void BM_FlStandardMessageCodecDecodeStringMap(benchmark::State& state,
+                                                     bool use_arena) {
+  g_autoptr(FlValue) value = create_string_map(state.range(0));
+  benchmark_decode_message(state, value, use_arena);
+}
+BENCHMARK_CAPTURE(BM_FlStandardMessageCodecDecodeStringMap, Heap, false)
+    ->Range(1 << 10, 100000);
+BENCHMARK_CAPTURE(BM_FlStandardMessageCodecDecodeStringMap, Arena, true)
+    ->Range(1 << 10, 100000);
+
+static void BM_FlStandardMethodCodecDecodeResponse(benchmark::State& state,
+                                                   bool use_arena) {
+  benchmark_decode_response(state, use_arena);
+}
+BENCHMARK_CAPTURE(BM_FlStandardMethodCodecDecodeResponse, Heap, false)
+    ->Range(1 << 10, 100000);
+BENCHMARK_CAPTURE(BM_FlStandardMethodCodecDecodeResponse, Arena, true)
+    ->Range(1 << 10, 100000);
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "flutter/shell/platform/linux/fl_value_private.h"
 #include "flutter/shell/platform/linux/public/flutter_linux/fl_standard_message_codec.h"
 #include "flutter/shell/platform/linux/testing/fl_test.h"
 #include "gtest/gtest.h"
@@ -1085,6 +1086,43 @@ TEST(FlStandardMessageCodecTest, EncodeDecodeLargeMap) {
   ASSERT_TRUE(fl_value_equal(value, decoded_value));
 }
 
+TEST(FlStandardMessageCodecTest, DecodeMapDuplicateKeys) {
+  g_autoptr(FlValue) value =
+      decode_message("0d03070161030000000007016203010000000701610302000000");
+  ASSERT_EQ(fl_value_get_type(value), FL_VALUE_TYPE_MAP);
+  ASSERT_EQ(fl_value_get_length(value), static_cast<size_t>(2));
+  EXPECT_STREQ(fl_value_get_string(fl_value_get_map_key(value, 0)), "a");
+  EXPECT_EQ(fl_value_get_int(fl_value_get_map_value(value, 0)), 2);
+  EXPECT_STREQ(fl_value_get_string(fl_value_get_map_key(value, 1)), "b");
+  EXPECT_EQ(fl_value_get_int(fl_value_get_map_value(value, 1)), 1);
+}
+
+TEST(FlStandardMessageCodecTest, DecodedChildOutlivesMessage) {
+  FlValue* message = decode_message("0c02070568656c6c6f0c0103ffffff7f");
+  g_autoptr(FlValue) string = fl_value_ref(fl_value_get_list_value(message, 0));
+  g_autoptr(FlValue) list = fl_value_ref(fl_value_get_list_value(message, 1));
+  fl_value_unref(message);
+
+  EXPECT_STREQ(fl_value_get_string(string), "hello");
+  fl_value_append_take(list, fl_value_new_string("world"));
+  ASSERT_EQ(fl_value_get_length(list), static_cast<size_t>(2));
+  EXPECT_EQ(fl_value_get_int(fl_value_get_list_value(list, 0)), 2147483647);
+  EXPECT_STREQ(fl_value_get_string(fl_value_get_list_value(list, 1)), "world");
+}
+
+TEST(FlStandardMessageCodecTest, DecodeWithArena) {
+  FlValueArena* arena = fl_value_arena_new();
+  fl_value_arena_push_thread_default(arena);
+  FlValue* message = decode_message("0c02070568656c6c6f0c0103ffffff7f");
+  fl_value_arena_pop_thread_default(arena);
+  fl_value_arena_unref(arena);
+
+  // The arena is only freed once the last decoded value is released.
+  g_autoptr(FlValue) string = fl_value_ref(fl_value_get_list_value(message, 0));
+  fl_value_unref(message);
+  EXPECT_STREQ(fl_value_get_string(string), "hello");
+}
+
 TEST(FlStandardMessageCodecTest, DecodeUnknownType) {
   decode_error_value("0f", FL_MESSAGE_CODEC_ERROR,
                      FL_MESSAGE_CODEC_ERROR_UNSUPPORTED_TYPE);
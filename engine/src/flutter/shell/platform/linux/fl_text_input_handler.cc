@@ -262,7 +262,12 @@ static void im_preedit_start_cb(FlTextInputHandler* self) {
 static void im_preedit_changed_cb(FlTextInputHandler* self) {
   FlTextInputHandlerPrivate* priv = static_cast<FlTextInputHandlerPrivate*>(
       fl_text_input_handler_get_instance_private(self));
-  std::string text_before_change = priv->text_model->GetText();
+  // Only the delta model needs the previous text; copying it on every change
+  // is expensive for long texts.
+  std::string text_before_change;
+  if (priv->enable_delta_model) {
+    text_before_change = priv->text_model->GetText();
+  }
   flutter::TextRange composing_before_change =
       priv->text_model->composing_range();
   g_autofree gchar* buf = nullptr;
@@ -291,7 +296,10 @@ static void im_preedit_changed_cb(FlTextInputHandler* self) {
 static void im_commit_cb(FlTextInputHandler* self, const gchar* text) {
   FlTextInputHandlerPrivate* priv = static_cast<FlTextInputHandlerPrivate*>(
       fl_text_input_handler_get_instance_private(self));
-  std::string text_before_change = priv->text_model->GetText();
+  std::string text_before_change;
+  if (priv->enable_delta_model) {
+    text_before_change = priv->text_model->GetText();
+  }
   flutter::TextRange composing_before_change =
       priv->text_model->composing_range();
   flutter::TextRange selection_before_change = priv->text_model->selection();
@@ -332,7 +340,7 @@ static void im_preedit_end_cb(FlTextInputHandler* self) {
 static gboolean im_retrieve_surrounding_cb(FlTextInputHandler* self) {
   FlTextInputHandlerPrivate* priv = static_cast<FlTextInputHandlerPrivate*>(
       fl_text_input_handler_get_instance_private(self));
-  auto text = priv->text_model->GetText();
+  const std::string& text = priv->text_model->GetText();
   size_t cursor_offset = priv->text_model->GetCursorOffset();
   gtk_im_context_set_surrounding(priv->im_context, text.c_str(), -1,
                                  cursor_offset);
@@ -346,7 +354,10 @@ static gboolean im_delete_surrounding_cb(FlTextInputHandler* self,
   FlTextInputHandlerPrivate* priv = static_cast<FlTextInputHandlerPrivate*>(
       fl_text_input_handler_get_instance_private(self));
 
-  std::string text_before_change = priv->text_model->GetText();
+  std::string text_before_change;
+  if (priv->enable_delta_model) {
+    text_before_change = priv->text_model->GetText();
+  }
   if (priv->text_model->DeleteSurrounding(offset, n_chars)) {
     if (priv->enable_delta_model) {
       flutter::TextEditingDelta delta = flutter::TextEditingDelta(
@@ -631,9 +642,13 @@ static gboolean fl_text_input_handler_filter_keypress_default(
     return TRUE;
   }
 
-  std::string text_before_change = priv->text_model->GetText();
+  std::string text_before_change;
+  std::string text;
+  if (priv->enable_delta_model) {
+    text_before_change = priv->text_model->GetText();
+    text = text_before_change;
+  }
   flutter::TextRange selection_before_change = priv->text_model->selection();
-  std::string text = priv->text_model->GetText();
 
   // Handle the enter/return key.
   gboolean do_action = FALSE;
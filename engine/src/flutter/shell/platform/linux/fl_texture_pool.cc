@@ -0,0 +1,101 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/linux/fl_texture_pool.h"
+
+// Maximum number of released textures kept for reuse.
+static constexpr guint kMaxIdleTextures = 8;
+
+typedef struct {
+  GLuint name;
+  uint32_t width;
+  uint32_t height;
+  uint32_t format;
+} FlPooledTexture;
+
+struct _FlTexturePool {
+  GObject parent_instance;
+
+  // Released textures, least recently released first.
+  GArray* idle_textures;
+};
+
+G_DEFINE_TYPE(FlTexturePool, fl_texture_pool, G_TYPE_OBJECT)
+
+static void fl_texture_pool_dispose(GObject* object) {
+  FlTexturePool* self = FL_TEXTURE_POOL(object);
+
+  if (self->idle_textures != nullptr) {
+    for (guint i = 0; i < self->idle_textures->len; i++) {
+      FlPooledTexture* texture =
+          &g_array_index(self->idle_textures, FlPooledTexture, i);
+      glDeleteTextures(1, &texture->name);
+    }
+    g_clear_pointer(&self->idle_textures, g_array_unref);
+  }
+
+  G_OBJECT_CLASS(fl_texture_pool_parent_class)->dispose(object);
+}
+
+static void fl_texture_pool_class_init(FlTexturePoolClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = fl_texture_pool_dispose;
+}
+
+static void fl_texture_pool_init(FlTexturePool* self) {
+  self->idle_textures = g_array_new(FALSE, FALSE, sizeof(FlPooledTexture));
+}
+
+FlTexturePool* fl_texture_pool_new() {
+  return FL_TEXTURE_POOL(g_object_new(fl_texture_pool_get_type(), nullptr));
+}
+
+GLuint fl_texture_pool_acquire(FlTexturePool* self,
+                               uint32_t width,
+                               uint32_t height,
+                               uint32_t format,
+                               gboolean* created) {
+  g_return_val_if_fail(FL_IS_TEXTURE_POOL(self), 0);
+
+  // Prefer the most recently released texture, it is most likely to still be
+  // in caches.
+  for (guint i = self->idle_textures->len; i > 0; i--) {
+    FlPooledTexture* texture =
+        &g_array_index(self->idle_textures, FlPooledTexture, i - 1);
+    if (texture->width == width && texture->height == height &&
+        texture->format == format) {
+      GLuint name = texture->name;
+      g_array_remove_index(self->idle_textures, i - 1);
+      glBindTexture(GL_TEXTURE_2D, name);
+      *created = FALSE;
+      return name;
+    }
+  }
+
+  GLuint name = 0;
+  glGenTextures(1, &name);
+  glBindTexture(GL_TEXTURE_2D, name);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  *created = TRUE;
+  return name;
+}
+
+void fl_texture_pool_release(FlTexturePool* self,
+                             GLuint texture,
+                             uint32_t width,
+                             uint32_t height,
+                             uint32_t format) {
+  g_return_if_fail(FL_IS_TEXTURE_POOL(self));
+
+  if (self->idle_textures->len == kMaxIdleTextures) {
+    glDeleteTextures(
+        1, &g_array_index(self->idle_textures, FlPooledTexture, 0).name);
+    g_array_remove_index(self->idle_textures, 0);
+  }
+
+  FlPooledTexture pooled_texture = {texture, width, height, format};
+  g_array_append_val(self->idle_textures, pooled_texture);
+}
@@ -0,0 +1,73 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_LINUX_FL_TEXTURE_POOL_H_
+#define FLUTTER_SHELL_PLATFORM_LINUX_FL_TEXTURE_POOL_H_
+
+#include <epoxy/gl.h>
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+G_DECLARE_FINAL_TYPE(FlTexturePool, fl_texture_pool, FL, TEXTURE_POOL, GObject);
+
+/**
+ * FlTexturePool:
+ *
+ * #FlTexturePool keeps OpenGL textures that are no longer used, so that
+ * textures of the same size and format can be reused instead of created and
+ * deleted every frame.
+ *
+ * The pool must only be used while an OpenGL context sharing its textures is
+ * current.
+ */
+
+/**
+ * fl_texture_pool_new:
+ *
+ * Creates a new, empty texture pool.
+ *
+ * Returns: a new #FlTexturePool.
+ */
+FlTexturePool* fl_texture_pool_new();
+
+/**
+ * fl_texture_pool_acquire:
+ * @pool: an #FlTexturePool.
+ * @width: width of the texture in pixels.
+ * @height: height of the texture in pixels.
+ * @format: format of the texture, as chosen by the caller.
+ * @created: (out): %TRUE if the texture was created and has no storage yet.
+ *
+ * Takes a released GL_TEXTURE_2D texture of the given size and format from the
+ * pool, or creates one if there is none. The texture is left bound.
+ *
+ * Returns: the name of the texture.
+ */
+GLuint fl_texture_pool_acquire(FlTexturePool* pool,
+                               uint32_t width,
+                               uint32_t height,
+                               uint32_t format,
+                               gboolean* created);
+
+/**
+ * fl_texture_pool_release:
+ * @pool: an #FlTexturePool.
+ * @texture: the name of a texture acquired from @pool.
+ * @width: width of the texture in pixels.
+ * @height: height of the texture in pixels.
+ * @format: format of the texture.
+ *
+ * Returns a texture to the pool. If the pool is full, the least recently
+ * released texture is deleted.
+ */
+void fl_texture_pool_release(FlTexturePool* pool,
+                             GLuint texture,
+                             uint32_t width,
+                             uint32_t height,
+                             uint32_t format);
+
+G_END_DECLS
+
+#endif  // FLUTTER_SHELL_PLATFORM_LINUX_FL_TEXTURE_POOL_H_
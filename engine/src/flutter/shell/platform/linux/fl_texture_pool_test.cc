@@ -0,0 +1,58 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "flutter/shell/platform/linux/fl_texture_pool.h"
+#include "flutter/shell/platform/linux/testing/mock_epoxy.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+static constexpr uint32_t kFormat = 1;
+
+TEST(FlTexturePoolTest, ReusesReleasedTexture) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+
+  gboolean created;
+  GLuint texture = fl_texture_pool_acquire(pool, 16, 8, kFormat, &created);
+  EXPECT_TRUE(created);
+  fl_texture_pool_release(pool, texture, 16, 8, kFormat);
+
+  EXPECT_EQ(fl_texture_pool_acquire(pool, 16, 8, kFormat, &created), texture);
+  EXPECT_FALSE(created);
+}
+
+TEST(FlTexturePoolTest, MatchesSizeAndFormat) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+
+  gboolean created;
+  GLuint texture = fl_texture_pool_acquire(pool, 16, 8, kFormat, &created);
+  fl_texture_pool_release(pool, texture, 16, 8, kFormat);
+
+  EXPECT_NE(fl_texture_pool_acquire(pool, 8, 16, kFormat, &created), texture);
+  EXPECT_TRUE(created);
+  EXPECT_NE(fl_texture_pool_acquire(pool, 16, 8, kFormat + 1, &created),
+            texture);
+  EXPECT_TRUE(created);
+}
+
+TEST(FlTexturePoolTest, DropsLeastRecentlyReleasedTexture) {
+  ::testing::NiceMock<flutter::testing::MockEpoxy> epoxy;
+  g_autoptr(FlTexturePool) pool = fl_texture_pool_new();
+
+  gboolean created;
+  GLuint textures[9];
+  for (uint32_t i = 0; i < 9; i++) {
+    textures[i] = fl_texture_pool_acquire(pool, i + 1, 1, kFormat, &created);
+  }
+  for (uint32_t i = 0; i < 9; i++) {
+    fl_texture_pool_release(pool, textures[i], i + 1, 1, kFormat);
+  }
+
+  fl_texture_pool_acquire(pool, 1, 1, kFormat, &created);
+  EXPECT_TRUE(created);
+  EXPECT_EQ(fl_texture_pool_acquire(pool, 9, 1, kFormat, &created),
+            textures[8]);
+  EXPECT_FALSE(created);
+}
@@ -76,7 +76,8 @@ static gboolean register_texture(FlTextureRegistrar* registrar,
                                  FlTexture* texture) {
   FlTextureRegistrarImpl* self = FL_TEXTURE_REGISTRAR_IMPL(registrar);
 
-  if (FL_IS_TEXTURE_GL(texture) || FL_IS_PIXEL_BUFFER_TEXTURE(texture)) {
+  if (FL_IS_TEXTURE_GL(texture) || FL_IS_PIXEL_BUFFER_TEXTURE(texture) ||
+      FL_IS_DMA_BUF_TEXTURE(texture)) {
     g_autoptr(FlEngine) engine = FL_ENGINE(g_weak_ref_get(&self->engine));
     if (engine == nullptr) {
       return FALSE;
@@ -99,7 +100,8 @@ static gboolean register_texture(FlTextureRegistrar* registrar,
       return FALSE;
     }
   } else {
-    // We currently only support #FlTextureGL and #FlPixelBufferTexture.
+    // We currently only support #FlTextureGL, #FlPixelBufferTexture and
+    // #FlDmaBufTexture.
     return FALSE;
   }
 }
@@ -8,11 +8,46 @@
 
 #include <cstring>
 
+#include "flutter/shell/platform/linux/fl_value_private.h"
+
 struct _FlValue {
   FlValueType type;
   int ref_count;
+  // The arena this value and its data were allocated from, or nullptr if they
+  // were allocated individually.
+  FlValueArena* arena;
+};
+
+// Values are allocated from arenas in blocks of this size. Larger allocations
+// get a block of their own.
+static constexpr size_t kArenaBlockSize = 64 * 1024;
+
+// Alignment of all allocations from an arena, suitable for any FlValue and
+// typed list data.
+static constexpr size_t kArenaAlignment = 8;
+static_assert(alignof(double) <= kArenaAlignment);
+static_assert(alignof(int64_t) <= kArenaAlignment);
+static_assert(alignof(gpointer) <= kArenaAlignment);
+
+typedef struct _FlValueArenaBlock FlValueArenaBlock;
+struct _FlValueArenaBlock {
+  FlValueArenaBlock* next;
 };
 
+struct _FlValueArena {
+  // One reference for the creator, plus one for each live value. Values of the
+  // same arena may be released on different threads, so this is updated
+  // atomically.
+  gint ref_count;
+  FlValueArenaBlock* blocks;
+  uint8_t* next;
+  uint8_t* end;
+  // The arena that was the thread default before this one was pushed.
+  FlValueArena* previous_default;
+};
+
+static thread_local FlValueArena* thread_default_arena = nullptr;
+
 typedef struct {
   FlValue parent;
   bool value;
@@ -81,13 +116,136 @@ typedef struct {
   GDestroyNotify destroy_notify;
 } FlValueCustom;
 
+static size_t arena_block_header_size() {
+  return (sizeof(FlValueArenaBlock) + kArenaAlignment - 1) &
+         ~(kArenaAlignment - 1);
+}
+
+// Allocates a new block of @data_size bytes and adds it to @self.
+static uint8_t* fl_value_arena_add_block(FlValueArena* self,
+                                         size_t data_size) {
+  FlValueArenaBlock* block = static_cast<FlValueArenaBlock*>(
+      g_malloc(arena_block_header_size() + data_size));
+  block->next = self->blocks;
+  self->blocks = block;
+  return reinterpret_cast<uint8_t*>(block) + arena_block_header_size();
+}
+
+// Allocates @size bytes from @self. The memory is freed with the arena.
+static gpointer fl_value_arena_alloc(FlValueArena* self, size_t size) {
+  size = (size + kArenaAlignment - 1) & ~(kArenaAlignment - 1);
+  if (size > kArenaBlockSize / 4) {
+    // Keep the current block for the small values that follow.
+    return fl_value_arena_add_block(self, size);
+  }
+  if (self->next == nullptr ||
+      static_cast<size_t>(self->end - self->next) < size) {
+    self->next = fl_value_arena_add_block(self, kArenaBlockSize);
+    self->end = self->next + kArenaBlockSize;
+  }
+  gpointer data = self->next;
+  self->next += size;
+  return data;
+}
+
+FlValueArena* fl_value_arena_new() {
+  FlValueArena* self = g_new0(FlValueArena, 1);
+  self->ref_count = 1;
+  return self;
+}
+
+static FlValueArena* fl_value_arena_ref(FlValueArena* self) {
+  g_atomic_int_inc(&self->ref_count);
+  return self;
+}
+
+void fl_value_arena_unref(FlValueArena* self) {
+  g_return_if_fail(self != nullptr);
+  g_return_if_fail(g_atomic_int_get(&self->ref_count) > 0);
+  if (!g_atomic_int_dec_and_test(&self->ref_count)) {
+    return;
+  }
+
+  FlValueArenaBlock* block = self->blocks;
+  while (block != nullptr) {
+    FlValueArenaBlock* next = block->next;
+    g_free(block);
+    block = next;
+  }
+  g_free(self);
+}
+
+void fl_value_arena_push_thread_default(FlValueArena* arena) {
+  g_return_if_fail(arena != nullptr);
+  g_return_if_fail(arena->previous_default == nullptr);
+  g_return_if_fail(thread_default_arena != arena);
+
+  arena->previous_default = thread_default_arena;
+  thread_default_arena = arena;
+}
+
+void fl_value_arena_pop_thread_default(FlValueArena* arena) {
+  g_return_if_fail(arena != nullptr);
+  g_return_if_fail(thread_default_arena == arena);
+
+  thread_default_arena = arena->previous_default;
+  arena->previous_default = nullptr;
+}
+
 static FlValue* fl_value_new(FlValueType type, size_t size) {
-  FlValue* self = static_cast<FlValue*>(g_malloc0(size));
+  FlValue* self;
+  if (thread_default_arena != nullptr) {
+    self = static_cast<FlValue*>(
+        fl_value_arena_alloc(thread_default_arena, size));
+    memset(self, 0, size);
+    self->arena = fl_value_arena_ref(thread_default_arena);
+  } else {
+    self = static_cast<FlValue*>(g_malloc0(size));
+  }
   self->type = type;
   self->ref_count = 1;
   return self;
 }
 
+// Allocates @size bytes of data owned by @self, e.g. the contents of a string.
+static gpointer fl_value_alloc_data(FlValue* self, size_t size) {
+  if (self->arena != nullptr) {
+    return fl_value_arena_alloc(self->arena, size);
+  }
+  return g_malloc(size);
+}
+
+// Frees data allocated with fl_value_alloc_data().
+static void fl_value_free_data(FlValue* self, gpointer data) {
+  if (self->arena == nullptr) {
+    g_free(data);
+  }
+}
+
+// Copies @length bytes of @data into storage owned by @self.
+static gpointer fl_value_dup_data(FlValue* self,
+                                  gconstpointer data,
+                                  size_t length) {
+  gpointer copy = fl_value_alloc_data(self, length);
+  if (length > 0) {
+    memcpy(copy, data, length);
+  }
+  return copy;
+}
+
+// Copies @length characters of @value into a nul-terminated string owned by
+// @self.
+static gchar* fl_value_dup_string(FlValue* self,
+                                  const gchar* value,
+                                  size_t length) {
+  gchar* copy = static_cast<gchar*>(fl_value_alloc_data(self, length + 1));
+  if (length > 0) {
+    memcpy(copy, value, length);
+  }
+  copy[length] = '\0';
+  return copy;
+}
+
 // Helper function to match GDestroyNotify type.
 static void fl_value_destroy(gpointer value) {
   fl_value_unref(static_cast<FlValue*>(value));
@@ -276,7 +434,10 @@ G_MODULE_EXPORT FlValue* fl_value_new_float(double value) {
 G_MODULE_EXPORT FlValue* fl_value_new_string(const gchar* value) {
   FlValueString* self = reinterpret_cast<FlValueString*>(
       fl_value_new(FL_VALUE_TYPE_STRING, sizeof(FlValueString)));
-  self->value = g_strdup(value);
+  self->value = value == nullptr
+                    ? nullptr
+                    : fl_value_dup_string(reinterpret_cast<FlValue*>(self),
+                                          value, strlen(value));
   return reinterpret_cast<FlValue*>(self);
 }
 
@@ -284,8 +445,10 @@ G_MODULE_EXPORT FlValue* fl_value_new_string_sized(const gchar* value,
                                                    size_t value_length) {
   FlValueString* self = reinterpret_cast<FlValueString*>(
       fl_value_new(FL_VALUE_TYPE_STRING, sizeof(FlValueString)));
+  // Like g_strndup(), stop at the first nul character.
+  size_t length = value_length == 0 ? 0 : strnlen(value, value_length);
   self->value =
-      value_length == 0 ? g_strdup("") : g_strndup(value, value_length);
+      fl_value_dup_string(reinterpret_cast<FlValue*>(self), value, length);
   return reinterpret_cast<FlValue*>(self);
 }
 
@@ -294,8 +457,8 @@ G_MODULE_EXPORT FlValue* fl_value_new_uint8_list(const uint8_t* data,
   FlValueUint8List* self = reinterpret_cast<FlValueUint8List*>(
       fl_value_new(FL_VALUE_TYPE_UINT8_LIST, sizeof(FlValueUint8List)));
   self->values_length = data_length;
-  self->values = static_cast<uint8_t*>(g_malloc(sizeof(uint8_t) * data_length));
-  memcpy(self->values, data, sizeof(uint8_t) * data_length);
+  self->values = static_cast<uint8_t*>(fl_value_dup_data(
+      reinterpret_cast<FlValue*>(self), data, sizeof(uint8_t) * data_length));
   return reinterpret_cast<FlValue*>(self);
 }
 
@@ -311,8 +474,8 @@ G_MODULE_EXPORT FlValue* fl_value_new_int32_list(const int32_t* data,
   FlValueInt32List* self = reinterpret_cast<FlValueInt32List*>(
       fl_value_new(FL_VALUE_TYPE_INT32_LIST, sizeof(FlValueInt32List)));
   self->values_length = data_length;
-  self->values = static_cast<int32_t*>(g_malloc(sizeof(int32_t) * data_length));
-  memcpy(self->values, data, sizeof(int32_t) * data_length);
+  self->values = static_cast<int32_t*>(fl_value_dup_data(
+      reinterpret_cast<FlValue*>(self), data, sizeof(int32_t) * data_length));
   return reinterpret_cast<FlValue*>(self);
 }
 
@@ -321,8 +484,8 @@ G_MODULE_EXPORT FlValue* fl_value_new_int64_list(const int64_t* data,
   FlValueInt64List* self = reinterpret_cast<FlValueInt64List*>(
       fl_value_new(FL_VALUE_TYPE_INT64_LIST, sizeof(FlValueInt64List)));
   self->values_length = data_length;
-  self->values = static_cast<int64_t*>(g_malloc(sizeof(int64_t) * data_length));
-  memcpy(self->values, data, sizeof(int64_t) * data_length);
+  self->values = static_cast<int64_t*>(fl_value_dup_data(
+      reinterpret_cast<FlValue*>(self), data, sizeof(int64_t) * data_length));
   return reinterpret_cast<FlValue*>(self);
 }
 
@@ -331,8 +494,8 @@ G_MODULE_EXPORT FlValue* fl_value_new_float32_list(const float* data,
   FlValueFloat32List* self = reinterpret_cast<FlValueFloat32List*>(
       fl_value_new(FL_VALUE_TYPE_FLOAT32_LIST, sizeof(FlValueFloat32List)));
   self->values_length = data_length;
-  self->values = static_cast<float*>(g_malloc(sizeof(float) * data_length));
-  memcpy(self->values, data, sizeof(float) * data_length);
+  self->values = static_cast<float*>(fl_value_dup_data(
+      reinterpret_cast<FlValue*>(self), data, sizeof(float) * data_length));
   return reinterpret_cast<FlValue*>(self);
 }
 
@@ -341,15 +504,19 @@ G_MODULE_EXPORT FlValue* fl_value_new_float_list(const double* data,
   FlValueFloatList* self = reinterpret_cast<FlValueFloatList*>(
       fl_value_new(FL_VALUE_TYPE_FLOAT_LIST, sizeof(FlValueFloatList)));
   self->values_length = data_length;
-  self->values = static_cast<double*>(g_malloc(sizeof(double) * data_length));
-  memcpy(self->values, data, sizeof(double) * data_length);
+  self->values = static_cast<double*>(fl_value_dup_data(
+      reinterpret_cast<FlValue*>(self), data, sizeof(double) * data_length));
   return reinterpret_cast<FlValue*>(self);
 }
 
 G_MODULE_EXPORT FlValue* fl_value_new_list() {
+  return fl_value_new_list_reserved(0);
+}
+
+FlValue* fl_value_new_list_reserved(size_t reserved_length) {
   FlValueList* self = reinterpret_cast<FlValueList*>(
       fl_value_new(FL_VALUE_TYPE_LIST, sizeof(FlValueList)));
-  self->values = g_ptr_array_new_with_free_func(fl_value_destroy);
+  self->values = g_ptr_array_new_full(reserved_length, fl_value_destroy);
   return reinterpret_cast<FlValue*>(self);
 }
 
@@ -364,10 +531,14 @@ G_MODULE_EXPORT FlValue* fl_value_new_list_from_strv(
 }
 
 G_MODULE_EXPORT FlValue* fl_value_new_map() {
+  return fl_value_new_map_reserved(0);
+}
+
+FlValue* fl_value_new_map_reserved(size_t reserved_length) {
   FlValueMap* self = reinterpret_cast<FlValueMap*>(
       fl_value_new(FL_VALUE_TYPE_MAP, sizeof(FlValueMap)));
-  self->keys = g_ptr_array_new_with_free_func(fl_value_destroy);
-  self->values = g_ptr_array_new_with_free_func(fl_value_destroy);
+  self->keys = g_ptr_array_new_full(reserved_length, fl_value_destroy);
+  self->values = g_ptr_array_new_full(reserved_length, fl_value_destroy);
   return reinterpret_cast<FlValue*>(self);
 }
 
@@ -408,32 +579,32 @@ G_MODULE_EXPORT void fl_value_unref(FlValue* self) {
   switch (self->type) {
     case FL_VALUE_TYPE_STRING: {
       FlValueString* v = reinterpret_cast<FlValueString*>(self);
-      g_free(v->value);
+      fl_value_free_data(self, v->value);
       break;
     }
     case FL_VALUE_TYPE_UINT8_LIST: {
       FlValueUint8List* v = reinterpret_cast<FlValueUint8List*>(self);
-      g_free(v->values);
+      fl_value_free_data(self, v->values);
       break;
     }
     case FL_VALUE_TYPE_INT32_LIST: {
       FlValueInt32List* v = reinterpret_cast<FlValueInt32List*>(self);
-      g_free(v->values);
+      fl_value_free_data(self, v->values);
       break;
     }
     case FL_VALUE_TYPE_INT64_LIST: {
       FlValueInt64List* v = reinterpret_cast<FlValueInt64List*>(self);
-      g_free(v->values);
+      fl_value_free_data(self, v->values);
       break;
     }
     case FL_VALUE_TYPE_FLOAT32_LIST: {
       FlValueFloat32List* v = reinterpret_cast<FlValueFloat32List*>(self);
-      g_free(v->values);
+      fl_value_free_data(self, v->values);
       break;
     }
     case FL_VALUE_TYPE_FLOAT_LIST: {
       FlValueFloatList* v = reinterpret_cast<FlValueFloatList*>(self);
-      g_free(v->values);
+      fl_value_free_data(self, v->values);
       break;
     }
     case FL_VALUE_TYPE_LIST: {
@@ -460,7 +631,11 @@ G_MODULE_EXPORT void fl_value_unref(FlValue* self) {
     case FL_VALUE_TYPE_FLOAT:
       break;
   }
-  g_free(self);
+  if (self->arena != nullptr) {
+    fl_value_arena_unref(self->arena);
+  } else {
+    g_free(self);
+  }
 }
 
 G_MODULE_EXPORT FlValueType fl_value_get_type(FlValue* self) {
@@ -636,6 +811,19 @@ G_MODULE_EXPORT void fl_value_set_take(FlValue* self,
   }
 }
 
+void fl_value_map_append_take(FlValue* self,
+                              FlValue* key,
+                              FlValue* value) {
+  g_return_if_fail(self != nullptr);
+  g_return_if_fail(self->type == FL_VALUE_TYPE_MAP);
+  g_return_if_fail(key != nullptr);
+  g_return_if_fail(value != nullptr);
+
+  FlValueMap* v = reinterpret_cast<FlValueMap*>(self);
+  g_ptr_array_add(v->keys, key);
+  g_ptr_array_add(v->values, value);
+}
+
 G_MODULE_EXPORT void fl_value_set_string(FlValue* self,
                                          const gchar* key,
                                          FlValue* value) {
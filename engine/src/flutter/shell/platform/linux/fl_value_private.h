@@ -0,0 +1,120 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_LINUX_FL_VALUE_PRIVATE_H_
+#define FLUTTER_SHELL_PLATFORM_LINUX_FL_VALUE_PRIVATE_H_
+
+#include "flutter/shell/platform/linux/public/flutter_linux/fl_value.h"
+
+G_BEGIN_DECLS
+
+/**
+ * FlValueArena:
+ *
+ * #FlValueArena allocates #FlValue objects and their data in large blocks, so
+ * that building a large tree of values, e.g. when decoding a message, does not
+ * make an allocation per value.
+ *
+ * Values allocated from an arena are reference counted as normal and can be
+ * used like any other value. The memory of the arena is only freed once all of
+ * its values and the creator's reference have been released, so keeping a
+ * reference to one value, e.g. a single string of a decoded message, keeps the
+ * memory of the whole arena alive.
+ *
+ * Codecs never use an arena on their own. A caller that only reads a decoded
+ * message, and releases all of its values before decoding the next one, can
+ * opt in by making an arena the thread default around the decode:
+ *
+ * |[<!-- language="C" -->
+ *   g_autoptr(FlValueArena) arena = fl_value_arena_new();
+ *   fl_value_arena_push_thread_default (arena);
+ *   g_autoptr(FlValue) value =
+ *       fl_message_codec_decode_message (codec, message, &error);
+ *   fl_value_arena_pop_thread_default (arena);
+ * ]|
+ *
+ * Values are only allocated from an arena while it is the thread default of
+ * the thread that pushed it. Afterwards its values follow the same threading
+ * rules as other values, and values of the same arena may be released on
+ * different threads.
+ */
+typedef struct _FlValueArena FlValueArena;
+
+/**
+ * fl_value_arena_new:
+ *
+ * Creates a new arena to allocate values from.
+ *
+ * Returns: a new #FlValueArena.
+ */
+FlValueArena* fl_value_arena_new();
+
+/**
+ * fl_value_arena_unref:
+ * @arena: an #FlValueArena.
+ *
+ * Releases the reference returned by fl_value_arena_new(). The arena is freed
+ * when all values allocated from it are also released.
+ */
+void fl_value_arena_unref(FlValueArena* arena);
+
+/**
+ * fl_value_arena_push_thread_default:
+ * @arena: an #FlValueArena.
+ *
+ * Makes @arena the thread default, so that all values created on this thread
+ * are allocated from it until fl_value_arena_pop_thread_default() is called.
+ */
+void fl_value_arena_push_thread_default(FlValueArena* arena);
+
+/**
+ * fl_value_arena_pop_thread_default:
+ * @arena: the #FlValueArena passed to fl_value_arena_push_thread_default().
+ *
+ * Restores the thread default arena in place before @arena was pushed.
+ */
+void fl_value_arena_pop_thread_default(FlValueArena* arena);
+
+G_DEFINE_AUTOPTR_CLEANUP_FUNC(FlValueArena, fl_value_arena_unref)
+
+/**
+ * fl_value_new_list_reserved:
+ * @reserved_length: the number of values to reserve space for.
+ *
+ * Creates an empty list like fl_value_new_list() that can hold
+ * @reserved_length values without reallocating.
+ *
+ * Returns: a new #FlValue.
+ */
+FlValue* fl_value_new_list_reserved(size_t reserved_length);
+
+/**
+ * fl_value_new_map_reserved:
+ * @reserved_length: the number of entries to reserve space for.
+ *
+ * Creates an empty map like fl_value_new_map() that can hold @reserved_length
+ * entries without reallocating.
+ *
+ * Returns: a new #FlValue.
+ */
+FlValue* fl_value_new_map_reserved(size_t reserved_length);
+
+/**
+ * fl_value_map_append_take:
+ * @value: an #FlValue of type #FL_VALUE_TYPE_MAP.
+ * @key: (transfer full): an #FlValue to use as the key.
+ * @child_value: (transfer full): an #FlValue to store.
+ *
+ * Adds @key and @child_value to the end of a map without checking whether
+ * @key is already present, unlike fl_value_set_take(). The caller must ensure
+ * the map does not contain @key, e.g. when decoding a message whose keys are
+ * known to be unique.
+ */
+void fl_value_map_append_take(FlValue* value,
+                              FlValue* key,
+                              FlValue* child_value);
+
+G_END_DECLS
+
+#endif  // FLUTTER_SHELL_PLATFORM_LINUX_FL_VALUE_PRIVATE_H_
@@ -6,6 +6,7 @@
 
 #include <gmodule.h>
 
+#include "flutter/shell/platform/linux/fl_value_private.h"
 #include "gtest/gtest.h"
 
 TEST(FlDartProjectTest, Null) {
@@ -983,3 +984,91 @@ TEST(FlValueTest, ListMapNotEqual) {
   g_autoptr(FlValue) value2 = fl_value_new_map();
   EXPECT_FALSE(fl_value_equal(value1, value2));
 }
+
+TEST(FlValueTest, ArenaValues) {
+  g_autoptr(FlValueArena) arena = fl_value_arena_new();
+  fl_value_arena_push_thread_default(arena);
+  g_autoptr(FlValue) list = fl_value_new_list_reserved(3);
+  fl_value_append_take(list, fl_value_new_string("hello"));
+  fl_value_append_take(list, fl_value_new_string_sized("world!", 5));
+  int32_t data[] = {0, -1, G_MAXINT32};
+  fl_value_append_take(list, fl_value_new_int32_list(data, 3));
+  fl_value_arena_pop_thread_default(arena);
+
+  g_autoptr(FlValue) expected = fl_value_new_list();
+  fl_value_append_take(expected, fl_value_new_string("hello"));
+  fl_value_append_take(expected, fl_value_new_string("world"));
+  fl_value_append_take(expected, fl_value_new_int32_list(data, 3));
+  EXPECT_TRUE(fl_value_equal(list, expected));
+}
+
+TEST(FlValueTest, ArenaValuesOutliveArena) {
+  FlValueArena* arena = fl_value_arena_new();
+  fl_value_arena_push_thread_default(arena);
+  FlValue* map = fl_value_new_map_reserved(1);
+  fl_value_set_string_take(map, "key", fl_value_new_string("value"));
+  fl_value_arena_pop_thread_default(arena);
+  fl_value_arena_unref(arena);
+
+  g_autoptr(FlValue) value = fl_value_ref(fl_value_lookup_string(map, "key"));
+  fl_value_unref(map);
+  EXPECT_STREQ(fl_value_get_string(value), "value");
+}
+
+static gpointer unref_values(gpointer data) {
+  g_autoptr(GPtrArray) values = static_cast<GPtrArray*>(data);
+  for (guint i = 0; i < values->len; i++) {
+    fl_value_unref(static_cast<FlValue*>(g_ptr_array_index(values, i)));
+  }
+  return nullptr;
+}
+
+TEST(FlValueTest, ArenaValuesReleasedOnDifferentThreads) {
+  constexpr size_t kThreadCount = 4;
+  constexpr size_t kValueCount = 1000;
+
+  FlValueArena* arena = fl_value_arena_new();
+  fl_value_arena_push_thread_default(arena);
+  FlValue* list = fl_value_new_list_reserved(kValueCount);
+  for (size_t i = 0; i < kValueCount; i++) {
+    fl_value_append_take(list, fl_value_new_int(i));
+  }
+  fl_value_arena_pop_thread_default(arena);
+  fl_value_arena_unref(arena);
+
+  // Hand each thread its own share of the children to release.
+  GPtrArray* values[kThreadCount];
+  for (size_t i = 0; i < kThreadCount; i++) {
+    values[i] = g_ptr_array_new();
+  }
+  for (size_t i = 0; i < kValueCount; i++) {
+    g_ptr_array_add(values[i % kThreadCount],
+                    fl_value_ref(fl_value_get_list_value(list, i)));
+  }
+  fl_value_unref(list);
+
+  GThread* threads[kThreadCount];
+  for (size_t i = 0; i < kThreadCount; i++) {
+    threads[i] = g_thread_new("unref", unref_values, values[i]);
+  }
+  for (size_t i = 0; i < kThreadCount; i++) {
+    g_thread_join(threads[i]);
+  }
+}
+
+TEST(FlValueTest, ArenaValuesMixedWithHeapValues) {
+  g_autoptr(FlValue) heap_list = fl_value_new_list();
+
+  g_autoptr(FlValueArena) arena = fl_value_arena_new();
+  fl_value_arena_push_thread_default(arena);
+  g_autoptr(FlValue) arena_list = fl_value_new_list();
+  fl_value_append_take(heap_list, fl_value_new_string("arena"));
+  fl_value_arena_pop_thread_default(arena);
+
+  fl_value_append_take(arena_list, fl_value_new_string("heap"));
+  fl_value_append(heap_list, arena_list);
+  EXPECT_STREQ(fl_value_get_string(fl_value_get_list_value(heap_list, 0)),
+               "arena");
+  EXPECT_STREQ(fl_value_get_string(fl_value_get_list_value(arena_list, 0)),
+               "heap");
+}
@@ -0,0 +1,125 @@
+// Copyright 2013 The Flutter Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef FLUTTER_SHELL_PLATFORM_LINUX_PUBLIC_FLUTTER_LINUX_FL_DMA_BUF_TEXTURE_H_
+#define FLUTTER_SHELL_PLATFORM_LINUX_PUBLIC_FLUTTER_LINUX_FL_DMA_BUF_TEXTURE_H_
+
+#if !defined(__FLUTTER_LINUX_INSIDE__) && !defined(FLUTTER_LINUX_COMPILATION)
+#error "Only <flutter_linux/flutter_linux.h> can be included directly."
+#endif
+
+#include <glib-object.h>
+#include <gmodule.h>
+#include <stdint.h>
+#include "fl_texture.h"
+
+G_BEGIN_DECLS
+
+G_MODULE_EXPORT
+G_DECLARE_FINAL_TYPE(FlDmaBufTexture,
+                     fl_dma_buf_texture,
+                     FL,
+                     DMA_BUF_TEXTURE,
+                     GObject)
+
+/**
+ * FlDmaBufTexture:
+ *
+ * #FlDmaBufTexture is a texture that shows frames shared as DMA-BUF file
+ * descriptors, such as the buffers produced by V4L2 devices or GStreamer.
+ *
+ * Frames are imported as EGL images without copying them. If the EGL display
+ * can't import DMA-BUFs, single plane linear RGBA and RGBX frames are mapped
+ * and copied instead. RGBX frames are shown opaque.
+ *
+ * The following example shows how to show frames from a producer.
+ * ![<!-- language="C" -->
+ *   static void frame_released_cb (int fence_fd, gpointer user_data) {
+ *     MyBuffer *buffer = user_data;
+ *     // Wait for fence_fd before writing to the buffer, then close it.
+ *     my_producer_queue_buffer (buffer, fence_fd);
+ *   }
+ *
+ *   static void frame_ready_cb (MyBuffer *buffer) {
+ *     FlDmaBufPlane plane = {buffer->fd, 0, buffer->stride};
+ *     fl_dma_buf_texture_set_frame (texture, buffer->width, buffer->height,
+ *                                   DRM_FORMAT_ABGR8888, DRM_FORMAT_MOD_LINEAR,
+ *                                   &plane, 1, frame_released_cb, buffer);
+ *     fl_texture_registrar_mark_texture_frame_available (registrar,
+ *                                                        FL_TEXTURE (texture));
+ *   }
+ * ]|
+ */
+
+/**
+ * FlDmaBufPlane:
+ * @fd: DMA-BUF file descriptor of the plane.
+ * @offset: offset of the plane in @fd, in bytes.
+ * @stride: size of a row of the plane, in bytes.
+ *
+ * A plane of a DMA-BUF frame.
+ */
+typedef struct {
+  int fd;
+  uint32_t offset;
+  uint32_t stride;
+} FlDmaBufPlane;
+
+/**
+ * FlDmaBufReleaseCallback:
+ * @fence_fd: a sync file descriptor that signals when Flutter has finished
+ * reading the frame, or -1 if the frame can be reused immediately. The
+ * callback takes ownership of the file descriptor and must close it.
+ * @user_data: the data passed with the frame.
+ *
+ * Function called when a frame is no longer used by Flutter, so that its
+ * buffers can be returned to the producer. May be called on any thread.
+ */
+typedef void (*FlDmaBufReleaseCallback)(int fence_fd, gpointer user_data);
+
+/**
+ * fl_dma_buf_texture_new:
+ *
+ * Creates a new texture for DMA-BUF frames.
+ *
+ * Returns: a new #FlDmaBufTexture.
+ */
+FlDmaBufTexture* fl_dma_buf_texture_new();
+
+/**
+ * fl_dma_buf_texture_set_frame:
+ * @texture: an #FlDmaBufTexture.
+ * @width: width of the frame in pixels.
+ * @height: height of the frame in pixels.
+ * @fourcc: DRM format of the frame, e.g. DRM_FORMAT_ABGR8888.
+ * @modifier: DRM format modifier of the frame, or DRM_FORMAT_MOD_INVALID if
+ * it is implied by the buffer.
+ * @planes: (array length=n_planes): the planes of the frame.
+ * @n_planes: number of planes, from 1 to 4.
+ * @release_callback: (allow-none): function to call when the frame is no
+ * longer used.
+ * @user_data: (closure): user data to pass to @release_callback.
+ *
+ * Sets the frame to show the next time the texture is drawn. Call
+ * fl_texture_registrar_mark_texture_frame_available() afterwards to draw it.
+ *
+ * The file descriptors must stay open until @release_callback is called. If
+ * another frame is set before this one is drawn, this frame is released
+ * without being read.
+ *
+ * This function is thread-safe.
+ */
+void fl_dma_buf_texture_set_frame(FlDmaBufTexture* texture,
+                                  uint32_t width,
+                                  uint32_t height,
+                                  uint32_t fourcc,
+                                  uint64_t modifier,
+                                  const FlDmaBufPlane* planes,
+                                  size_t n_planes,
+                                  FlDmaBufReleaseCallback release_callback,
+                                  gpointer user_data);
+
+G_END_DECLS
+
+#endif  // FLUTTER_SHELL_PLATFORM_LINUX_PUBLIC_FLUTTER_LINUX_FL_DMA_BUF_TEXTURE_H_
@@ -110,6 +110,28 @@ struct _FlPixelBufferTextureClass {
                           GError** error);
 };
 
+/**
+ * fl_pixel_buffer_texture_mark_region_dirty:
+ * @texture: an #FlPixelBufferTexture.
+ * @x: left edge of the region in pixels.
+ * @y: top edge of the region in pixels.
+ * @width: width of the region in pixels.
+ * @height: height of the region in pixels.
+ *
+ * Marks a region of the pixel buffer as changed since the last frame, so that
+ * only this region is uploaded for the next frame. Regions marked for the same
+ * frame are merged into their bounding box. If no region is marked before a
+ * frame, the whole pixel buffer is uploaded.
+ *
+ * Call this before fl_texture_registrar_mark_texture_frame_available(). This
+ * function is thread-safe.
+ */
+void fl_pixel_buffer_texture_mark_region_dirty(FlPixelBufferTexture* texture,
+                                               uint32_t x,
+                                               uint32_t y,
+                                               uint32_t width,
+                                               uint32_t height);
+
 G_END_DECLS
 
 #endif  // FLUTTER_SHELL_PLATFORM_LINUX_PUBLIC_FLUTTER_LINUX_FL_PIXEL_BUFFER_TEXTURE_H_
@@ -5,6 +5,8 @@
 
 #include "flutter/shell/platform/linux/testing/mock_epoxy.h"
 
+#include <vector>
+
 using namespace flutter::testing;
 
 typedef struct {
@@ -260,6 +262,10 @@ EGLBoolean _eglGetConfigAttrib(EGLDisplay dpy,
   }
 }
 
+EGLDisplay _eglGetCurrentDisplay() {
+  return &mock_display;
+}
+
 EGLDisplay _eglGetDisplay(EGLNativeDisplayType display_id) {
   return &mock_display;
 }
@@ -342,6 +348,32 @@ EGLBoolean _eglQueryContext(EGLDisplay display,
   return EGL_FALSE;
 }
 
+static EGLImageKHR _eglCreateImageKHR(EGLDisplay dpy,
+                                      EGLContext ctx,
+                                      EGLenum target,
+                                      EGLClientBuffer buffer,
+                                      const EGLint* attrib_list) {
+  return mock->eglCreateImageKHR(dpy, ctx, target, buffer, attrib_list);
+}
+
+static EGLBoolean _eglDestroyImageKHR(EGLDisplay dpy, EGLImageKHR image) {
+  return mock->eglDestroyImageKHR(dpy, image);
+}
+
+static EGLSyncKHR _eglCreateSyncKHR(EGLDisplay dpy,
+                                    EGLenum type,
+                                    const EGLint* attrib_list) {
+  return mock->eglCreateSyncKHR(dpy, type, attrib_list);
+}
+
+static EGLBoolean _eglDestroySyncKHR(EGLDisplay dpy, EGLSyncKHR sync) {
+  return EGL_TRUE;
+}
+
+static EGLint _eglDupNativeFenceFDANDROID(EGLDisplay dpy, EGLSyncKHR sync) {
+  return mock->eglDupNativeFenceFDANDROID(dpy, sync);
+}
+
 EGLBoolean _eglSwapBuffers(EGLDisplay dpy, EGLSurface surface) {
   if (!check_display(dpy) || !check_initialized(dpy)) {
     return EGL_FALSE;
@@ -352,8 +384,13 @@ EGLBoolean _eglSwapBuffers(EGLDisplay dpy, EGLSurface surface) {
 
 static GLuint bound_texture_2d;
 
+// Storage handed out by glMapBufferRange.
+static std::vector<uint8_t> mapped_buffer;
+
 void _glAttachShader(GLuint program, GLuint shader) {}
 
+static void _glBindBuffer(GLenum target, GLuint buffer) {}
+
 static void _glBindFramebuffer(GLenum target, GLuint framebuffer) {}
 
 static void _glBindTexture(GLenum target, GLuint texture) {
@@ -390,6 +427,13 @@ GLuint _glCreateShader(GLenum shaderType) {
   return 0;
 }
 
+static void _glBufferData(GLenum target,
+                          GLsizeiptr size,
+                          const void* data,
+                          GLenum usage) {}
+
+void _glDeleteBuffers(GLsizei n, const GLuint* buffers) {}
+
 void _glDeleteFramebuffers(GLsizei n, const GLuint* framebuffers) {}
 
 void _glDeleteShader(GLuint shader) {}
@@ -403,8 +447,16 @@ static void _glFramebufferTexture2D(GLenum target,
                                     GLint level) {}
 
 static void _glGenTextures(GLsizei n, GLuint* textures) {
+  static GLuint next_texture = 1;
   for (GLsizei i = 0; i < n; i++) {
-    textures[i] = 0;
+    textures[i] = next_texture++;
+  }
+}
+
+static void _glGenBuffers(GLsizei n, GLuint* buffers) {
+  static GLuint next_buffer = 1;
+  for (GLsizei i = 0; i < n; i++) {
+    buffers[i] = next_buffer++;
   }
 }
 
@@ -442,13 +494,33 @@ static void _glGetShaderInfoLog(GLuint shader,
                                 GLsizei* length,
                                 GLchar* infoLog) {}
 
+static void _glEGLImageTargetTexture2DOES(GLenum target, GLeglImageOES image) {
+  mock->glEGLImageTargetTexture2DOES(target, image);
+}
+
+static void _glFinish() {
+  mock->glFinish();
+}
+
+static void _glFlush() {}
+
 static const GLubyte* _glGetString(GLenum pname) {
   return mock->glGetString(pname);
 }
 
+static void* _glMapBufferRange(GLenum target,
+                               GLintptr offset,
+                               GLsizeiptr length,
+                               GLbitfield access) {
+  mapped_buffer.resize(length);
+  return mapped_buffer.data();
+}
+
 static void _glTexParameterf(GLenum target, GLenum pname, GLfloat param) {}
 
-static void _glTexParameteri(GLenum target, GLenum pname, GLint param) {}
+static void _glTexParameteri(GLenum target, GLenum pname, GLint param) {
+  mock->glTexParameteri(target, pname, param);
+}
 
 static void _glTexImage2D(GLenum target,
                           GLint level,
@@ -458,7 +530,39 @@ static void _glTexImage2D(GLenum target,
                           GLint border,
                           GLenum format,
                           GLenum type,
-                          const void* pixels) {}
+                          const void* pixels) {
+  mock->glTexImage2D(target, level, internalformat, width, height, border,
+                     format, type, pixels);
+}
+
+static void _glTexStorage2D(GLenum target,
+                            GLsizei levels,
+                            GLenum internalformat,
+                            GLsizei width,
+                            GLsizei height) {
+  mock->glTexStorage2D(target, levels, internalformat, width, height);
+}
+
+static void _glTexSubImage2D(GLenum target,
+                             GLint level,
+                             GLint xoffset,
+                             GLint yoffset,
+                             GLsizei width,
+                             GLsizei height,
+                             GLenum format,
+                             GLenum type,
+                             const void* pixels) {
+  // When reading from a pixel buffer, pass on the mapped contents.
+  if (pixels == nullptr) {
+    pixels = mapped_buffer.data();
+  }
+  mock->glTexSubImage2D(target, level, xoffset, yoffset, width, height, format,
+                        type, pixels);
+}
+
+static GLboolean _glUnmapBuffer(GLenum target) {
+  return GL_TRUE;
+}
 
 static GLenum _glGetError() {
   return GL_NO_ERROR;
@@ -471,6 +575,10 @@ void _glShaderSource(GLuint shader,
                      const GLchar* const* string,
                      const GLint* length) {}
 
+bool epoxy_has_egl_extension(EGLDisplay dpy, const char* extension) {
+  return mock->epoxy_has_egl_extension(dpy, extension);
+}
+
 bool epoxy_has_gl_extension(const char* extension) {
   return mock->epoxy_has_gl_extension(extension);
 }
@@ -524,6 +632,7 @@ EGLBoolean (*epoxy_eglGetConfigAttrib)(EGLDisplay dpy,
                                        EGLConfig config,
                                        EGLint attribute,
                                        EGLint* value);
+EGLDisplay (*epoxy_eglGetCurrentDisplay)();
 EGLDisplay (*epoxy_eglGetDisplay)(EGLNativeDisplayType display_id);
 EGLint (*epoxy_eglGetError)();
 void (*(*epoxy_eglGetProcAddress)(const char* procname))(void);
@@ -533,8 +642,20 @@ EGLBoolean (*epoxy_eglMakeCurrent)(EGLDisplay dpy,
                                    EGLSurface read,
                                    EGLContext ctx);
 EGLBoolean (*epoxy_eglSwapBuffers)(EGLDisplay dpy, EGLSurface surface);
+EGLImageKHR (*epoxy_eglCreateImageKHR)(EGLDisplay dpy,
+                                       EGLContext ctx,
+                                       EGLenum target,
+                                       EGLClientBuffer buffer,
+                                       const EGLint* attrib_list);
+EGLBoolean (*epoxy_eglDestroyImageKHR)(EGLDisplay dpy, EGLImageKHR image);
+EGLSyncKHR (*epoxy_eglCreateSyncKHR)(EGLDisplay dpy,
+                                     EGLenum type,
+                                     const EGLint* attrib_list);
+EGLBoolean (*epoxy_eglDestroySyncKHR)(EGLDisplay dpy, EGLSyncKHR sync);
+EGLint (*epoxy_eglDupNativeFenceFDANDROID)(EGLDisplay dpy, EGLSyncKHR sync);
 
 void (*epoxy_glAttachShader)(GLuint program, GLuint shader);
+void (*epoxy_glBindBuffer)(GLenum target, GLuint buffer);
 void (*epoxy_glBindFramebuffer)(GLenum target, GLuint framebuffer);
 void (*epoxy_glBindTexture)(GLenum target, GLuint texture);
 void (*epoxy_glBlitFramebuffer)(GLint srcX0,
@@ -547,20 +668,33 @@ void (*epoxy_glBlitFramebuffer)(GLint srcX0,
                                 GLint dstY1,
                                 GLbitfield mask,
                                 GLenum filter);
+void (*epoxy_glBufferData)(GLenum target,
+                           GLsizeiptr size,
+                           const void* data,
+                           GLenum usage);
 void (*epoxy_glCompileShader)(GLuint shader);
 GLuint (*epoxy_glCreateProgram)();
 GLuint (*epoxy_glCreateShader)(GLenum shaderType);
+void (*epoxy_glDeleteBuffers)(GLsizei n, const GLuint* buffers);
 void (*epoxy_glDeleteFramebuffers)(GLsizei n, const GLuint* framebuffers);
 void (*expoxy_glDeleteShader)(GLuint shader);
 void (*epoxy_glDeleteTextures)(GLsizei n, const GLuint* textures);
+void (*epoxy_glEGLImageTargetTexture2DOES)(GLenum target, GLeglImageOES image);
+void (*epoxy_glFinish)();
+void (*epoxy_glFlush)();
 void (*epoxy_glFramebufferTexture2D)(GLenum target,
                                      GLenum attachment,
                                      GLenum textarget,
                                      GLuint texture,
                                      GLint level);
+void (*epoxy_glGenBuffers)(GLsizei n, GLuint* buffers);
 void (*epoxy_glGenFramebuffers)(GLsizei n, GLuint* framebuffers);
 void (*epoxy_glGenTextures)(GLsizei n, GLuint* textures);
 void (*epoxy_glLinkProgram)(GLuint program);
+void* (*epoxy_glMapBufferRange)(GLenum target,
+                                GLintptr offset,
+                                GLsizeiptr length,
+                                GLbitfield access);
 void (*epoxy_glShaderSource)(GLuint shader,
                              GLsizei count,
                              const GLchar* const* string,
@@ -576,6 +710,21 @@ void (*epoxy_glTexImage2D)(GLenum target,
                            GLenum format,
                            GLenum type,
                            const void* pixels);
+void (*epoxy_glTexStorage2D)(GLenum target,
+                             GLsizei levels,
+                             GLenum internalformat,
+                             GLsizei width,
+                             GLsizei height);
+void (*epoxy_glTexSubImage2D)(GLenum target,
+                              GLint level,
+                              GLint xoffset,
+                              GLint yoffset,
+                              GLsizei width,
+                              GLsizei height,
+                              GLenum format,
+                              GLenum type,
+                              const void* pixels);
+GLboolean (*epoxy_glUnmapBuffer)(GLenum target);
 GLenum (*epoxy_glGetError)();
 
 static void library_init() {
@@ -585,6 +734,7 @@ static void library_init() {
   epoxy_eglCreatePbufferSurface = _eglCreatePbufferSurface;
   epoxy_eglCreateWindowSurface = _eglCreateWindowSurface;
   epoxy_eglGetConfigAttrib = _eglGetConfigAttrib;
+  epoxy_eglGetCurrentDisplay = _eglGetCurrentDisplay;
   epoxy_eglGetDisplay = _eglGetDisplay;
   epoxy_eglGetError = _eglGetError;
   epoxy_eglGetProcAddress = _eglGetProcAddress;
@@ -592,19 +742,31 @@ static void library_init() {
   epoxy_eglMakeCurrent = _eglMakeCurrent;
   epoxy_eglQueryContext = _eglQueryContext;
   epoxy_eglSwapBuffers = _eglSwapBuffers;
+  epoxy_eglCreateImageKHR = _eglCreateImageKHR;
+  epoxy_eglDestroyImageKHR = _eglDestroyImageKHR;
+  epoxy_eglCreateSyncKHR = _eglCreateSyncKHR;
+  epoxy_eglDestroySyncKHR = _eglDestroySyncKHR;
+  epoxy_eglDupNativeFenceFDANDROID = _eglDupNativeFenceFDANDROID;
 
   epoxy_glAttachShader = _glAttachShader;
+  epoxy_glBindBuffer = _glBindBuffer;
   epoxy_glBindFramebuffer = _glBindFramebuffer;
   epoxy_glBindTexture = _glBindTexture;
   epoxy_glBlitFramebuffer = _glBlitFramebuffer;
+  epoxy_glBufferData = _glBufferData;
   epoxy_glCompileShader = _glCompileShader;
   epoxy_glClearColor = _glClearColor;
   epoxy_glCreateProgram = _glCreateProgram;
   epoxy_glCreateShader = _glCreateShader;
+  epoxy_glDeleteBuffers = _glDeleteBuffers;
   epoxy_glDeleteFramebuffers = _glDeleteFramebuffers;
   epoxy_glDeleteShader = _glDeleteShader;
   epoxy_glDeleteTextures = _glDeleteTextures;
+  epoxy_glEGLImageTargetTexture2DOES = _glEGLImageTargetTexture2DOES;
+  epoxy_glFinish = _glFinish;
+  epoxy_glFlush = _glFlush;
   epoxy_glFramebufferTexture2D = _glFramebufferTexture2D;
+  epoxy_glGenBuffers = _glGenBuffers;
   epoxy_glGenFramebuffers = _glGenFramebuffers;
   epoxy_glGenTextures = _glGenTextures;
   epoxy_glGetIntegerv = _glGetIntegerv;
@@ -614,9 +776,13 @@ static void library_init() {
   epoxy_glGetShaderInfoLog = _glGetShaderInfoLog;
   epoxy_glGetString = _glGetString;
   epoxy_glLinkProgram = _glLinkProgram;
+  epoxy_glMapBufferRange = _glMapBufferRange;
   epoxy_glShaderSource = _glShaderSource;
   epoxy_glTexParameterf = _glTexParameterf;
   epoxy_glTexParameteri = _glTexParameteri;
   epoxy_glTexImage2D = _glTexImage2D;
+  epoxy_glTexStorage2D = _glTexStorage2D;
+  epoxy_glTexSubImage2D = _glTexSubImage2D;
+  epoxy_glUnmapBuffer = _glUnmapBuffer;
   epoxy_glGetError = _glGetError;
 }
@@ -17,9 +17,28 @@ class MockEpoxy {
  public:
   MockEpoxy();
 
+  MOCK_METHOD(bool,
+              epoxy_has_egl_extension,
+              (EGLDisplay dpy, const char* extension));
   MOCK_METHOD(bool, epoxy_has_gl_extension, (const char* extension));
   MOCK_METHOD(bool, epoxy_is_desktop_gl, ());
   MOCK_METHOD(int, epoxy_gl_version, ());
+  MOCK_METHOD(EGLImageKHR,
+              eglCreateImageKHR,
+              (EGLDisplay dpy,
+               EGLContext ctx,
+               EGLenum target,
+               EGLClientBuffer buffer,
+               const EGLint* attrib_list));
+  MOCK_METHOD(EGLBoolean,
+              eglDestroyImageKHR,
+              (EGLDisplay dpy, EGLImageKHR image));
+  MOCK_METHOD(EGLSyncKHR,
+              eglCreateSyncKHR,
+              (EGLDisplay dpy, EGLenum type, const EGLint* attrib_list));
+  MOCK_METHOD(EGLint,
+              eglDupNativeFenceFDANDROID,
+              (EGLDisplay dpy, EGLSyncKHR sync));
   MOCK_METHOD(void, glClearColor, (GLfloat r, GLfloat g, GLfloat b, GLfloat a));
   MOCK_METHOD(void,
               glBlitFramebuffer,
@@ -33,7 +52,43 @@ class MockEpoxy {
                GLint dstY1,
                GLbitfield mask,
                GLenum filter));
+  MOCK_METHOD(void,
+              glEGLImageTargetTexture2DOES,
+              (GLenum target, GLeglImageOES image));
+  MOCK_METHOD(void, glFinish, ());
   MOCK_METHOD(const GLubyte*, glGetString, (GLenum pname));
+  MOCK_METHOD(void,
+              glTexParameteri,
+              (GLenum target, GLenum pname, GLint param));
+  MOCK_METHOD(void,
+              glTexImage2D,
+              (GLenum target,
+               GLint level,
+               GLint internalformat,
+               GLsizei width,
+               GLsizei height,
+               GLint border,
+               GLenum format,
+               GLenum type,
+               const void* pixels));
+  MOCK_METHOD(void,
+              glTexStorage2D,
+              (GLenum target,
+               GLsizei levels,
+               GLenum internalformat,
+               GLsizei width,
+               GLsizei height));
+  MOCK_METHOD(void,
+              glTexSubImage2D,
+              (GLenum target,
+               GLint level,
+               GLint xoffset,
+               GLint yoffset,
+               GLsizei width,
+               GLsizei height,
+               GLenum format,
+               GLenum type,
+               const void* pixels));
 };
 
 }  // namespace testing
@@ -68,8 +68,12 @@ void TextInputPlugin::TextHook(const std::u16string& text) {
   if (active_model_ == nullptr) {
     return;
   }
-  std::u16string text_before_change =
-      fml::Utf8ToUtf16(active_model_->GetText());
+  // Only the delta model needs the previous text; copying it on every change
+  // is expensive for long texts.
+  std::u16string text_before_change;
+  if (enable_delta_model) {
+    text_before_change = fml::Utf8ToUtf16(active_model_->GetText());
+  }
   TextRange selection_before_change = active_model_->selection();
   active_model_->AddText(text);
 
@@ -128,7 +132,7 @@ void TextInputPlugin::ComposeBeginHook() {
   }
   active_model_->BeginComposing();
   if (enable_delta_model) {
-    std::string text = active_model_->GetText();
+    const std::string& text = active_model_->GetText();
     TextRange selection = active_model_->selection();
     TextEditingDelta delta = TextEditingDelta(text);
     SendStateUpdateWithDelta(*active_model_, &delta);
@@ -181,7 +185,7 @@ void TextInputPlugin::ComposeEndHook() {
   active_model_->CommitComposing();
   active_model_->EndComposing();
   if (enable_delta_model) {
-    std::string text = active_model_->GetText();
+    const std::string& text = active_model_->GetText();
     TextEditingDelta delta = TextEditingDelta(text);
     SendStateUpdateWithDelta(*active_model_, &delta);
   } else {
@@ -55,6 +55,55 @@ void main() {
     }
   });
 
+  test('layoutAll lays out each paragraph with its own constraints', () {
+    Paragraph build(String text) {
+      final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle(
+        fontFamily: 'FlutterTest',
+        fontSize: 10.0,
+      ));
+      builder.addText(text);
+      return builder.build();
+    }
+
+    final List<Paragraph> paragraphs = <Paragraph>[];
+    final List<ParagraphConstraints> constraints = <ParagraphConstraints>[];
+    for (int index = 0; index < 100; index += 1) {
+      paragraphs.add(build('Cell ' * (index % 5 + 1)));
+      constraints.add(ParagraphConstraints(width: 50.0 + index));
+    }
+    Paragraph.layoutAll(paragraphs, constraints);
+
+    for (int index = 0; index < paragraphs.length; index += 1) {
+      final Paragraph expected = build('Cell ' * (index % 5 + 1));
+      expected.layout(constraints[index]);
+      expect(paragraphs[index].width, expected.width);
+      expect(paragraphs[index].height, expected.height);
+      expect(paragraphs[index].maxIntrinsicWidth, expected.maxIntrinsicWidth);
+    }
+  });
+
+  test('layoutAll lays out a repeated paragraph with its last constraints', () {
+    final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle(
+      fontFamily: 'FlutterTest',
+      fontSize: 10.0,
+    ));
+    builder.addText('Cell ' * 20);
+    final Paragraph repeated = builder.build();
+
+    final List<Paragraph> paragraphs = <Paragraph>[];
+    final List<ParagraphConstraints> constraints = <ParagraphConstraints>[];
+    for (int index = 0; index < 100; index += 1) {
+      paragraphs.add(repeated);
+      constraints.add(ParagraphConstraints(width: 50.0 + index));
+    }
+    Paragraph.layoutAll(paragraphs, constraints);
+
+    expect(repeated.width, 149.0);
+    final double height = repeated.height;
+    repeated.layout(const ParagraphConstraints(width: 149.0));
+    expect(repeated.height, height);
+  });
+
   test('predictably lays out a multi-line paragraph', () {
     for (final double fontSize in <double>[10.0, 20.0, 30.0, 40.0]) {
       final ParagraphBuilder builder = ParagraphBuilder(ParagraphStyle(
@@ -416,6 +416,7 @@ def run_cc_tests(build_dir, executable_filter, coverage, capture_core_dump):
     return (name, flags, extra_env)
 
   unittests = [
+      make_test('assets_unittests'),
       make_test('client_wrapper_glfw_unittests'),
       make_test('client_wrapper_unittests'),
       make_test('common_cpp_core_unittests'),
@@ -428,6 +429,7 @@ def run_cc_tests(build_dir, executable_filter, coverage, capture_core_dump):
       make_test('embedder_unittests'),
       make_test('fml_unittests'),
       make_test('fml_arc_unittests'),
+      make_test('gpu_surface_software_unittests'),
       make_test('no_dart_plugin_registrant_unittests'),
       make_test('runtime_unittests'),
       make_test('testing_unittests'),
@@ -584,12 +586,18 @@ def run_engine_benchmarks(build_dir, executable_filter):
 
   run_engine_executable(build_dir, 'fml_benchmarks', executable_filter, icu_flags)
 
+  run_engine_executable(build_dir, 'assets_benchmarks', executable_filter, icu_flags)
+
   run_engine_executable(build_dir, 'ui_benchmarks', executable_filter, icu_flags)
 
   run_engine_executable(build_dir, 'display_list_builder_benchmarks', executable_filter, icu_flags)
 
   run_engine_executable(build_dir, 'geometry_benchmarks', executable_filter, icu_flags)
 
+  run_engine_executable(
+      build_dir, 'gpu_surface_software_benchmarks', executable_filter, icu_flags
+  )
+
   if is_linux():
     run_engine_executable(build_dir, 'txt_benchmarks', executable_filter, icu_flags)
 
@@ -14,11 +14,16 @@
  * limitations under the License.
  */
 
+#include <iterator>
 #include <sstream>
+#include <string>
 
+#include "flutter/display_list/dl_builder.h"
 #include "flutter/fml/command_line.h"
 #include "flutter/fml/logging.h"
+#include "flutter/runtime/test_font_data.h"
 #include "flutter/third_party/txt/tests/txt_test_utils.h"
+#include "skia/paragraph_builder_skia.h"
 #include "third_party/benchmark/include/benchmark/benchmark.h"
 #include "third_party/icu/source/common/unicode/unistr.h"
 #include "third_party/skia/include/core/SkBitmap.h"
@@ -29,6 +34,8 @@
 #include "third_party/skia/modules/skparagraph/include/TypefaceFontProvider.h"
 #include "third_party/skia/modules/skparagraph/utils/TestFontCollection.h"
 #include "third_party/skia/modules/skunicode/include/SkUnicode_icu.h"
+#include "txt/asset_font_manager.h"
+#include "txt/typeface_font_asset_provider.h"
 
 namespace sktxt = skia::textlayout;
 
@@ -302,6 +309,90 @@ BENCHMARK_F(SkParagraphFixture, PaintDecoration)(benchmark::State& state) {
   }
 }
 
+// Repaints a laid out paragraph into a display list the way the framework
+// does every frame for static text when running on Impeller.
+BENCHMARK_F(SkParagraphFixture, PaintImpellerTextFrames)
+(benchmark::State& state) {
+  auto font_collection = std::make_shared<txt::FontCollection>();
+  auto font_provider = std::make_unique<txt::TypefaceFontAssetProvider>();
+  for (auto& typeface : flutter::GetTestFontData()) {
+    font_provider->RegisterTypeface(typeface);
+  }
+  font_collection->SetAssetFontManager(
+      sk_make_sp<txt::AssetFontManager>(std::move(font_provider)));
+
+  txt::TextStyle text_style;
+  text_style.color = SK_ColorBLACK;
+  text_style.font_families.push_back("ahem");
+  txt::ParagraphBuilderSkia builder(txt::ParagraphStyle(), font_collection,
+                                    /*impeller_enabled=*/true);
+  builder.PushStyle(text_style);
+  builder.AddText(
+      u"Hello world! This is a simple sentence to test drawing. Hello world! "
+      u"This is a simple sentence to test drawing. Hello world! This is a "
+      u"simple sentence to test drawing. Hello world! This is a simple "
+      u"sentence to test drawing.");
+  builder.Pop();
+  auto paragraph = builder.Build();
+  paragraph->Layout(300);
+
+  while (state.KeepRunning()) {
+    flutter::DisplayListBuilder dl_builder;
+    paragraph->Paint(&dl_builder, 0, 0);
+    benchmark::DoNotOptimize(dl_builder.Build());
+  }
+}
+
+// Builds and lays out many short labels, as in lists and tables. Labels drawn
+// from a small set of strings share shaping results through the font
+// collection's shaping cache, while distinct labels are all shaped.
+static void BM_LayoutRepeatedShortStrings(benchmark::State& state) {
+  auto font_collection = std::make_shared<txt::FontCollection>();
+  auto font_provider = std::make_unique<txt::TypefaceFontAssetProvider>();
+  for (auto& typeface : flutter::GetTestFontData()) {
+    font_provider->RegisterTypeface(typeface);
+  }
+  font_collection->SetAssetFontManager(
+      sk_make_sp<txt::AssetFontManager>(std::move(font_provider)));
+  const bool repeated = state.range(0) != 0;
+
+  const std::u16string labels[] = {u"Inbox", u"Starred", u"Sent",
+                                   u"Drafts", u"Spam", u"Trash",
+                                   u"Settings", u"Help"};
+  txt::TextStyle text_style;
+  text_style.color = SK_ColorBLACK;
+  text_style.font_families.push_back("ahem");
+  while (state.KeepRunning()) {
+    for (size_t i = 0; i < 10000; i++) {
+      txt::ParagraphBuilderSkia builder(txt::ParagraphStyle(), font_collection,
+                                        /*impeller_enabled=*/false);
+      builder.PushStyle(text_style);
+      std::u16string label = labels[i % std::size(labels)];
+      if (!repeated) {
+        label += u' ';
+        for (char digit : std::to_string(i)) {
+          label += static_cast<char16_t>(digit);
+        }
+      }
+      builder.AddText(label);
+      builder.Pop();
+      auto paragraph = builder.Build();
+      paragraph->Layout(300);
+    }
+  }
+
+  txt::FontCollection::ShapingCacheStats stats =
+      font_collection->GetShapingCacheStats();
+  size_t lookups = stats.hits + stats.misses;
+  state.counters["CacheHitRate"] =
+      lookups == 0 ? 0.0 : static_cast<double>(stats.hits) / lookups;
+}
+BENCHMARK(BM_LayoutRepeatedShortStrings)
+    ->ArgName("repeated")
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_F(SkParagraphFixture, SimpleBuilder)(benchmark::State& state) {
   const char* text = "Hello World";
   sktxt::ParagraphStyle paragraph_style;
@@ -49,17 +49,26 @@ ParagraphBuilderSkia::ParagraphBuilderSkia(
     const ParagraphStyle& style,
     std::shared_ptr<FontCollection> font_collection,
     const bool impeller_enabled)
-    : base_style_(style.GetTextStyle()), impeller_enabled_(impeller_enabled) {
-  builder_ = skt::ParagraphBuilder::make(
-      TxtToSkia(style),
-      font_collection->CreateSktFontCollection(),
-      SkUnicodes::ICU::Make());
+    : base_style_(style.GetTextStyle()),
+      impeller_enabled_(impeller_enabled),
+      skt_collection_(font_collection->CreateSktFontCollection()) {
+  skt::ParagraphStyle skia_style = TxtToSkia(style);
+  ResolveTypefaces(skia_style.getTextStyle());
+  const skt::StrutStyle& strut_style = skia_style.getStrutStyle();
+  if (strut_style.getStrutEnabled()) {
+    skt_collection_->findTypefaces(strut_style.getFontFamilies(),
+                                   strut_style.getFontStyle(), std::nullopt);
+  }
+  builder_ = skt::ParagraphBuilder::make(skia_style, skt_collection_,
+                                         SkUnicodes::ICU::Make());
 }
 
 ParagraphBuilderSkia::~ParagraphBuilderSkia() = default;
 
 void ParagraphBuilderSkia::PushStyle(const TextStyle& style) {
-  builder_->pushStyle(TxtToSkia(style));
+  skt::TextStyle skia_style = TxtToSkia(style);
+  ResolveTypefaces(skia_style);
+  builder_->pushStyle(skia_style);
   txt_style_stack_.push(style);
 }
 
@@ -93,6 +102,14 @@ std::unique_ptr<Paragraph> ParagraphBuilderSkia::Build() {
       builder_->Build(), std::move(dl_paints_), impeller_enabled_);
 }
 
+void ParagraphBuilderSkia::ResolveTypefaces(const skt::TextStyle& style) {
+  // Populates the typeface cache of the collection with the same key used
+  // when the paragraph is shaped, so that layout, which may happen on a worker
+  // thread, only reads from it.
+  skt_collection_->findTypefaces(style.getFontFamilies(), style.getFontStyle(),
+                                 style.getFontArguments());
+}
+
 skt::ParagraphPainter::PaintID ParagraphBuilderSkia::CreatePaintID(
     const flutter::DlPaint& dl_paint) {
   dl_paints_.push_back(dl_paint);
@@ -51,6 +51,7 @@ class ParagraphBuilderSkia : public ParagraphBuilder {
       const flutter::DlPaint& dl_paint);
   skia::textlayout::ParagraphStyle TxtToSkia(const ParagraphStyle& txt);
   skia::textlayout::TextStyle TxtToSkia(const TextStyle& txt);
+  void ResolveTypefaces(const skia::textlayout::TextStyle& style);
 
   std::shared_ptr<skia::textlayout::ParagraphBuilder> builder_;
   TextStyle base_style_;
@@ -62,6 +63,7 @@ class ParagraphBuilderSkia : public ParagraphBuilder {
   ///             `drawLine` API, because Impeller's path rendering does not
   ///             support dashed and dotted lines (but Skia's does).
   const bool impeller_enabled_;
+  sk_sp<skia::textlayout::FontCollection> skt_collection_;
   std::stack<TextStyle> txt_style_stack_;
   std::vector<flutter::DlPaint> dl_paints_;
 };
@@ -69,10 +69,15 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
   ///             decision (i.e. with `#ifdef`) instead of a runtime option.
   DisplayListParagraphPainter(DisplayListBuilder* builder,
                               const std::vector<DlPaint>& dl_paints,
-                              bool impeller_enabled)
+                              bool impeller_enabled,
+                              TextFrameCache* text_frames = nullptr)
       : builder_(builder),
         dl_paints_(dl_paints),
-        impeller_enabled_(impeller_enabled) {}
+        impeller_enabled_(impeller_enabled),
+        text_frames_(text_frames) {}
+
+  /// The number of text frames drawn from the text frame cache.
+  size_t GetTextFrameDraws() const { return text_frame_draws_; }
 
   void drawTextBlob(const sk_sp<SkTextBlob>& blob,
                     SkScalar x,
@@ -92,8 +97,8 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
         // If there is no path, this is an emoji and should be drawn as is,
         // ignoring the color source.
         if (path.isEmpty()) {
-          builder_->DrawTextFrame(impeller::MakeTextFrameFromTextBlobSkia(blob),
-                                  x, y, dl_paints_[paint_id]);
+          builder_->DrawTextFrame(GetTextFrame(blob), x, y,
+                                  dl_paints_[paint_id]);
 
           return;
         }
@@ -103,8 +108,7 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
         builder_->DrawPath(transformed, dl_paints_[paint_id]);
         return;
       }
-      builder_->DrawTextFrame(impeller::MakeTextFrameFromTextBlobSkia(blob), x,
-                              y, dl_paints_[paint_id]);
+      builder_->DrawTextFrame(GetTextFrame(blob), x, y, dl_paints_[paint_id]);
       return;
     }
 #endif  // IMPELLER_SUPPORTS_RENDERING
@@ -126,8 +130,7 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
       paint.setMaskFilter(&filter);
     }
     if (impeller_enabled_) {
-      builder_->DrawTextFrame(impeller::MakeTextFrameFromTextBlobSkia(blob), x,
-                              y, paint);
+      builder_->DrawTextFrame(GetTextFrame(blob), x, y, paint);
       return;
     }
     builder_->DrawTextBlob(blob, x, y, paint);
@@ -180,6 +183,19 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
   void restore() override { builder_->Restore(); }
 
  private:
+  std::shared_ptr<impeller::TextFrame> GetTextFrame(
+      const sk_sp<SkTextBlob>& blob) {
+    if (!text_frames_) {
+      return impeller::MakeTextFrameFromTextBlobSkia(blob);
+    }
+    text_frame_draws_++;
+    auto [it, inserted] = text_frames_->try_emplace(blob->uniqueID());
+    if (inserted) {
+      it->second = impeller::MakeTextFrameFromTextBlobSkia(blob);
+    }
+    return it->second;
+  }
+
   bool ShouldRenderAsPath(const DlPaint& paint) const {
     FML_DCHECK(impeller_enabled_);
     // Text with non-trivial color sources should be rendered as a path when
@@ -209,6 +225,8 @@ class DisplayListParagraphPainter : public skt::ParagraphPainter {
   DisplayListBuilder* builder_;
   const std::vector<DlPaint>& dl_paints_;
   const bool impeller_enabled_;
+  TextFrameCache* text_frames_;
+  size_t text_frame_draws_ = 0;
 };
 
 }  // anonymous namespace
@@ -299,12 +317,21 @@ bool ParagraphSkia::DidExceedMaxLines() {
 void ParagraphSkia::Layout(double width) {
   line_metrics_.reset();
   line_metrics_styles_.clear();
+  text_frames_.clear();
   paragraph_->layout(width);
 }
 
 bool ParagraphSkia::Paint(DisplayListBuilder* builder, double x, double y) {
-  DisplayListParagraphPainter painter(builder, dl_paints_, impeller_enabled_);
+  DisplayListParagraphPainter painter(
+      builder, dl_paints_, impeller_enabled_,
+      impeller_enabled_ ? &text_frames_ : nullptr);
   paragraph_->paint(&painter, x, y);
+  // Every cached frame is drawn at least once per paint as long as SkParagraph
+  // reuses its blobs. If it ever stops doing so, don't let stale frames pile
+  // up until the next layout.
+  if (text_frames_.size() > painter.GetTextFrameDraws()) {
+    text_frames_.clear();
+  }
   return true;
 }
 
@@ -17,14 +17,25 @@
 #ifndef LIB_TXT_SRC_PARAGRAPH_SKIA_H_
 #define LIB_TXT_SRC_PARAGRAPH_SKIA_H_
 
+#include <memory>
 #include <optional>
+#include <unordered_map>
 
 #include "txt/paragraph.h"
 
 #include "third_party/skia/modules/skparagraph/include/Paragraph.h"
 
+namespace impeller {
+class TextFrame;
+}  // namespace impeller
+
 namespace txt {
 
+// Text frames converted from the text blobs of a laid out paragraph, keyed by
+// the unique ID of the blob.
+using TextFrameCache =
+    std::unordered_map<uint32_t, std::shared_ptr<impeller::TextFrame>>;
+
 // Implementation of Paragraph based on Skia's text layout module.
 class ParagraphSkia : public Paragraph {
  public:
@@ -93,6 +104,9 @@ class ParagraphSkia : public Paragraph {
   std::vector<flutter::DlPaint> dl_paints_;
   std::optional<std::vector<LineMetrics>> line_metrics_;
   std::vector<TextStyle> line_metrics_styles_;
+  // SkParagraph reuses its text blobs until the next layout, so their
+  // conversions to Impeller text frames are kept until then as well.
+  TextFrameCache text_frames_;
   const bool impeller_enabled_;
 };
 
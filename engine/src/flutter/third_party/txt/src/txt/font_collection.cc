@@ -17,6 +17,7 @@
 #include "font_collection.h"
 
 #include <algorithm>
+#include <cstring>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -26,12 +27,15 @@
 #include <vector>
 #include "flutter/fml/logging.h"
 #include "flutter/fml/trace_event.h"
+#include "third_party/skia/modules/skparagraph/include/ParagraphCache.h"  // nogncheck
 #include "txt/platform.h"
 #include "txt/text_style.h"
 
 namespace txt {
 
-FontCollection::FontCollection() : enable_font_fallback_(true) {}
+FontCollection::FontCollection()
+    : enable_font_fallback_(true),
+      shaping_cache_counters_(std::make_shared<ShapingCacheCounters>()) {}
 
 FontCollection::~FontCollection() {
   if (skt_collection_) {
@@ -40,31 +44,37 @@ FontCollection::~FontCollection() {
 }
 
 size_t FontCollection::GetFontManagersCount() const {
+  std::scoped_lock lock(mutex_);
   return GetFontManagerOrder().size();
 }
 
 void FontCollection::SetupDefaultFontManager(
     uint32_t font_initialization_data) {
+  std::scoped_lock lock(mutex_);
   default_font_manager_ = GetDefaultFontManager(font_initialization_data);
   skt_collection_.reset();
 }
 
 void FontCollection::SetDefaultFontManager(sk_sp<SkFontMgr> font_manager) {
+  std::scoped_lock lock(mutex_);
   default_font_manager_ = font_manager;
   skt_collection_.reset();
 }
 
 void FontCollection::SetAssetFontManager(sk_sp<SkFontMgr> font_manager) {
+  std::scoped_lock lock(mutex_);
   asset_font_manager_ = font_manager;
   skt_collection_.reset();
 }
 
 void FontCollection::SetDynamicFontManager(sk_sp<SkFontMgr> font_manager) {
+  std::scoped_lock lock(mutex_);
   dynamic_font_manager_ = font_manager;
   skt_collection_.reset();
 }
 
 void FontCollection::SetTestFontManager(sk_sp<SkFontMgr> font_manager) {
+  std::scoped_lock lock(mutex_);
   test_font_manager_ = font_manager;
   skt_collection_.reset();
 }
@@ -84,6 +94,7 @@ std::vector<sk_sp<SkFontMgr>> FontCollection::GetFontManagerOrder() const {
 }
 
 void FontCollection::DisableFontFallback() {
+  std::scoped_lock lock(mutex_);
   enable_font_fallback_ = false;
   if (skt_collection_) {
     skt_collection_->disableFontFallback();
@@ -91,13 +102,29 @@ void FontCollection::DisableFontFallback() {
 }
 
 void FontCollection::ClearFontFamilyCache() {
+  std::scoped_lock lock(mutex_);
   if (skt_collection_) {
     skt_collection_->clearCaches();
+    skt_collection_->getParagraphCache()->reset();
   }
+  shaping_cache_counters_->hits = 0;
+  shaping_cache_counters_->misses = 0;
+}
+
+FontCollection::ShapingCacheStats FontCollection::GetShapingCacheStats() {
+  std::scoped_lock lock(mutex_);
+  ShapingCacheStats stats;
+  stats.hits = shaping_cache_counters_->hits;
+  stats.misses = shaping_cache_counters_->misses;
+  if (skt_collection_) {
+    stats.entry_count = skt_collection_->getParagraphCache()->count();
+  }
+  return stats;
 }
 
 sk_sp<skia::textlayout::FontCollection>
 FontCollection::CreateSktFontCollection() {
+  std::scoped_lock lock(mutex_);
   if (!skt_collection_) {
     skt_collection_ = sk_make_sp<skia::textlayout::FontCollection>();
 
@@ -113,6 +140,22 @@ FontCollection::CreateSktFontCollection() {
     if (!enable_font_fallback_) {
       skt_collection_->disableFontFallback();
     }
+
+    // The checker is called on every lookup of a paragraph that is about to
+    // be shaped.
+    skt_collection_->getParagraphCache()->setChecker(
+        [counters = shaping_cache_counters_](
+            skia::textlayout::ParagraphImpl* paragraph, const char* event,
+            bool found) {
+          if (std::strcmp(event, "findParagraph") != 0) {
+            return;
+          }
+          if (found) {
+            counters->hits++;
+          } else {
+            counters->misses++;
+          }
+        });
   }
 
   return skt_collection_;
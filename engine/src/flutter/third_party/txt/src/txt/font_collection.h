@@ -17,7 +17,9 @@
 #ifndef LIB_TXT_SRC_FONT_COLLECTION_H_
 #define LIB_TXT_SRC_FONT_COLLECTION_H_
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -32,6 +34,10 @@
 
 namespace txt {
 
+// The collection may be used by paragraphs that are built and laid out on
+// several threads. Paragraph builders resolve the typefaces of their styles
+// while building, so laying out a built paragraph only reads the caches of the
+// Skia font collection.
 class FontCollection : public std::enable_shared_from_this<FontCollection> {
  public:
   FontCollection();
@@ -50,9 +56,26 @@ class FontCollection : public std::enable_shared_from_this<FontCollection> {
   // missing from the requested font family.
   void DisableFontFallback();
 
-  // Remove all entries in the font family cache.
+  // Remove all entries in the font family cache and the shaping cache, and
+  // reset the shaping cache statistics.
   void ClearFontFamilyCache();
 
+  // Statistics of the shaping cache since it was last cleared.
+  //
+  // The shaping cache is Skia's paragraph cache, which is owned by the Skia
+  // font collection. Paragraphs with the same text, styles (fonts, features
+  // and locale) and paragraph style reuse its shaped runs instead of
+  // reshaping the text. The cache is bounded to a fixed number of entries by
+  // Skia and evicts the least recently used paragraph first; this collection
+  // only counts its hits and misses.
+  struct ShapingCacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t entry_count = 0;
+  };
+
+  ShapingCacheStats GetShapingCacheStats();
+
   // Construct a Skia text layout FontCollection based on this collection.
   sk_sp<skia::textlayout::FontCollection> CreateSktFontCollection();
 
@@ -63,6 +86,17 @@ class FontCollection : public std::enable_shared_from_this<FontCollection> {
   sk_sp<SkFontMgr> test_font_manager_;
   bool enable_font_fallback_;
 
+  // Guards the font managers and the lazily created `skt_collection_`.
+  mutable std::mutex mutex_;
+
+  // Counters shared with the cache checker installed on `skt_collection_`,
+  // which may outlive this collection.
+  struct ShapingCacheCounters {
+    std::atomic<size_t> hits = 0;
+    std::atomic<size_t> misses = 0;
+  };
+  std::shared_ptr<ShapingCacheCounters> shaping_cache_counters_;
+
   // An equivalent font collection usable by the Skia text shaper library.
   sk_sp<skia::textlayout::FontCollection> skt_collection_;
 
@@ -18,7 +18,11 @@
 
 #include <sstream>
 
+#include "runtime/test_font_data.h"
+#include "skia/paragraph_builder_skia.h"
+#include "txt/asset_font_manager.h"
 #include "txt/font_collection.h"
+#include "txt/typeface_font_asset_provider.h"
 
 namespace txt {
 namespace testing {
@@ -28,6 +32,29 @@ class FontCollectionTests : public ::testing::Test {
   FontCollectionTests() {}
 
   void SetUp() override {}
+
+  static std::shared_ptr<FontCollection> MakeTestFontCollection() {
+    auto font_collection = std::make_shared<FontCollection>();
+    auto font_provider = std::make_unique<TypefaceFontAssetProvider>();
+    for (auto& typeface : flutter::GetTestFontData()) {
+      font_provider->RegisterTypeface(typeface);
+    }
+    font_collection->SetAssetFontManager(
+        sk_make_sp<AssetFontManager>(std::move(font_provider)));
+    return font_collection;
+  }
+
+  static void LayoutText(const std::shared_ptr<FontCollection>& collection,
+                         const std::u16string& text) {
+    TextStyle text_style;
+    text_style.font_families.push_back("ahem");
+    ParagraphBuilderSkia builder(ParagraphStyle(), collection,
+                                 /*impeller_enabled=*/false);
+    builder.PushStyle(text_style);
+    builder.AddText(text);
+    builder.Pop();
+    builder.Build()->Layout(100);
+  }
 };
 
 TEST_F(FontCollectionTests, SettingUpDefaultFontManagerClearsCache) {
@@ -39,5 +66,28 @@ TEST_F(FontCollectionTests, SettingUpDefaultFontManagerClearsCache) {
   sk_font_collection = font_collection.CreateSktFontCollection();
   ASSERT_NE(sk_font_collection->getFallbackManager().get(), nullptr);
 }
+
+TEST_F(FontCollectionTests, ShapingCacheIsSharedAcrossParagraphs) {
+  auto font_collection = MakeTestFontCollection();
+
+  LayoutText(font_collection, u"Label");
+  LayoutText(font_collection, u"Label");
+  LayoutText(font_collection, u"Other label");
+
+  FontCollection::ShapingCacheStats stats =
+      font_collection->GetShapingCacheStats();
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.misses, 2u);
+  EXPECT_EQ(stats.entry_count, 2u);
+
+  font_collection->ClearFontFamilyCache();
+  stats = font_collection->GetShapingCacheStats();
+  EXPECT_EQ(stats.hits, 0u);
+  EXPECT_EQ(stats.misses, 0u);
+  EXPECT_EQ(stats.entry_count, 0u);
+
+  LayoutText(font_collection, u"Label");
+  EXPECT_EQ(font_collection->GetShapingCacheStats().misses, 1u);
+}
 }  // namespace testing
 }  // namespace txt
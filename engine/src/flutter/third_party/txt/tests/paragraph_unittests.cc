@@ -47,6 +47,9 @@ class DlOpRecorder final : public virtual DlOpReceiver,
   int rectCount() const { return rects_.size(); }
   int pathCount() const { return paths_.size(); }
   int textFrameCount() const { return text_frames_.size(); }
+  const std::vector<std::shared_ptr<impeller::TextFrame>>& textFrames() const {
+    return text_frames_;
+  }
   int blobCount() const { return blobs_.size(); }
 
  private:
@@ -138,19 +141,22 @@ class PainterTestBase : public CanvasTestBase<T> {
   }
 
   sk_sp<DisplayList> draw(txt::TextStyle style) const {
-    auto pb_skia = makeParagraphBuilder();
-    pb_skia.PushStyle(style);
-    pb_skia.AddText(u"Hello World!");
-    pb_skia.Pop();
-
     auto builder = DisplayListBuilder();
-    auto paragraph = pb_skia.Build();
+    auto paragraph = build(style);
     paragraph->Layout(10000);
     paragraph->Paint(&builder, 0, 0);
 
     return builder.Build();
   }
 
+  std::unique_ptr<txt::Paragraph> build(txt::TextStyle style) const {
+    auto pb_skia = makeParagraphBuilder();
+    pb_skia.PushStyle(style);
+    pb_skia.AddText(u"Hello World!");
+    pb_skia.Pop();
+    return pb_skia.Build();
+  }
+
  private:
   std::shared_ptr<txt::FontCollection> makeFontCollection() const {
     auto f_collection = std::make_shared<txt::FontCollection>();
@@ -318,6 +324,27 @@ TEST_F(PainterTest, DrawEmojiTextWithGradientImpeller) {
   EXPECT_EQ(recorder.pathCount(), 0);
 }
 
+TEST_F(PainterTest, RepaintReusesTextFramesUntilRelayoutImpeller) {
+  PretendImpellerIsEnabled(true);
+
+  auto paragraph = build(makeStyle());
+  auto paint = [&paragraph]() {
+    auto builder = DisplayListBuilder();
+    paragraph->Paint(&builder, 0, 0);
+    auto recorder = DlOpRecorder();
+    builder.Build()->Dispatch(recorder);
+    EXPECT_EQ(recorder.textFrameCount(), 1);
+    return recorder.textFrames().front();
+  };
+
+  paragraph->Layout(10000);
+  auto first = paint();
+  EXPECT_EQ(paint(), first);
+
+  paragraph->Layout(5000);
+  EXPECT_NE(paint(), first);
+}
+
 TEST_F(PainterTest, DrawTextBlobNoImpeller) {
   PretendImpellerIsEnabled(false);
 